@@ -66,6 +66,26 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_generator_generate(
     const unsigned char *seed32
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Generate multiple generators for the curve at once.
+ *
+ *  Returns: 0 in the highly unlikely case one of the seeds is not acceptable.
+ *           1 otherwise.
+ *  Args: ctx:     a secp256k1 context object
+ *  Out:  gens:    array of n generator objects (can be NULL if n is 0)
+ *  In:   seeds32: array of n pointers to 32-byte seeds (can be NULL if n is 0)
+ *        n:       number of generators to generate
+ *
+ *  The i-th generator is the same as the one secp256k1_generator_generate would
+ *  produce for the i-th seed, but the field inversions of all seeds are shared,
+ *  which makes this considerably faster when many generators are needed.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_generator_generate_batch(
+    const secp256k1_context* ctx,
+    secp256k1_generator* gens,
+    const unsigned char * const *seeds32,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 /** Generate a blinded generator for the curve.
  *
  *  Returns: 0 in the highly unlikely case the seed is not acceptable or when
@@ -0,0 +1,164 @@
+#ifndef SECP256K1_MULTIEXP_H
+#define SECP256K1_MULTIEXP_H
+
+#include "secp256k1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** This module exposes the library's multi-scalar multiplication engine, which
+ *  computes sum(scalar_i * point_i) + g_scalar * G using Strauss' algorithm for
+ *  small and Pippenger's algorithm for large numbers of points. The algorithm
+ *  and batch sizes are chosen automatically based on the size of the scratch
+ *  space. None of the functions are constant time; they must not be used with
+ *  secret scalars.
+ */
+
+/** A pointer to a function that supplies the scalar and point with index idx
+ *  of a multi-scalar multiplication.
+ *
+ *  Returns: 1 if the scalar and point were written.
+ *           0 will cause secp256k1_multiexp_with_callback to fail and return 0.
+ *  Out:     scalar32: pointer to a 32-byte array to receive the big-endian scalar.
+ *           point:    pointer to a public key object to receive the point.
+ *  In:      idx:      index of the requested term, 0 <= idx < n_points.
+ *           data:     arbitrary data pointer that is passed through.
+ */
+typedef int (*secp256k1_multiexp_callback)(
+    unsigned char *scalar32,
+    secp256k1_pubkey *point,
+    size_t idx,
+    void *data
+);
+
+/** Compute sum(scalars32[i] * points[i]) + g_scalar32 * G.
+ *
+ *  Returns: 1: the result was computed
+ *           0: a scalar overflowed the group order or an argument was invalid
+ *  Args:        ctx: pointer to a context object (cannot be NULL)
+ *           scratch: scratch space used for the precomputation of Strauss' and
+ *                    Pippenger's algorithms. If NULL or too small, every point
+ *                    is multiplied separately, which is much slower.
+ *  Out:      result: pointer to a public key object receiving the sum. If the
+ *                    sum is the point at infinity, it is cleared to all zeros
+ *                    (and not a valid public key). Can be NULL.
+ *       is_infinity: pointer to an integer set to 1 if the sum is the point at
+ *                    infinity and 0 otherwise (cannot be NULL)
+ *  In:   g_scalar32: 32-byte big-endian scalar by which the generator G is
+ *                    multiplied, or NULL for no G term.
+ *            points: array of n_points pointers to public keys (cannot be NULL
+ *                    if n_points > 0, and none of its entries can be NULL)
+ *         scalars32: array of n_points pointers to 32-byte big-endian scalars
+ *                    (cannot be NULL if n_points > 0, and none of its entries
+ *                    can be NULL)
+ *          n_points: number of points
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_multiexp(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space *scratch,
+    secp256k1_pubkey *result,
+    int *is_infinity,
+    const unsigned char *g_scalar32,
+    const secp256k1_pubkey * const *points,
+    const unsigned char * const *scalars32,
+    size_t n_points
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(4);
+
+/** Compute sum(scalar_i * point_i) + g_scalar32 * G where the terms are
+ *  supplied by a callback.
+ *
+ *  Same as secp256k1_multiexp, except that the i-th scalar and point are
+ *  obtained by calling cb with idx = i. The callback is called exactly once per
+ *  index, so terms can be computed on the fly without storing all of them.
+ *
+ *  Returns: 1: the result was computed
+ *           0: cb returned 0, a scalar overflowed or an argument was invalid
+ *  In:           cb: callback supplying the terms (cannot be NULL if n_points > 0)
+ *            cbdata: arbitrary data pointer that is passed through to cb
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_multiexp_with_callback(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space *scratch,
+    secp256k1_pubkey *result,
+    int *is_infinity,
+    const unsigned char *g_scalar32,
+    secp256k1_multiexp_callback cb,
+    void *cbdata,
+    size_t n_points
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(4);
+
+/** A function computing one task of a parallel multi-scalar multiplication.
+ *
+ *  In:  task_data: opaque pointer passed to the executor
+ *        task_idx: index of the task, 0 <= task_idx < n_tasks
+ */
+typedef void (*secp256k1_multiexp_task)(void *task_data, size_t task_idx);
+
+/** A pointer to a function that runs the tasks of a parallel multi-scalar
+ *  multiplication, e.g. by handing them to a thread pool.
+ *
+ *  The executor must call task(task_data, i) exactly once for every
+ *  0 <= i < n_tasks and return only after all calls have completed. The calls
+ *  may run concurrently and in any order. Different tasks only share
+ *  read-only state, so no locking is required.
+ *
+ *  Returns: 1 if all tasks were run.
+ *           0 will cause secp256k1_multiexp_parallel to fail and return 0.
+ *  In:      task:          function to call for every task
+ *           task_data:     opaque pointer to pass to task
+ *           n_tasks:       number of tasks
+ *           executor_data: arbitrary data pointer that is passed through.
+ */
+typedef int (*secp256k1_multiexp_executor)(
+    secp256k1_multiexp_task task,
+    void *task_data,
+    size_t n_tasks,
+    void *executor_data
+);
+
+/** Compute sum(scalars32[i] * points[i]) + g_scalar32 * G on several threads.
+ *
+ *  The points are split into n_tasks contiguous slices. Slice i is processed
+ *  by task i using only scratches[i], so each worker has its own Pippenger
+ *  buckets. The partial sums are combined in slice order afterwards, making
+ *  the result identical to secp256k1_multiexp regardless of how the executor
+ *  schedules the tasks. If there are too few points to be worth splitting,
+ *  fewer tasks are used, down to a serial computation on scratches[0]. The
+ *  partial sums are stored in scratches[0] while the tasks run.
+ *
+ *  The ctx's illegal callback may be called from the executor's threads.
+ *
+ *  Returns: 1: the result was computed
+ *           0: a scalar overflowed, the executor failed or an argument was
+ *              invalid
+ *  Args:           ctx: pointer to a context object (cannot be NULL)
+ *            scratches: array of n_tasks scratch spaces, one per task (cannot
+ *                       be NULL). No two entries may point to the same scratch
+ *                       space. scratches[0] cannot be NULL; other NULL
+ *                       entries make their task fall back to the slow
+ *                       algorithm described in secp256k1_multiexp.
+ *              n_tasks: maximum number of tasks (must be at least 1)
+ *             executor: function running the tasks (cannot be NULL)
+ *        executor_data: arbitrary data pointer passed through to executor
+ *  Out, In: see secp256k1_multiexp.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_multiexp_parallel(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space * const *scratches,
+    size_t n_tasks,
+    secp256k1_multiexp_executor executor,
+    void *executor_data,
+    secp256k1_pubkey *result,
+    int *is_infinity,
+    const unsigned char *g_scalar32,
+    const secp256k1_pubkey * const *points,
+    const unsigned char * const *scalars32,
+    size_t n_points
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(7);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECP256K1_MULTIEXP_H */
@@ -47,6 +47,18 @@ typedef struct {
     unsigned char data[165];
 } secp256k1_musig_keyagg_cache;
 
+/** Opaque data structure that holds an ordered list of public keys together
+ *  with intermediate results of their aggregation.
+ *
+ *  Create it with secp256k1_musig_keyagg_state_create or
+ *  secp256k1_musig_keyagg_state_parse when the aggregate of a list of public
+ *  keys has to be recomputed after adding, removing or replacing single keys.
+ *  The state keeps the loaded public keys and the hashes of prefixes of the
+ *  key list, so secp256k1_musig_keyagg_state_agg only needs to load the keys
+ *  that changed and to rehash the list from the first changed key onwards.
+ */
+typedef struct secp256k1_musig_keyagg_state_struct secp256k1_musig_keyagg_state;
+
 /** Opaque data structure that holds a signer's _secret_ nonce.
  *
  *  Guaranteed to be 68 bytes in size.
@@ -197,13 +209,11 @@ SECP256K1_API int secp256k1_musig_partial_sig_parse(
  *
  *  Returns: 0 if the arguments are invalid, 1 otherwise
  *  Args:        ctx: pointer to a context object initialized for verification
- *           scratch: should be NULL because it is not yet implemented. If it
- *                    was implemented then the scratch space would be used to
- *                    compute the aggregate pubkey by multiexponentiation.
- *                    Generally, the larger the scratch space, the faster this
- *                    function. However, the returns of providing a larger
- *                    scratch space are diminishing. If NULL, an inefficient
- *                    algorithm is used.
+ *           scratch: scratch space used to compute the aggregate pubkey by
+ *                    multiexponentiation. Generally, the larger the scratch
+ *                    space, the faster this function. However, the returns of
+ *                    providing a larger scratch space are diminishing. If NULL,
+ *                    an inefficient algorithm is used.
  *  Out:      agg_pk: the MuSig-aggregated x-only public key. If you do not need it,
  *                    this arg can be NULL.
  *      keyagg_cache: if non-NULL, pointer to a musig_keyagg_cache struct that
@@ -223,6 +233,150 @@ SECP256K1_API int secp256k1_musig_pubkey_agg(
     size_t n_pubkeys
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(5);
 
+/** Create a key aggregation state for a list of public keys.
+ *
+ *  Returns: a newly created key aggregation state, or NULL if the arguments
+ *           are invalid or memory could not be allocated.
+ *  Args:        ctx: pointer to a context object (cannot be NULL)
+ *  In:      pubkeys: input array of pointers to public keys (can be NULL if
+ *                    n_pubkeys is 0)
+ *         n_pubkeys: length of pubkeys array. Can be 0, in which case keys
+ *                    must be inserted before aggregating.
+ *
+ *  The state must be freed with secp256k1_musig_keyagg_state_destroy.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_musig_keyagg_state* secp256k1_musig_keyagg_state_create(
+    const secp256k1_context* ctx,
+    const secp256k1_xonly_pubkey * const* pubkeys,
+    size_t n_pubkeys
+) SECP256K1_ARG_NONNULL(1);
+
+/** Destroy a key aggregation state.
+ *
+ *  In:        state: the state to destroy (can be NULL, in which case nothing happens)
+ */
+SECP256K1_API void secp256k1_musig_keyagg_state_destroy(
+    secp256k1_musig_keyagg_state* state
+);
+
+/** Replace a public key of a key aggregation state
+ *
+ *  Returns: 0 if the arguments are invalid, 1 otherwise
+ *  Args:        ctx: pointer to a context object
+ *  In/Out:    state: pointer to the key aggregation state
+ *  In:        index: position of the key to replace. Must be smaller than the
+ *                    number of keys in the state.
+ *            pubkey: the new public key
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_musig_keyagg_state_set_pubkey(
+    const secp256k1_context* ctx,
+    secp256k1_musig_keyagg_state *state,
+    size_t index,
+    const secp256k1_xonly_pubkey *pubkey
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(4);
+
+/** Insert a public key into a key aggregation state
+ *
+ *  Returns: 0 if the arguments are invalid or memory could not be allocated,
+ *           1 otherwise
+ *  Args:        ctx: pointer to a context object
+ *  In/Out:    state: pointer to the key aggregation state
+ *  In:        index: position of the new key. The keys at this and later
+ *                    positions move back by one. Must not be larger than the
+ *                    number of keys in the state; if it is equal, the key is
+ *                    appended.
+ *            pubkey: the public key to insert
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_musig_keyagg_state_insert_pubkey(
+    const secp256k1_context* ctx,
+    secp256k1_musig_keyagg_state *state,
+    size_t index,
+    const secp256k1_xonly_pubkey *pubkey
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(4);
+
+/** Remove a public key from a key aggregation state
+ *
+ *  Returns: 0 if the arguments are invalid, 1 otherwise
+ *  Args:        ctx: pointer to a context object
+ *  In/Out:    state: pointer to the key aggregation state
+ *  In:        index: position of the key to remove. The keys at later
+ *                    positions move forward by one. Must be smaller than the
+ *                    number of keys in the state.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_musig_keyagg_state_remove_pubkey(
+    const secp256k1_context* ctx,
+    secp256k1_musig_keyagg_state *state,
+    size_t index
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
+/** Computes the aggregate public key of the keys in a key aggregation state
+ *
+ *  The result is the same as calling `musig_pubkey_agg` with the current list
+ *  of keys of the state. The KeyAgg coefficients of all keys depend on the
+ *  hash of the whole list and are therefore recomputed, but the keys are not
+ *  loaded again and the hash of the list is only recomputed from the first key
+ *  that changed since the last call.
+ *
+ *  Returns: 0 if the arguments are invalid, 1 otherwise
+ *  Args:        ctx: pointer to a context object initialized for verification
+ *           scratch: scratch space used for the multiexponentiation (see
+ *                    `musig_pubkey_agg`). Can be NULL.
+ *  Out:      agg_pk: the MuSig-aggregated x-only public key. If you do not need it,
+ *                    this arg can be NULL.
+ *      keyagg_cache: if non-NULL, pointer to a musig_keyagg_cache struct that
+ *                    is required for signing (or observing the signing session
+ *                    and verifying partial signatures).
+ *  In/Out:    state: pointer to the key aggregation state. It must contain at
+ *                    least one key.
+ */
+SECP256K1_API int secp256k1_musig_keyagg_state_agg(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space *scratch,
+    secp256k1_xonly_pubkey *agg_pk,
+    secp256k1_musig_keyagg_cache *keyagg_cache,
+    secp256k1_musig_keyagg_state *state
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(5);
+
+/** Serialize the list of public keys of a key aggregation state
+ *
+ *  The serialization is the concatenation of the 32-byte serializations of
+ *  the public keys in their order in the state.
+ *
+ *  Returns: 0 if the arguments are invalid or the output is too small,
+ *           1 otherwise
+ *  Args:        ctx: pointer to a context object
+ *  Out:      output: pointer to a byte array to place the serialization in
+ *  In/Out: outputlen: pointer to an integer which is initially set to the size
+ *                    of output, and is overwritten with the number of bytes
+ *                    written (32 times the number of keys).
+ *  In:        state: pointer to the key aggregation state
+ */
+SECP256K1_API int secp256k1_musig_keyagg_state_serialize(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    size_t *outputlen,
+    const secp256k1_musig_keyagg_state *state
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+/** Create a key aggregation state from a serialized list of public keys
+ *
+ *  Returns: a newly created key aggregation state, or NULL if the input is not
+ *           a valid serialization or memory could not be allocated.
+ *  Args:        ctx: pointer to a context object
+ *  In:        input: pointer to a serialization as produced by
+ *                    `musig_keyagg_state_serialize` (can be NULL if inputlen
+ *                    is 0)
+ *          inputlen: length of input. An input whose length is not a
+ *                    multiple of 32 is invalid.
+ *
+ *  The state must be freed with secp256k1_musig_keyagg_state_destroy.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_musig_keyagg_state* secp256k1_musig_keyagg_state_parse(
+    const secp256k1_context* ctx,
+    const unsigned char *input,
+    size_t inputlen
+) SECP256K1_ARG_NONNULL(1);
+
 /** Obtain the aggregate public key from a keyagg_cache.
  *
  *  This is only useful if you need the non-xonly public key, in particular for
@@ -376,6 +530,54 @@ SECP256K1_API int secp256k1_musig_nonce_gen(
     const unsigned char *extra_input32
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Generates many nonces at once
+ *
+ *  The i-th nonce (counting from 0) is the same as the one that
+ *  secp256k1_musig_nonce_gen would output for the session id
+ *  SHA256(SHA256("MuSig/batchsessionid") || SHA256("MuSig/batchsessionid") ||
+ *  session_id_seed32 || i), where i is encoded as 8-byte big endian integer,
+ *  and the remaining arguments of this function. Generating many nonces at
+ *  once is faster because their hashes are computed side by side and all
+ *  public nonces are converted to affine coordinates with a single field
+ *  inversion.
+ *
+ *  The rules of secp256k1_musig_nonce_gen apply with session_id_seed32 in
+ *  place of session_id32: it must not be reused in subsequent calls of this
+ *  function or be used as session_id32 of secp256k1_musig_nonce_gen, and
+ *  should be uniformly random and kept secret. Each of the secnonces must be
+ *  used for at most one signing session.
+ *
+ *  Returns: 0 if the arguments are invalid and 1 otherwise
+ *  Args:         ctx: pointer to a context object, initialized for signing
+ *  Out:    secnonces: array of n_nonces structures to store the secret nonces
+ *                     (can be NULL if n_nonces is 0)
+ *          pubnonces: array of n_nonces structures to store the public nonces
+ *                     (can be NULL if n_nonces is 0)
+ *  In: session_id_seed32: a 32-byte seed the session ids are derived from as
+ *                     explained above
+ *           n_nonces: number of nonces to generate
+ *             seckey: the 32-byte secret key that will later be used for signing, if
+ *                     already known (can be NULL)
+ *              msg32: the 32-byte message that will later be signed, if already known
+ *                     (can be NULL)
+ *       keyagg_cache: pointer to the keyagg_cache that was used to create the aggregate
+ *                     (and potentially tweaked) public key if already known
+ *                     (can be NULL)
+ *      extra_input32: an optional 32-byte array that is input to the nonce
+ *                     derivation function (can be NULL)
+ */
+SECP256K1_API int secp256k1_musig_nonce_gen_batch(
+    const secp256k1_context* ctx,
+    secp256k1_musig_secnonce *secnonces,
+    secp256k1_musig_pubnonce *pubnonces,
+    const unsigned char *session_id_seed32,
+    size_t n_nonces,
+    const unsigned char *seckey,
+    const unsigned char *msg32,
+    const secp256k1_musig_keyagg_cache *keyagg_cache,
+    const unsigned char *extra_input32
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(4);
+
 /** Aggregates the nonces of all signers into a single nonce
  *
  *  This can be done by an untrusted party to reduce the communication
@@ -499,6 +701,47 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_musig_partial_sig_verif
     const secp256k1_musig_session *session
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(6);
 
+/** Verifies the partial signatures of many signers in a signing session
+ *
+ *  All partial signatures are checked with a single multi-scalar
+ *  multiplication over random linear combinations of the individual
+ *  verification equations. The result is the same as calling
+ *  `musig_partial_sig_verify` on each partial signature, except with negligible
+ *  probability. The same requirements on the arguments apply.
+ *
+ *  Returns: 1: all partial signatures are correct (or n_sigs is 0)
+ *           0: the arguments are invalid or at least one partial signature
+ *              does not verify
+ *  Args:          ctx: pointer to a context object
+ *             scratch: scratch space used for the multi-scalar multiplication.
+ *                      If it is NULL or too small, the points are multiplied one
+ *                      by one, which is slower than individual verification.
+ *  Out:  failed_index: if not NULL and 0 is returned, set to the index of the
+ *                      first partial signature that does not verify. Locating
+ *                      it costs an individual verification per signature.
+ *  In:   partial_sigs: array of n_sigs pointers to partial signatures
+ *           pubnonces: array of n_sigs pointers to the public nonces of the
+ *                      signers that created partial_sigs
+ *             pubkeys: array of n_sigs pointers to the public keys of the
+ *                      signers that created partial_sigs
+ *        keyagg_cache: pointer to the keyagg_cache that was output when the
+ *                      aggregate public key for this signing session
+ *             session: pointer to the session that was created with
+ *                      `musig_nonce_process`
+ *              n_sigs: number of partial signatures
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_musig_partial_sig_verify_batch(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space *scratch,
+    size_t *failed_index,
+    const secp256k1_musig_partial_sig * const *partial_sigs,
+    const secp256k1_musig_pubnonce * const *pubnonces,
+    const secp256k1_xonly_pubkey * const *pubkeys,
+    const secp256k1_musig_keyagg_cache *keyagg_cache,
+    const secp256k1_musig_session *session,
+    size_t n_sigs
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8);
+
 /** Aggregates partial signatures
  *
  *  Returns: 0 if the arguments are invalid, 1 otherwise (which does NOT mean
@@ -23,6 +23,48 @@ typedef struct {
     unsigned char data[64];
 } secp256k1_pedersen_commitment;
 
+/** Opaque data structure that stores a Pedersen commitment in expanded form
+ *
+ *  Unlike secp256k1_pedersen_commitment, this holds both coordinates of the
+ *  commitment point, so using it does not require recomputing a square root.
+ *  Create it with secp256k1_pedersen_commitment_expand when a commitment is
+ *  used by several verification functions.
+ *
+ *  The exact representation of data inside is implementation defined and not
+ *  guaranteed to be portable between different platforms or versions. It is
+ *  however guaranteed to be 64 bytes in size, and can be safely copied/moved.
+ */
+typedef struct {
+    unsigned char data[64];
+} secp256k1_pedersen_commitment_expanded;
+
+/** Opaque data structure that holds a generator together with a table of
+ *  precomputed multiples of it.
+ *
+ *  Create it with secp256k1_generator_table_create for a generator that is
+ *  used by many commitments or range proofs, and pass it to the *_with_table
+ *  variants of the functions that take a generator; they then multiply values
+ *  with the generator much faster. The table takes about 16 KiB of memory.
+ */
+typedef struct secp256k1_generator_table_struct secp256k1_generator_table;
+
+/** Opaque data structure that holds a parsed range proof.
+ *
+ *  It is filled by secp256k1_rangeproof_view_parse, which checks the header of
+ *  the proof once, and can then be passed to secp256k1_rangeproof_info_view,
+ *  secp256k1_rangeproof_verify_view and secp256k1_rangeproof_rewind_view
+ *  instead of the proof itself. The view does not copy the proof but points
+ *  into the buffer it was parsed from, so that buffer must stay unmodified for
+ *  as long as the view is used.
+ *
+ *  The exact representation of data inside is implementation defined and not
+ *  guaranteed to be portable between different platforms or versions. It is
+ *  however guaranteed to be 96 bytes in size, and can be safely copied/moved.
+ */
+typedef struct {
+    unsigned char data[96];
+} secp256k1_rangeproof_view;
+
 /**
  * Static constant generator 'h' maintained for historical reasons.
  */
@@ -55,6 +97,20 @@ SECP256K1_API int secp256k1_pedersen_commitment_serialize(
     const secp256k1_pedersen_commitment* commit
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Expand a commitment object.
+ *
+ *  Returns: 1 always.
+ *  Args:   ctx:        a secp256k1 context object.
+ *  Out:    expanded:   pointer to the output expanded commitment object
+ *  In:     commit:     a pointer to a secp256k1_pedersen_commitment containing an
+ *                      initialized commitment
+ */
+SECP256K1_API int secp256k1_pedersen_commitment_expand(
+    const secp256k1_context* ctx,
+    secp256k1_pedersen_commitment_expanded* expanded,
+    const secp256k1_pedersen_commitment* commit
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
 /** Generate a pedersen commitment.
  *  Returns 1: Commitment successfully created.
  *          0: Error. The blinding factor is larger than the group order
@@ -76,6 +132,73 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_commit(
   const secp256k1_generator *gen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5);
 
+/** Generate many pedersen commitments at once.
+ *  Returns 1: All commitments successfully created.
+ *          0: Error. A blinding factor is larger than the group order or a
+ *             commitment is the point at infinity (see secp256k1_pedersen_commit).
+ *             The contents of commits are then unspecified.
+ *  Args:   ctx:        pointer to a context object, initialized for signing and Pedersen commitment (cannot be NULL)
+ *          scratch:    scratch space for a precomputed table of multiples of a generator that is
+ *                      shared by many consecutive outputs. If NULL or too small, no such table is used.
+ *  Out:    commits:    array of n commitments (cannot be NULL if n > 0)
+ *  In:     blinds:     array of n pointers to 32-byte blinding factors (cannot be NULL if n > 0)
+ *          values:     array of n unsigned 64-bit integer values to commit to (cannot be NULL if n > 0)
+ *          gens:       array of n pointers to the additional generators 'h' (cannot be NULL if n > 0)
+ *          n:          number of commitments
+ *
+ *  The result is the same as calling secp256k1_pedersen_commit for every output, but the
+ *  conversions to affine coordinates are batched, and consecutive outputs with the same
+ *  generator share precomputation. Outputs should therefore be grouped by generator.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_commit_batch(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  secp256k1_pedersen_commitment *commits,
+  const unsigned char * const *blinds,
+  const uint64_t *values,
+  const secp256k1_generator * const *gens,
+  size_t n
+) SECP256K1_ARG_NONNULL(1);
+
+/** Create a precomputed table for a generator.
+ *
+ *  Returns: a newly created generator table, or NULL if memory could not be
+ *           allocated or the generator is unsuitable (which does not happen for
+ *           generators made by secp256k1_generator_generate or
+ *           secp256k1_generator_generate_blinded, except with negligible
+ *           probability).
+ *  Args:    ctx: pointer to a context object (cannot be NULL)
+ *  In:      gen: the generator to build the table for (cannot be NULL)
+ *
+ *  The table must be freed with secp256k1_generator_table_destroy.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_generator_table* secp256k1_generator_table_create(
+  const secp256k1_context* ctx,
+  const secp256k1_generator *gen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
+/** Destroy a generator table created with secp256k1_generator_table_create.
+ *
+ *  In:      table: the table to destroy (can be NULL, in which case nothing happens)
+ */
+SECP256K1_API void secp256k1_generator_table_destroy(
+  secp256k1_generator_table* table
+);
+
+/** Generate a pedersen commitment using a precomputed generator table.
+ *
+ *  Same as secp256k1_pedersen_commit, with gen replaced by the generator
+ *  of the table.
+ *  In:     table:      a generator table for the additional generator 'h' (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_commit_with_table(
+  const secp256k1_context* ctx,
+  secp256k1_pedersen_commitment *commit,
+  const unsigned char *blind,
+  uint64_t value,
+  const secp256k1_generator_table *table
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5);
+
 /** Computes the sum of multiple positive and negative blinding factors.
  *  Returns 1: Sum successfully computed.
  *          0: Error. A blinding factor is larger than the group order
@@ -119,6 +242,44 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_verify_tally(
   size_t ncnt
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(4);
 
+/** Verify a tally of pedersen commitments using a scratch space
+ * Returns 1: commitments successfully sum to zero.
+ *         0: Commitments do not sum to zero or other error.
+ * Args:   ctx:        pointer to a context object (cannot be NULL)
+ *         scratch:    scratch space for summing many commitments at once. If NULL or too small,
+ *                     the commitments are summed in small chunks like secp256k1_pedersen_verify_tally.
+ * In:     commits:    pointer to array of pointers to the commitments. (cannot be NULL if pcnt is non-zero)
+ *         pcnt:       number of commitments pointed to by commits.
+ *         ncommits:   pointer to array of pointers to the negative commitments. (cannot be NULL if ncnt is non-zero)
+ *         ncnt:       number of commitments pointed to by ncommits.
+ *
+ * Same as secp256k1_pedersen_verify_tally, but faster for large tallies such as all inputs and outputs of a block.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_verify_tally_batch(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  const secp256k1_pedersen_commitment * const* commits,
+  size_t pcnt,
+  const secp256k1_pedersen_commitment * const* ncommits,
+  size_t ncnt
+) SECP256K1_ARG_NONNULL(1);
+
+/** Verify a tally of expanded pedersen commitments
+ * Returns 1: commitments successfully sum to zero.
+ *         0: Commitments do not sum to zero or other error.
+ *
+ * Same as secp256k1_pedersen_verify_tally_batch, but takes expanded commitments, which are
+ * not decompressed again.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pedersen_verify_tally_expanded(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  const secp256k1_pedersen_commitment_expanded * const* commits,
+  size_t pcnt,
+  const secp256k1_pedersen_commitment_expanded * const* ncommits,
+  size_t ncnt
+) SECP256K1_ARG_NONNULL(1);
+
 /** Sets the final Pedersen blinding factor correctly when the generators themselves
  *  have blinding factors.
  *
@@ -183,6 +344,81 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify(
   const secp256k1_generator* gen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(9);
 
+/** Verify a proof that a committed value is within a range, given an expanded commitment.
+ *
+ * Same as secp256k1_rangeproof_verify, but takes an expanded commitment.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify_expanded(
+  const secp256k1_context* ctx,
+  uint64_t *min_value,
+  uint64_t *max_value,
+  const secp256k1_pedersen_commitment_expanded *commit,
+  const unsigned char *proof,
+  size_t plen,
+  const unsigned char *extra_commit,
+  size_t extra_commit_len,
+  const secp256k1_generator* gen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(9);
+
+/** Verify many range proofs at once.
+ *  Returns 1: All proofs are valid.
+ *          0: At least one proof failed or other error.
+ *  Args:    ctx: pointer to a context object (cannot be NULL)
+ *       scratch: scratch space used to hold the parsed proofs. If NULL or too small to hold
+ *                even a single proof, the proofs are verified one after another instead.
+ *  Out: failed_index: if not NULL and the batch fails, set to the index of the first invalid
+ *                     proof. Locating it costs an individual verification per proof.
+ *       min_values: if not NULL, an array of n_proofs unsigned int64 which will be updated with
+ *                   the minimum value each commit could have. Only meaningful if 1 is returned.
+ *       max_values: if not NULL, an array of n_proofs unsigned int64 which will be updated with
+ *                   the maximum value each commit could have. Only meaningful if 1 is returned.
+ *  In:  commits: array of n_proofs pointers to the commitments being proved (cannot be NULL if n_proofs > 0)
+ *       proofs: array of n_proofs pointers to character arrays with the proofs (cannot be NULL if n_proofs > 0)
+ *       plens: array of the n_proofs proof lengths in bytes (cannot be NULL if n_proofs > 0)
+ *       extra_commits: array of n_proofs pointers to additional data covered in each rangeproof
+ *                      signature, or NULL if no proof has extra data. Entries may be NULL if the
+ *                      corresponding length is 0.
+ *       extra_commit_lens: array of n_proofs lengths of the extra_commits entries (NULL iff extra_commits is NULL)
+ *       gens: array of n_proofs pointers to the additional generators 'h' (cannot be NULL if n_proofs > 0)
+ *       n_proofs: number of proofs
+ *
+ *  The result is the same as calling secp256k1_rangeproof_verify on every proof, but the
+ *  Borromean signatures of all proofs are checked together, sharing the field inversions.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify_batch(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  size_t *failed_index,
+  uint64_t *min_values,
+  uint64_t *max_values,
+  const secp256k1_pedersen_commitment * const *commits,
+  const unsigned char * const *proofs,
+  const size_t *plens,
+  const unsigned char * const *extra_commits,
+  const size_t *extra_commit_lens,
+  const secp256k1_generator * const *gens,
+  size_t n_proofs
+) SECP256K1_ARG_NONNULL(1);
+
+/** Verify many range proofs at once, given expanded commitments.
+ *
+ * Same as secp256k1_rangeproof_verify_batch, but takes expanded commitments.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify_batch_expanded(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  size_t *failed_index,
+  uint64_t *min_values,
+  uint64_t *max_values,
+  const secp256k1_pedersen_commitment_expanded * const *commits,
+  const unsigned char * const *proofs,
+  const size_t *plens,
+  const unsigned char * const *extra_commits,
+  const size_t *extra_commit_lens,
+  const secp256k1_generator * const *gens,
+  size_t n_proofs
+) SECP256K1_ARG_NONNULL(1);
+
 /** Verify a range proof proof and rewind the proof to recover information sent by its author.
  *  Returns 1: Value is within the range [0..2^64), the specifically proven range is in the min/max value outputs, and the value and blinding were recovered.
  *          0: Proof failed, rewind failed, or other error.
@@ -202,6 +438,9 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify(
  *                guaranteed that message_out[i] == 0.
  *        min_value: pointer to an unsigned int64 which will be updated with the minimum value that commit could have. (cannot be NULL)
  *        max_value: pointer to an unsigned int64 which will be updated with the maximum value that commit could have. (cannot be NULL)
+ *
+ *  A proof that was not created with nonce is rejected without being verified, which is much
+ *  cheaper than verifying it; scanning many proofs for the ones created with a nonce is fast.
  */
 SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_rewind(
   const secp256k1_context* ctx,
@@ -220,6 +459,29 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_rewind(
   const secp256k1_generator *gen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8) SECP256K1_ARG_NONNULL(9) SECP256K1_ARG_NONNULL(10) SECP256K1_ARG_NONNULL(14);
 
+/** Rewind a range proof using a precomputed generator table.
+ *
+ *  Same as secp256k1_rangeproof_rewind, with gen replaced by the generator
+ *  of the table.
+ *  In:   table: a generator table for the additional generator 'h' (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_rewind_with_table(
+  const secp256k1_context* ctx,
+  unsigned char *blind_out,
+  uint64_t *value_out,
+  unsigned char *message_out,
+  size_t *outlen,
+  const unsigned char *nonce,
+  uint64_t *min_value,
+  uint64_t *max_value,
+  const secp256k1_pedersen_commitment *commit,
+  const unsigned char *proof,
+  size_t plen,
+  const unsigned char *extra_commit,
+  size_t extra_commit_len,
+  const secp256k1_generator_table *table
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8) SECP256K1_ARG_NONNULL(9) SECP256K1_ARG_NONNULL(10) SECP256K1_ARG_NONNULL(14);
+
 /** Author a proof that a committed value is within a range.
  *  Returns 1: Proof successfully created.
  *          0: Error
@@ -265,6 +527,30 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_sign(
   const secp256k1_generator *gen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(15);
 
+/** Author a range proof using a precomputed generator table.
+ *
+ *  Same as secp256k1_rangeproof_sign, with gen replaced by the generator
+ *  of the table.
+ *  In:     table: a generator table for the additional generator 'h' (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_sign_with_table(
+  const secp256k1_context* ctx,
+  unsigned char *proof,
+  size_t *plen,
+  uint64_t min_value,
+  const secp256k1_pedersen_commitment *commit,
+  const unsigned char *blind,
+  const unsigned char *nonce,
+  int exp,
+  int min_bits,
+  uint64_t value,
+  const unsigned char *message,
+  size_t msg_len,
+  const unsigned char *extra_commit,
+  size_t extra_commit_len,
+  const secp256k1_generator_table *table
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(15);
+
 /** Extract some basic information from a range-proof.
  *  Returns 1: Information successfully extracted.
  *          0: Decode failed.
@@ -286,6 +572,73 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_info(
   size_t plen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
 
+/** Parse a range proof into a view.
+ *  Returns 1: The proof has a valid header and its length matches it.
+ *          0: Decode failed.
+ *  In:   ctx: pointer to a context object
+ *        proof: pointer to character array with the proof. It must not be modified while view is used. (cannot be NULL)
+ *        plen: length of proof in bytes.
+ *  Out:  view: pointer to the view to fill. (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_view_parse(
+  const secp256k1_context* ctx,
+  secp256k1_rangeproof_view *view,
+  const unsigned char *proof,
+  size_t plen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
+/** Extract some basic information from a parsed range-proof.
+ *
+ *  Same as secp256k1_rangeproof_info, with proof and plen replaced by a view
+ *  filled by secp256k1_rangeproof_view_parse.
+ *  Returns 1 always, as the view was already decoded.
+ */
+SECP256K1_API int secp256k1_rangeproof_info_view(
+  const secp256k1_context* ctx,
+  int *exp,
+  int *mantissa,
+  uint64_t *min_value,
+  uint64_t *max_value,
+  const secp256k1_rangeproof_view *view
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(6);
+
+/** Verify a parsed range proof.
+ *
+ *  Same as secp256k1_rangeproof_verify, with proof and plen replaced by a view
+ *  filled by secp256k1_rangeproof_view_parse.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_verify_view(
+  const secp256k1_context* ctx,
+  uint64_t *min_value,
+  uint64_t *max_value,
+  const secp256k1_pedersen_commitment *commit,
+  const secp256k1_rangeproof_view *view,
+  const unsigned char *extra_commit,
+  size_t extra_commit_len,
+  const secp256k1_generator* gen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(8);
+
+/** Verify and rewind a parsed range proof.
+ *
+ *  Same as secp256k1_rangeproof_rewind, with proof and plen replaced by a view
+ *  filled by secp256k1_rangeproof_view_parse.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rangeproof_rewind_view(
+  const secp256k1_context* ctx,
+  unsigned char *blind_out,
+  uint64_t *value_out,
+  unsigned char *message_out,
+  size_t *outlen,
+  const unsigned char *nonce,
+  uint64_t *min_value,
+  uint64_t *max_value,
+  const secp256k1_pedersen_commitment *commit,
+  const secp256k1_rangeproof_view *view,
+  const unsigned char *extra_commit,
+  size_t extra_commit_len,
+  const secp256k1_generator *gen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8) SECP256K1_ARG_NONNULL(9) SECP256K1_ARG_NONNULL(10) SECP256K1_ARG_NONNULL(13);
+
 # ifdef __cplusplus
 }
 # endif
@@ -164,6 +164,41 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorrsig_verify(
     const secp256k1_xonly_pubkey *pubkey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(5);
 
+/** Verify a batch of Schnorr signatures.
+ *
+ *  All signatures are checked with a single multi-scalar multiplication over
+ *  random linear combinations of the individual verification equations. The
+ *  result is the same as calling secp256k1_schnorrsig_verify on each signature,
+ *  except with negligible probability.
+ *
+ *  Returns: 1: all signatures are correct (or n_sigs is 0)
+ *           0: at least one signature is incorrect
+ *  Args:    ctx: a secp256k1 context object.
+ *       scratch: scratch space used for the multi-scalar multiplication. If it
+ *                is NULL or too small, the points are multiplied one by one,
+ *                which is slower than individual verification.
+ *  Out: failed_index: if not NULL and 0 is returned, set to the index of the
+ *                     first incorrect signature. Locating it costs an individual
+ *                     verification per signature.
+ *  In:    sig64: array of n_sigs pointers to 64-byte signatures
+ *                (cannot be NULL if n_sigs > 0)
+ *           msg: array of n_sigs pointers to the messages being verified. An
+ *                entry can only be NULL if its msglen is 0.
+ *        msglen: array of n_sigs message lengths
+ *        pubkey: array of n_sigs pointers to x-only public keys
+ *        n_sigs: number of signatures
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorrsig_verify_batch(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space *scratch,
+    size_t *failed_index,
+    const unsigned char * const *sig64,
+    const unsigned char * const *msg,
+    const size_t *msglen,
+    const secp256k1_xonly_pubkey * const *pubkey,
+    size_t n_sigs
+) SECP256K1_ARG_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
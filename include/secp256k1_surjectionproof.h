@@ -52,7 +52,6 @@ typedef struct {
     unsigned char data[32 * (1 + SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS)];
 } secp256k1_surjectionproof;
 
-#ifndef USE_REDUCED_SURJECTION_PROOF_SIZE
 /** Parse a surjection proof
  *
  *  Returns: 1 when the proof could be parsed, 0 otherwise.
@@ -74,7 +73,6 @@ SECP256K1_API int secp256k1_surjectionproof_parse(
   const unsigned char *input,
   size_t inputlen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
-#endif
 
 /** Serialize a surjection proof
  *
@@ -173,6 +171,46 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_surjectionproof_initial
   const unsigned char *random_seed32
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(7);
 
+/** Surjection proof initialization over a range of iterations; decides on inputs to use
+ *  Like secp256k1_surjectionproof_initialize, but every iteration of random selection
+ *  draws from its own random stream, derived from the seed and the iteration index.
+ *  This allows splitting the iterations over several threads: if the iterations
+ *  [0, n_max_iterations) are divided into ranges and every range is searched with its own
+ *  call (and proof object), the successful call with the lowest return value produces the
+ *  same proof and input_index as a single call for [0, n_max_iterations). Calls for ranges
+ *  above a successful one can be skipped or abandoned.
+ *  The selection differs from secp256k1_surjectionproof_initialize for the same seed.
+ *
+ * Returns 0: inputs could not be selected in the given range
+ *         n: inputs were selected in iteration n - 1, i.e. after n iterations when
+ *            iteration_start is 0
+ *
+ * In:               ctx: pointer to a context object
+ *      fixed_input_tags: fixed input tags `A_i` for all inputs (see secp256k1_surjectionproof_initialize)
+ *          n_input_tags: the number of entries in the fixed_input_tags array
+ *   n_input_tags_to_use: the number of inputs to select randomly to put in the anonymity set
+ *                        Must be <= SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS
+ *      fixed_output_tag: fixed output tag
+ *       iteration_start: index of the first iteration to try
+ *          n_iterations: the number of iterations to try
+ *         random_seed32: a random seed to be used for input selection, the same for all ranges
+ * Out:            proof: The proof whose bitvector will be initialized. In case of failure,
+ *                        the state of the proof is undefined.
+ *          input_index: The index of the actual input that is secretly mapped to the output
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_surjectionproof_initialize_range(
+  const secp256k1_context* ctx,
+  secp256k1_surjectionproof* proof,
+  size_t *input_index,
+  const secp256k1_fixed_asset_tag* fixed_input_tags,
+  const size_t n_input_tags,
+  const size_t n_input_tags_to_use,
+  const secp256k1_fixed_asset_tag* fixed_output_tag,
+  const size_t iteration_start,
+  const size_t n_iterations,
+  const unsigned char *random_seed32
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(10);
+
 
 /** Surjection proof allocation and initialization function; decides on inputs to use
  * Returns 0: inputs could not be selected, or malloc failure
@@ -243,7 +281,6 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_surjectionproof_generat
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8);
 
 
-#ifndef USE_REDUCED_SURJECTION_PROOF_SIZE
 /** Surjection proof verification function
  * Returns 0: proof was invalid
  *         1: proof was valid
@@ -261,7 +298,36 @@ SECP256K1_API int secp256k1_surjectionproof_verify(
   size_t n_ephemeral_input_tags,
   const secp256k1_generator* ephemeral_output_tag
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5);
-#endif
+
+/** Verify many surjection proofs over the same input tags at once, e.g. all outputs of a transaction
+ * Returns 0: at least one proof was invalid, or other error
+ *         1: all proofs were valid
+ *
+ * Args:   ctx: pointer to a context object, initialized for signing and verification
+ *     scratch: scratch space used to hold the ring public keys. If NULL or too small to hold
+ *              even a single proof, the proofs are verified one after another instead.
+ * Out: failed_index: if not NULL and the batch fails, set to the index of the first invalid
+ *                    proof. Locating it costs an individual verification per proof.
+ * In:  proofs: array of n_proofs pointers to the proofs to be verified (cannot be NULL if n_proofs > 0)
+ *      ephemeral_input_tags: the ephemeral asset tag of all inputs, shared by all proofs
+ *    n_ephemeral_input_tags: the number of entries in the ephemeral_input_tags array
+ *     ephemeral_output_tags: array of n_proofs pointers to the ephemeral asset tag of each proof's output
+ *                  n_proofs: number of proofs
+ *
+ * The result is the same as calling secp256k1_surjectionproof_verify on every proof, but the input
+ * tags are loaded and hashed only once, and the Borromean signatures of all proofs are checked
+ * together, sharing the field inversions.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_surjectionproof_verify_batch(
+  const secp256k1_context* ctx,
+  secp256k1_scratch_space *scratch,
+  size_t *failed_index,
+  const secp256k1_surjectionproof * const *proofs,
+  const secp256k1_generator* ephemeral_input_tags,
+  size_t n_ephemeral_input_tags,
+  const secp256k1_generator * const *ephemeral_output_tags,
+  size_t n_proofs
+) SECP256K1_ARG_NONNULL(1);
 
 #ifdef __cplusplus
 }
@@ -21,7 +21,7 @@
 void help(char **argv) {
     printf("Benchmark EC multiplication algorithms\n");
     printf("\n");
-    printf("Usage: %s <help|pippenger_wnaf|strauss_wnaf|simple>\n", argv[0]);
+    printf("Usage: %s <help|pippenger_wnaf|pippenger_jacobian|pippenger_affine|strauss_wnaf|simple>\n", argv[0]);
     printf("The output shows the number of multiplied and summed points right after the\n");
     printf("function name. The letter 'g' indicates that one of the points is the generator.\n");
     printf("The benchmarks are divided by the number of points.\n");
@@ -29,10 +29,21 @@ void help(char **argv) {
     printf("default (ecmult_multi): picks pippenger_wnaf or strauss_wnaf depending on the\n");
     printf("                        batch size\n");
     printf("pippenger_wnaf:         for all batch sizes\n");
+    printf("pippenger_jacobian:     pippenger_wnaf with Jacobian buckets for all batch sizes\n");
+    printf("pippenger_affine:       pippenger_wnaf with affine buckets for all batch sizes\n");
+    printf("                        (compare with pippenger_jacobian to find the crossover)\n");
     printf("strauss_wnaf:           for all batch sizes\n");
     printf("simple:                 multiply and sum each point individually\n");
 }
 
+static int bench_pippenger_jacobian_batch_single(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n) {
+    return secp256k1_ecmult_pippenger_batch_buckets(error_callback, scratch, r, inp_g_sc, cb, cbdata, n, 0, 0);
+}
+
+static int bench_pippenger_affine_batch_single(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n) {
+    return secp256k1_ecmult_pippenger_batch_buckets(error_callback, scratch, r, inp_g_sc, cb, cbdata, n, 0, 1);
+}
+
 typedef struct {
     /* Setup once in advance */
     secp256k1_context* ctx;
@@ -296,6 +307,12 @@ int main(int argc, char **argv) {
         } else if(have_flag(argc, argv, "pippenger_wnaf")) {
             printf("Using pippenger_wnaf:\n");
             data.ecmult_multi = secp256k1_ecmult_pippenger_batch_single;
+        } else if(have_flag(argc, argv, "pippenger_jacobian")) {
+            printf("Using pippenger_wnaf with Jacobian buckets:\n");
+            data.ecmult_multi = bench_pippenger_jacobian_batch_single;
+        } else if(have_flag(argc, argv, "pippenger_affine")) {
+            printf("Using pippenger_wnaf with affine buckets:\n");
+            data.ecmult_multi = bench_pippenger_affine_batch_single;
         } else if(have_flag(argc, argv, "strauss_wnaf")) {
             printf("Using strauss_wnaf:\n");
             data.ecmult_multi = secp256k1_ecmult_strauss_batch_single;
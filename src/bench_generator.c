@@ -11,10 +11,14 @@
 #include "util.h"
 #include "bench.h"
 
+#define GENERATE_BATCH_SIZE 64
+
 typedef struct {
     secp256k1_context* ctx;
     unsigned char key[32];
     unsigned char blind[32];
+    unsigned char keys[GENERATE_BATCH_SIZE][32];
+    const unsigned char *key_ptrs[GENERATE_BATCH_SIZE];
 } bench_generator_t;
 
 static void bench_generator_setup(void* arg) {
@@ -23,6 +27,15 @@ static void bench_generator_setup(void* arg) {
     memset(data->blind, 0x13, 32);
 }
 
+static void bench_generator_batch_setup(void* arg) {
+    int i;
+    bench_generator_t *data = (bench_generator_t*)arg;
+    for (i = 0; i < GENERATE_BATCH_SIZE; i++) {
+        memset(data->keys[i], 0x31 + i, 32);
+        data->key_ptrs[i] = data->keys[i];
+    }
+}
+
 static void bench_generator_generate(void* arg, int iters) {
     int i;
     bench_generator_t *data = (bench_generator_t*)arg;
@@ -34,6 +47,18 @@ static void bench_generator_generate(void* arg, int iters) {
     }
 }
 
+static void bench_generator_generate_batch(void* arg, int iters) {
+    int i;
+    bench_generator_t *data = (bench_generator_t*)arg;
+    secp256k1_generator gens[GENERATE_BATCH_SIZE];
+
+    for (i = 0; i < iters; i += GENERATE_BATCH_SIZE) {
+        size_t n = iters - i < GENERATE_BATCH_SIZE ? iters - i : GENERATE_BATCH_SIZE;
+        CHECK(secp256k1_generator_generate_batch(data->ctx, gens, data->key_ptrs, n));
+        data->keys[0][i & 31]++;
+    }
+}
+
 static void bench_generator_generate_blinded(void* arg, int iters) {
     int i;
     bench_generator_t *data = (bench_generator_t*)arg;
@@ -53,6 +78,7 @@ int main(void) {
     data.ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
 
     run_benchmark("generator_generate", bench_generator_generate, bench_generator_setup, NULL, &data, 10, iters);
+    run_benchmark("generator_generate_batch", bench_generator_generate_batch, bench_generator_batch_setup, NULL, &data, 10, iters);
     run_benchmark("generator_generate_blinded", bench_generator_generate_blinded, bench_generator_setup, NULL, &data, 10, iters);
 
     secp256k1_context_destroy(data.ctx);
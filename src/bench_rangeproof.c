@@ -10,6 +10,10 @@
 #include "util.h"
 #include "bench.h"
 
+#define BATCH_SIZE 16
+#define COMMIT_BATCH_SIZE 64
+#define TALLY_SIZE 512
+
 typedef struct {
     secp256k1_context* ctx;
     secp256k1_pedersen_commitment commit;
@@ -18,6 +22,21 @@ typedef struct {
     size_t len;
     int min_bits;
     uint64_t v;
+    secp256k1_scratch_space *scratch;
+    const secp256k1_pedersen_commitment *commits[BATCH_SIZE];
+    const unsigned char *proofs[BATCH_SIZE];
+    size_t plens[BATCH_SIZE];
+    const secp256k1_generator *gens[BATCH_SIZE];
+    secp256k1_generator gen;
+    secp256k1_generator_table *gen_table;
+    secp256k1_pedersen_commitment commit_out[COMMIT_BATCH_SIZE];
+    unsigned char commit_blind[COMMIT_BATCH_SIZE][32];
+    const unsigned char *commit_blinds[COMMIT_BATCH_SIZE];
+    uint64_t commit_values[COMMIT_BATCH_SIZE];
+    const secp256k1_generator *commit_gens[COMMIT_BATCH_SIZE];
+    const secp256k1_pedersen_commitment *tally[TALLY_SIZE];
+    secp256k1_pedersen_commitment_expanded ecommit_out[COMMIT_BATCH_SIZE];
+    const secp256k1_pedersen_commitment_expanded *etally[TALLY_SIZE];
 } bench_rangeproof_t;
 
 static void bench_rangeproof_setup(void* arg) {
@@ -49,6 +68,154 @@ static void bench_rangeproof(void* arg, int iters) {
     }
 }
 
+static void bench_rangeproof_rewind_foreign(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    /* Rewind with a nonce the proof was not made with, like a wallet scanning outputs that are not its own. */
+    for (i = 0; i < iters; i++) {
+        unsigned char nonce[32] = {0};
+        uint64_t minv;
+        uint64_t maxv;
+        nonce[0] = i & 255;
+        nonce[1] = (i >> 8) & 255;
+        nonce[2] = (i >> 16) & 255;
+        CHECK(!secp256k1_rangeproof_rewind(data->ctx, NULL, NULL, NULL, NULL, nonce, &minv, &maxv, &data->commit, data->proof, data->len, NULL, 0, secp256k1_generator_h));
+    }
+}
+
+static void bench_pedersen_commit(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_pedersen_commit(data->ctx, &data->commit, data->blind, data->v + i, secp256k1_generator_h));
+        data->blind[0] = data->commit.data[1] & 0x7f;
+    }
+}
+
+static void bench_pedersen_commit_batch_setup(void* arg) {
+    int i;
+    unsigned char seed[32] = {1};
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    CHECK(secp256k1_generator_generate(data->ctx, &data->gen, seed));
+    for (i = 0; i < COMMIT_BATCH_SIZE; i++) {
+        memset(data->commit_blind[i], i + 1, 32);
+        data->commit_blinds[i] = data->commit_blind[i];
+        data->commit_values[i] = i;
+        data->commit_gens[i] = &data->gen;
+    }
+}
+
+static void bench_pedersen_commit_generator(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_pedersen_commit(data->ctx, &data->commit_out[i % COMMIT_BATCH_SIZE], data->commit_blinds[i % COMMIT_BATCH_SIZE], data->commit_values[i % COMMIT_BATCH_SIZE] + i, &data->gen));
+    }
+}
+
+static void bench_pedersen_commit_table_setup(void* arg) {
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    bench_pedersen_commit_batch_setup(arg);
+    data->gen_table = secp256k1_generator_table_create(data->ctx, &data->gen);
+    CHECK(data->gen_table != NULL);
+}
+
+static void bench_pedersen_commit_table_teardown(void* arg, int iters) {
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+    (void)iters;
+
+    secp256k1_generator_table_destroy(data->gen_table);
+    data->gen_table = NULL;
+}
+
+static void bench_pedersen_commit_table(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_pedersen_commit_with_table(data->ctx, &data->commit_out[i % COMMIT_BATCH_SIZE], data->commit_blinds[i % COMMIT_BATCH_SIZE], data->commit_values[i % COMMIT_BATCH_SIZE] + i, data->gen_table));
+    }
+}
+
+static void bench_pedersen_commit_batch(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters/COMMIT_BATCH_SIZE; i++) {
+        data->commit_values[0] = i;
+        CHECK(secp256k1_pedersen_commit_batch(data->ctx, data->scratch, data->commit_out, data->commit_blinds, data->commit_values, data->commit_gens, COMMIT_BATCH_SIZE));
+    }
+}
+
+static void bench_pedersen_verify_tally_setup(void* arg) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    bench_pedersen_commit_batch_setup(arg);
+    CHECK(secp256k1_pedersen_commit_batch(data->ctx, NULL, data->commit_out, data->commit_blinds, data->commit_values, data->commit_gens, COMMIT_BATCH_SIZE));
+    for (i = 0; i < COMMIT_BATCH_SIZE; i++) {
+        CHECK(secp256k1_pedersen_commitment_expand(data->ctx, &data->ecommit_out[i], &data->commit_out[i]));
+    }
+    for (i = 0; i < TALLY_SIZE; i++) {
+        data->tally[i] = &data->commit_out[i % COMMIT_BATCH_SIZE];
+        data->etally[i] = &data->ecommit_out[i % COMMIT_BATCH_SIZE];
+    }
+}
+
+static void bench_pedersen_verify_tally(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters/(2 * TALLY_SIZE); i++) {
+        CHECK(secp256k1_pedersen_verify_tally(data->ctx, data->tally, TALLY_SIZE, data->tally, TALLY_SIZE));
+    }
+}
+
+static void bench_pedersen_verify_tally_batch(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters/(2 * TALLY_SIZE); i++) {
+        CHECK(secp256k1_pedersen_verify_tally_batch(data->ctx, data->scratch, data->tally, TALLY_SIZE, data->tally, TALLY_SIZE));
+    }
+}
+
+static void bench_pedersen_verify_tally_expanded(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters/(2 * TALLY_SIZE); i++) {
+        CHECK(secp256k1_pedersen_verify_tally_expanded(data->ctx, data->scratch, data->etally, TALLY_SIZE, data->etally, TALLY_SIZE));
+    }
+}
+
+static void bench_rangeproof_batch_setup(void* arg) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    bench_rangeproof_setup(arg);
+    for (i = 0; i < BATCH_SIZE; i++) {
+        data->commits[i] = &data->commit;
+        data->proofs[i] = data->proof;
+        data->plens[i] = data->len;
+        data->gens[i] = secp256k1_generator_h;
+    }
+}
+
+static void bench_rangeproof_batch(void* arg, int iters) {
+    int i;
+    bench_rangeproof_t *data = (bench_rangeproof_t*)arg;
+
+    for (i = 0; i < iters/(data->min_bits * BATCH_SIZE); i++) {
+        CHECK(secp256k1_rangeproof_verify_batch(data->ctx, data->scratch, NULL, NULL, NULL, data->commits, data->proofs, data->plens, NULL, NULL, data->gens, BATCH_SIZE));
+    }
+}
+
 int main(void) {
     bench_rangeproof_t data;
     int iters;
@@ -58,7 +225,24 @@ int main(void) {
     data.min_bits = 32;
     iters = data.min_bits*get_iters(32);
 
+    run_benchmark("pedersen_commit", bench_pedersen_commit, bench_rangeproof_setup, NULL, &data, 10, get_iters(20000));
+
     run_benchmark("rangeproof_verify_bit", bench_rangeproof, bench_rangeproof_setup, NULL, &data, 10, iters);
+    run_benchmark("rangeproof_rewind_foreign", bench_rangeproof_rewind_foreign, bench_rangeproof_setup, NULL, &data, 10, get_iters(1000));
+
+    data.scratch = secp256k1_scratch_space_create(data.ctx, 1024 * 1024);
+    run_benchmark("pedersen_commit_generator", bench_pedersen_commit_generator, bench_pedersen_commit_batch_setup, NULL, &data, 10, get_iters(20000));
+    run_benchmark("pedersen_commit_table", bench_pedersen_commit_table, bench_pedersen_commit_table_setup, bench_pedersen_commit_table_teardown, &data, 10, get_iters(20000));
+    iters = COMMIT_BATCH_SIZE*(get_iters(20000)/COMMIT_BATCH_SIZE + 1);
+    run_benchmark("pedersen_commit_batch", bench_pedersen_commit_batch, bench_pedersen_commit_batch_setup, NULL, &data, 10, iters);
+    iters = 2*TALLY_SIZE*(get_iters(20000)/(2*TALLY_SIZE) + 1);
+    run_benchmark("pedersen_verify_tally", bench_pedersen_verify_tally, bench_pedersen_verify_tally_setup, NULL, &data, 10, iters);
+    run_benchmark("pedersen_verify_tally_batch", bench_pedersen_verify_tally_batch, bench_pedersen_verify_tally_setup, NULL, &data, 10, iters);
+    run_benchmark("pedersen_verify_tally_expanded", bench_pedersen_verify_tally_expanded, bench_pedersen_verify_tally_setup, NULL, &data, 10, iters);
+
+    iters = data.min_bits*BATCH_SIZE*(get_iters(32)/BATCH_SIZE + 1);
+    run_benchmark("rangeproof_verify_batch_bit", bench_rangeproof_batch, bench_rangeproof_batch_setup, NULL, &data, 10, iters);
+    secp256k1_scratch_space_destroy(data.ctx, data.scratch);
 
     secp256k1_context_destroy(data.ctx);
     return 0;
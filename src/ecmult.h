@@ -32,6 +32,13 @@
 /** Double multiply: R = na*A + ng*G */
 static void secp256k1_ecmult(secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng);
 
+/** The maximum number of points secp256k1_ecmult_multi_small accepts. */
+#define ECMULT_MULTI_SMALL_MAX_POINTS 2
+
+/** Multi-multiply without scratch space: R = sum_i na[i]*A[i] + ng*G for
+ *  num <= ECMULT_MULTI_SMALL_MAX_POINTS points, in a single Strauss evaluation. */
+static void secp256k1_ecmult_multi_small(secp256k1_gej *r, size_t num, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng);
+
 typedef int (secp256k1_ecmult_multi_callback)(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data);
 
 /**
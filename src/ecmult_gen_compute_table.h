@@ -11,4 +11,7 @@
 
 static void secp256k1_ecmult_gen_compute_table(secp256k1_ge_storage* table, const secp256k1_ge* gen, int bits);
 
+/** Like secp256k1_ecmult_gen_compute_table, but for scalars of only n*bits bits. */
+static void secp256k1_ecmult_gen_compute_table_n(secp256k1_ge_storage* table, const secp256k1_ge* gen, int bits, int n);
+
 #endif /* SECP256K1_ECMULT_GEN_COMPUTE_TABLE_H */
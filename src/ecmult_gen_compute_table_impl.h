@@ -13,9 +13,8 @@
 #include "ecmult_gen.h"
 #include "util.h"
 
-static void secp256k1_ecmult_gen_compute_table(secp256k1_ge_storage* table, const secp256k1_ge* gen, int bits) {
+static void secp256k1_ecmult_gen_compute_table_n(secp256k1_ge_storage* table, const secp256k1_ge* gen, int bits, int n) {
     int g = ECMULT_GEN_PREC_G(bits);
-    int n = ECMULT_GEN_PREC_N(bits);
 
     secp256k1_ge* prec = checked_malloc(&default_error_callback, n * g * sizeof(*prec));
     secp256k1_gej gj;
@@ -78,4 +77,8 @@ static void secp256k1_ecmult_gen_compute_table(secp256k1_ge_storage* table, cons
     free(prec);
 }
 
+static void secp256k1_ecmult_gen_compute_table(secp256k1_ge_storage* table, const secp256k1_ge* gen, int bits) {
+    secp256k1_ecmult_gen_compute_table_n(table, gen, bits, ECMULT_GEN_PREC_N(bits));
+}
+
 #endif /* SECP256K1_ECMULT_GEN_COMPUTE_TABLE_IMPL_H */
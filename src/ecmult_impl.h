@@ -46,13 +46,21 @@
 #define WNAF_SIZE(w) WNAF_SIZE_BITS(WNAF_BITS, w)
 
 /* The number of objects allocated on the scratch space for ecmult_multi algorithms */
-#define PIPPENGER_SCRATCH_OBJECTS 6
+#define PIPPENGER_SCRATCH_OBJECTS 8
 #define STRAUSS_SCRATCH_OBJECTS 7
 
 #define PIPPENGER_MAX_BUCKET_WINDOW 12
 
+/* Minimum bucket_window for which pippenger_wnaf keeps its buckets in affine
+ * coordinates (see secp256k1_ecmult_pippenger_wnaf_affine). Use
+ * `bench_ecmult pippenger_jacobian` and `bench_ecmult pippenger_affine` to
+ * find the crossover. */
+#ifndef PIPPENGER_AFFINE_MIN_BUCKET_WINDOW
+#  define PIPPENGER_AFFINE_MIN_BUCKET_WINDOW 4
+#endif
+
 /* Minimum number of points for which pippenger_wnaf is faster than strauss wnaf */
-#define ECMULT_PIPPENGER_THRESHOLD 88
+#define ECMULT_PIPPENGER_THRESHOLD 32
 
 #define ECMULT_MAX_POINTS_PER_BATCH 5000000
 
@@ -329,6 +337,23 @@ static void secp256k1_ecmult(secp256k1_gej *r, const secp256k1_gej *a, const sec
     secp256k1_ecmult_strauss_wnaf(&state, r, 1, a, na, ng);
 }
 
+static void secp256k1_ecmult_multi_small(secp256k1_gej *r, size_t num, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+    secp256k1_gej prej[ECMULT_MULTI_SMALL_MAX_POINTS * ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_fe zr[ECMULT_MULTI_SMALL_MAX_POINTS * ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_ge pre_a[ECMULT_MULTI_SMALL_MAX_POINTS * ECMULT_TABLE_SIZE(WINDOW_A)];
+    struct secp256k1_strauss_point_state ps[ECMULT_MULTI_SMALL_MAX_POINTS];
+    secp256k1_ge pre_a_lam[ECMULT_MULTI_SMALL_MAX_POINTS * ECMULT_TABLE_SIZE(WINDOW_A)];
+    struct secp256k1_strauss_state state;
+    VERIFY_CHECK(num <= ECMULT_MULTI_SMALL_MAX_POINTS);
+
+    state.prej = prej;
+    state.zr = zr;
+    state.pre_a = pre_a;
+    state.pre_a_lam = pre_a_lam;
+    state.ps = ps;
+    secp256k1_ecmult_strauss_wnaf(&state, r, num, a, na, ng);
+}
+
 static size_t secp256k1_strauss_scratch_size(size_t n_points) {
     static const size_t point_size = (2 * sizeof(secp256k1_ge) + sizeof(secp256k1_gej) + sizeof(secp256k1_fe)) * ECMULT_TABLE_SIZE(WINDOW_A) + sizeof(struct secp256k1_strauss_point_state) + sizeof(secp256k1_gej) + sizeof(secp256k1_scalar);
     return n_points*point_size;
@@ -547,6 +572,229 @@ static int secp256k1_ecmult_pippenger_wnaf(secp256k1_gej *buckets, int bucket_wi
     return 1;
 }
 
+struct secp256k1_pippenger_affine_state {
+    /* Points sorted by bucket, one entry per point */
+    secp256k1_ge *pts;
+    /* Denominators and their prefix products, one entry per point */
+    secp256k1_fe *fe;
+    /* Start and number of points of every bucket in pts */
+    size_t *bucket_start;
+    size_t *bucket_count;
+};
+
+/* Reduces every bucket in aff->pts to at most a single point. In every round
+ * the points of each bucket are added pairwise in affine coordinates, sharing
+ * a single field inversion among all additions of the round. Requires all
+ * input coordinates to have magnitude 1. */
+static void secp256k1_ecmult_pippenger_affine_reduce(struct secp256k1_pippenger_affine_state *aff, size_t n_buckets) {
+    secp256k1_ge *pts = aff->pts;
+    size_t b, k, n_pairs;
+
+    for (;;) {
+        secp256k1_fe *den = aff->fe;
+        secp256k1_fe *prod;
+        secp256k1_fe inv;
+
+        n_pairs = 0;
+        for (b = 0; b < n_buckets; b++) {
+            n_pairs += aff->bucket_count[b] / 2;
+        }
+        if (n_pairs == 0) {
+            break;
+        }
+        prod = &aff->fe[n_pairs];
+
+        /* Compute the denominators of all slopes and their prefix products. */
+        k = 0;
+        for (b = 0; b < n_buckets; b++) {
+            const secp256k1_ge *a = &pts[aff->bucket_start[b]];
+            size_t p;
+            for (p = 0; p < aff->bucket_count[b] / 2; p++, a += 2, k++) {
+                if (!secp256k1_fe_equal_var(&a[0].x, &a[1].x)) {
+                    secp256k1_fe_negate(&den[k], &a[0].x, 1);
+                    secp256k1_fe_add(&den[k], &a[1].x);
+                } else if (secp256k1_fe_equal_var(&a[0].y, &a[1].y)) {
+                    /* Doubling */
+                    den[k] = a[0].y;
+                    secp256k1_fe_mul_int(&den[k], 2);
+                } else {
+                    /* The points cancel; no inversion needed */
+                    secp256k1_fe_set_int(&den[k], 1);
+                }
+                if (k == 0) {
+                    prod[k] = den[k];
+                } else {
+                    secp256k1_fe_mul(&prod[k], &prod[k - 1], &den[k]);
+                }
+            }
+        }
+
+        /* Replace every denominator by its inverse. */
+        secp256k1_fe_inv_var(&inv, &prod[n_pairs - 1]);
+        for (k = n_pairs - 1; k > 0; k--) {
+            secp256k1_fe tmp;
+            secp256k1_fe_mul(&tmp, &inv, &prod[k - 1]);
+            secp256k1_fe_mul(&inv, &inv, &den[k]);
+            den[k] = tmp;
+        }
+        den[0] = inv;
+
+        /* Add the pairs and compact the sums to the front of each bucket. */
+        k = 0;
+        for (b = 0; b < n_buckets; b++) {
+            secp256k1_ge *bucket = &pts[aff->bucket_start[b]];
+            size_t count = aff->bucket_count[b];
+            size_t m = 0;
+            size_t p;
+            for (p = 0; p < count / 2; p++, k++) {
+                const secp256k1_ge *a = &bucket[2*p];
+                secp256k1_fe lambda, x3, y3;
+                if (!secp256k1_fe_equal_var(&a[0].x, &a[1].x)) {
+                    secp256k1_fe_negate(&lambda, &a[0].y, 1);
+                    secp256k1_fe_add(&lambda, &a[1].y);
+                } else if (secp256k1_fe_equal_var(&a[0].y, &a[1].y)) {
+                    secp256k1_fe_sqr(&lambda, &a[0].x);
+                    secp256k1_fe_mul_int(&lambda, 3);
+                } else {
+                    continue;
+                }
+                secp256k1_fe_mul(&lambda, &lambda, &den[k]);
+                /* x3 = lambda^2 - x1 - x2, y3 = lambda*(x1 - x3) - y1 */
+                secp256k1_fe_sqr(&x3, &lambda);
+                secp256k1_fe_negate(&y3, &a[0].x, 1);
+                secp256k1_fe_add(&x3, &y3);
+                secp256k1_fe_negate(&y3, &a[1].x, 1);
+                secp256k1_fe_add(&x3, &y3);
+                secp256k1_fe_normalize_weak(&x3);
+                secp256k1_fe_negate(&y3, &x3, 1);
+                secp256k1_fe_add(&y3, &a[0].x);
+                secp256k1_fe_mul(&y3, &y3, &lambda);
+                secp256k1_fe_negate(&lambda, &a[0].y, 1);
+                secp256k1_fe_add(&y3, &lambda);
+                secp256k1_fe_normalize_weak(&y3);
+                secp256k1_ge_set_xy(&bucket[m], &x3, &y3);
+                m++;
+            }
+            if (count & 1) {
+                bucket[m] = bucket[count - 1];
+                m++;
+            }
+            aff->bucket_count[b] = m;
+        }
+    }
+}
+
+/*
+ * Same as pippenger_wnaf but keeps the buckets in affine coordinates. For every
+ * window the points are first sorted into their buckets and each bucket is then
+ * summed with batched affine additions, which take roughly half the field
+ * multiplications of gej_add_ge_var when there are enough points per bucket.
+ * The skew corrections are only needed in the last window and are accumulated
+ * in Jacobian coordinates. Requires all input coordinates to have magnitude 1.
+ */
+static int secp256k1_ecmult_pippenger_wnaf_affine(struct secp256k1_pippenger_affine_state *aff, int bucket_window, struct secp256k1_pippenger_state *state, secp256k1_gej *r, const secp256k1_scalar *sc, const secp256k1_ge *pt, size_t num) {
+    size_t n_wnaf = WNAF_SIZE(bucket_window+1);
+    size_t n_buckets = ECMULT_TABLE_SIZE(bucket_window+2);
+    size_t np;
+    size_t no = 0;
+    size_t j;
+    int i;
+
+    for (np = 0; np < num; ++np) {
+        if (secp256k1_scalar_is_zero(&sc[np]) || secp256k1_ge_is_infinity(&pt[np])) {
+            continue;
+        }
+        state->ps[no].input_pos = np;
+        state->ps[no].skew_na = secp256k1_wnaf_fixed(&state->wnaf_na[no*n_wnaf], &sc[np], bucket_window+1);
+        no++;
+    }
+    secp256k1_gej_set_infinity(r);
+
+    if (no == 0) {
+        return 1;
+    }
+
+    for (i = n_wnaf - 1; i >= 0; i--) {
+        secp256k1_gej running_sum;
+        secp256k1_gej skew_sum;
+        size_t start = 0;
+
+        for (j = 0; j < n_buckets; j++) {
+            aff->bucket_count[j] = 0;
+        }
+        for (np = 0; np < no; ++np) {
+            int n = state->wnaf_na[np*n_wnaf + i];
+            if (n != 0) {
+                aff->bucket_count[n > 0 ? (n - 1)/2 : -(n + 1)/2]++;
+            }
+        }
+        for (j = 0; j < n_buckets; j++) {
+            aff->bucket_start[j] = start;
+            start += aff->bucket_count[j];
+            aff->bucket_count[j] = 0;
+        }
+
+        secp256k1_gej_set_infinity(&skew_sum);
+        for (np = 0; np < no; ++np) {
+            int n = state->wnaf_na[np*n_wnaf + i];
+            struct secp256k1_pippenger_point_state point_state = state->ps[np];
+            secp256k1_ge *dst;
+            int idx;
+
+            if (i == 0 && point_state.skew_na) {
+                /* correct for wnaf skew */
+                secp256k1_ge tmp;
+                secp256k1_ge_neg(&tmp, &pt[point_state.input_pos]);
+                secp256k1_gej_add_ge_var(&skew_sum, &skew_sum, &tmp, NULL);
+            }
+            if (n > 0) {
+                idx = (n - 1)/2;
+                dst = &aff->pts[aff->bucket_start[idx] + aff->bucket_count[idx]++];
+                *dst = pt[point_state.input_pos];
+            } else if (n < 0) {
+                idx = -(n + 1)/2;
+                dst = &aff->pts[aff->bucket_start[idx] + aff->bucket_count[idx]++];
+                secp256k1_ge_neg(dst, &pt[point_state.input_pos]);
+                secp256k1_fe_normalize_weak(&dst->y);
+            }
+        }
+
+        secp256k1_ecmult_pippenger_affine_reduce(aff, n_buckets);
+
+        for(j = 0; j < (size_t)bucket_window; j++) {
+            secp256k1_gej_double_var(r, r, NULL);
+        }
+
+        /* Accumulate the buckets like pippenger_wnaf, adding the remaining
+         * affine point of every bucket to the running sum. */
+        secp256k1_gej_set_infinity(&running_sum);
+        for(j = n_buckets - 1; j > 0; j--) {
+            if (aff->bucket_count[j] != 0) {
+                secp256k1_gej_add_ge_var(&running_sum, &running_sum, &aff->pts[aff->bucket_start[j]], NULL);
+            }
+            secp256k1_gej_add_var(r, r, &running_sum, NULL);
+        }
+
+        if (aff->bucket_count[0] != 0) {
+            secp256k1_gej_add_ge_var(&running_sum, &running_sum, &aff->pts[aff->bucket_start[0]], NULL);
+        }
+        secp256k1_gej_add_var(&running_sum, &running_sum, &skew_sum, NULL);
+        secp256k1_gej_double_var(r, r, NULL);
+        secp256k1_gej_add_var(r, r, &running_sum, NULL);
+    }
+    return 1;
+}
+
+/**
+ * Returns whether pippenger_wnaf should keep its buckets in affine
+ * coordinates for a given bucket_window. Affine buckets only pay off once
+ * every bucket receives enough points per window to amortize the batched
+ * inversions.
+ */
+static int secp256k1_pippenger_affine_buckets(int bucket_window) {
+    return bucket_window >= PIPPENGER_AFFINE_MIN_BUCKET_WINDOW;
+}
+
 /**
  * Returns optimal bucket_window (number of bits of a scalar represented by a
  * set of buckets) for a given number of points.
@@ -618,13 +866,30 @@ SECP256K1_INLINE static void secp256k1_ecmult_endo_split(secp256k1_scalar *s1, s
  * Returns the scratch size required for a given number of points (excluding
  * base point G) without considering alignment.
  */
+static size_t secp256k1_pippenger_entry_size(int bucket_window) {
+    size_t entry_size = sizeof(secp256k1_ge) + sizeof(secp256k1_scalar) + sizeof(struct secp256k1_pippenger_point_state) + (WNAF_SIZE(bucket_window+1)+1)*sizeof(int);
+    if (secp256k1_pippenger_affine_buckets(bucket_window)) {
+        entry_size += sizeof(secp256k1_ge) + sizeof(secp256k1_fe);
+    }
+    return entry_size;
+}
+
+static size_t secp256k1_pippenger_bucket_size(int bucket_window) {
+    if (secp256k1_pippenger_affine_buckets(bucket_window)) {
+        return (2*sizeof(size_t)) << bucket_window;
+    }
+    return sizeof(secp256k1_gej) << bucket_window;
+}
+
 static size_t secp256k1_pippenger_scratch_size(size_t n_points, int bucket_window) {
     size_t entries = 2*n_points + 2;
-    size_t entry_size = sizeof(secp256k1_ge) + sizeof(secp256k1_scalar) + sizeof(struct secp256k1_pippenger_point_state) + (WNAF_SIZE(bucket_window+1)+1)*sizeof(int);
-    return (sizeof(secp256k1_gej) << bucket_window) + sizeof(struct secp256k1_pippenger_state) + entries * entry_size;
+    return secp256k1_pippenger_bucket_size(bucket_window) + sizeof(struct secp256k1_pippenger_state) + entries * secp256k1_pippenger_entry_size(bucket_window);
 }
 
-static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points, size_t cb_offset) {
+/* Computes a single batch with Pippenger's algorithm using Jacobian (affine = 0)
+ * or affine (affine = 1) buckets. The scratch space must have room for
+ * secp256k1_pippenger_scratch_size of the chosen bucket type. */
+static int secp256k1_ecmult_pippenger_batch_buckets(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points, size_t cb_offset, int affine) {
     const size_t scratch_checkpoint = secp256k1_scratch_checkpoint(error_callback, scratch);
     /* Use 2(n+1) with the endomorphism, when calculating batch
      * sizes. The reason for +1 is that we add the G scalar to the list of
@@ -632,7 +897,8 @@ static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_call
     size_t entries = 2*n_points + 2;
     secp256k1_ge *points;
     secp256k1_scalar *scalars;
-    secp256k1_gej *buckets;
+    secp256k1_gej *buckets = NULL;
+    struct secp256k1_pippenger_affine_state aff;
     struct secp256k1_pippenger_state *state_space;
     size_t idx = 0;
     size_t point_idx = 0;
@@ -658,8 +924,15 @@ static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_call
     }
     state_space->ps = (struct secp256k1_pippenger_point_state *) secp256k1_scratch_alloc(error_callback, scratch, entries * sizeof(*state_space->ps));
     state_space->wnaf_na = (int *) secp256k1_scratch_alloc(error_callback, scratch, entries*(WNAF_SIZE(bucket_window+1)) * sizeof(int));
-    buckets = (secp256k1_gej *) secp256k1_scratch_alloc(error_callback, scratch, (1<<bucket_window) * sizeof(*buckets));
-    if (state_space->ps == NULL || state_space->wnaf_na == NULL || buckets == NULL) {
+    if (affine) {
+        aff.pts = (secp256k1_ge *) secp256k1_scratch_alloc(error_callback, scratch, entries * sizeof(*aff.pts));
+        aff.fe = (secp256k1_fe *) secp256k1_scratch_alloc(error_callback, scratch, entries * sizeof(*aff.fe));
+        aff.bucket_start = (size_t *) secp256k1_scratch_alloc(error_callback, scratch, (2<<bucket_window) * sizeof(*aff.bucket_start));
+        aff.bucket_count = aff.bucket_start == NULL ? NULL : &aff.bucket_start[1<<bucket_window];
+    } else {
+        buckets = (secp256k1_gej *) secp256k1_scratch_alloc(error_callback, scratch, (1<<bucket_window) * sizeof(*buckets));
+    }
+    if (state_space->ps == NULL || state_space->wnaf_na == NULL || (affine ? (aff.pts == NULL || aff.fe == NULL || aff.bucket_start == NULL) : buckets == NULL)) {
         secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
         return 0;
     }
@@ -683,7 +956,15 @@ static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_call
         point_idx++;
     }
 
-    secp256k1_ecmult_pippenger_wnaf(buckets, bucket_window, state_space, r, scalars, points, idx);
+    if (affine) {
+        for (i = 0; (size_t)i < idx; i++) {
+            secp256k1_fe_normalize_weak(&points[i].x);
+            secp256k1_fe_normalize_weak(&points[i].y);
+        }
+        secp256k1_ecmult_pippenger_wnaf_affine(&aff, bucket_window, state_space, r, scalars, points, idx);
+    } else {
+        secp256k1_ecmult_pippenger_wnaf(buckets, bucket_window, state_space, r, scalars, points, idx);
+    }
 
     /* Clear data */
     for(i = 0; (size_t)i < idx; i++) {
@@ -693,13 +974,20 @@ static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_call
             state_space->wnaf_na[i * WNAF_SIZE(bucket_window+1) + j] = 0;
         }
     }
-    for(i = 0; i < 1<<bucket_window; i++) {
-        secp256k1_gej_clear(&buckets[i]);
+    if (!affine) {
+        for(i = 0; i < 1<<bucket_window; i++) {
+            secp256k1_gej_clear(&buckets[i]);
+        }
     }
     secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
     return 1;
 }
 
+static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points, size_t cb_offset) {
+    int affine = secp256k1_pippenger_affine_buckets(secp256k1_pippenger_bucket_window(n_points));
+    return secp256k1_ecmult_pippenger_batch_buckets(error_callback, scratch, r, inp_g_sc, cb, cbdata, n_points, cb_offset, affine);
+}
+
 /* Wrapper for secp256k1_ecmult_multi_func interface */
 static int secp256k1_ecmult_pippenger_batch_single(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n) {
     return secp256k1_ecmult_pippenger_batch(error_callback, scratch, r, inp_g_sc, cb, cbdata, n, 0);
@@ -720,10 +1008,9 @@ static size_t secp256k1_pippenger_max_points(const secp256k1_callback* error_cal
         size_t max_points = secp256k1_pippenger_bucket_window_inv(bucket_window);
         size_t space_for_points;
         size_t space_overhead;
-        size_t entry_size = sizeof(secp256k1_ge) + sizeof(secp256k1_scalar) + sizeof(struct secp256k1_pippenger_point_state) + (WNAF_SIZE(bucket_window+1)+1)*sizeof(int);
+        size_t entry_size = 2*secp256k1_pippenger_entry_size(bucket_window);
 
-        entry_size = 2*entry_size;
-        space_overhead = (sizeof(secp256k1_gej) << bucket_window) + entry_size + sizeof(struct secp256k1_pippenger_state);
+        space_overhead = secp256k1_pippenger_bucket_size(bucket_window) + entry_size + sizeof(struct secp256k1_pippenger_state);
         if (space_overhead > max_alloc) {
             break;
         }
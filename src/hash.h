@@ -20,6 +20,12 @@ static void secp256k1_sha256_initialize(secp256k1_sha256 *hash);
 static void secp256k1_sha256_write(secp256k1_sha256 *hash, const unsigned char *data, size_t size);
 static void secp256k1_sha256_finalize(secp256k1_sha256 *hash, unsigned char *out32);
 
+/** Compute n hashes of equal-length messages that share a common prefix: the
+ *  32 bytes at out32 + 32*i are set to the hash of the data written to base,
+ *  followed by the len bytes at data[i]. base is not modified. Where
+ *  available, the messages are hashed side by side with SIMD instructions. */
+static void secp256k1_sha256_finalize_multi(unsigned char *out32, const secp256k1_sha256 *base, const unsigned char * const *data, size_t len, size_t n);
+
 typedef struct {
     secp256k1_sha256 inner, outer;
 } secp256k1_hmac_sha256;
@@ -0,0 +1,81 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#ifndef SECP256K1_HASH_ARM_SHA2_IMPL_H
+#define SECP256K1_HASH_ARM_SHA2_IMPL_H
+
+/* SHA-256 transform using the ARMv8 cryptography extensions. The transform is
+ * compiled for the extension via a target attribute, so it must only be called
+ * after secp256k1_sha256_arm_sha2_available has returned 1. It is only built
+ * with --enable-sha256-accel-arm.
+ * The round constants secp256k1_sha256_k are defined in hash_impl.h. */
+
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+
+#include "util.h"
+
+/* GCC takes an extension to add to the target, clang a feature name. */
+#if defined(__clang__)
+#  define SECP256K1_ARM_SHA2_TARGET __attribute__((target("crypto")))
+#else
+#  define SECP256K1_ARM_SHA2_TARGET __attribute__((target("+crypto")))
+#endif
+
+static int secp256k1_sha256_arm_sha2_available(void) {
+    return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+}
+
+/* Perform four rounds using message words m (w[4i..4i+3]). */
+#define SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m, i) do { \
+    uint32x4_t msg_ = vaddq_u32((m), vld1q_u32(&secp256k1_sha256_k[4*(i)])); \
+    uint32x4_t t_ = (s0); \
+    (s0) = vsha256hq_u32((s0), (s1), msg_); \
+    (s1) = vsha256h2q_u32((s1), t_, msg_); \
+} while(0)
+
+/* Replace m0 with the message words following m3, given the preceding m1 and m2. */
+#define SECP256K1_ARM_SHA2_SCHEDULE(m0, m1, m2, m3) do { \
+    (m0) = vsha256su1q_u32(vsha256su0q_u32((m0), (m1)), (m2), (m3)); \
+} while(0)
+
+SECP256K1_ARM_SHA2_TARGET
+static void secp256k1_sha256_transform_arm_sha2(uint32_t* s, const uint32_t* chunk) {
+    const uint8_t *in = (const uint8_t *)chunk;
+    uint32x4_t s0, s1, so0, so1, m0, m1, m2, m3;
+    int i;
+
+    s0 = so0 = vld1q_u32(&s[0]);
+    s1 = so1 = vld1q_u32(&s[4]);
+
+    m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(in + 0)));
+    m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(in + 16)));
+    m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(in + 32)));
+    m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(in + 48)));
+
+    for (i = 0; i < 12; i += 4) {
+        SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m0, i);
+        SECP256K1_ARM_SHA2_SCHEDULE(m0, m1, m2, m3);
+        SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m1, i + 1);
+        SECP256K1_ARM_SHA2_SCHEDULE(m1, m2, m3, m0);
+        SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m2, i + 2);
+        SECP256K1_ARM_SHA2_SCHEDULE(m2, m3, m0, m1);
+        SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m3, i + 3);
+        SECP256K1_ARM_SHA2_SCHEDULE(m3, m0, m1, m2);
+    }
+    SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m0, 12);
+    SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m1, 13);
+    SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m2, 14);
+    SECP256K1_ARM_SHA2_QUADROUND(s0, s1, m3, 15);
+
+    vst1q_u32(&s[0], vaddq_u32(s0, so0));
+    vst1q_u32(&s[4], vaddq_u32(s1, so1));
+}
+
+#undef SECP256K1_ARM_SHA2_QUADROUND
+#undef SECP256K1_ARM_SHA2_SCHEDULE
+
+#endif /* SECP256K1_HASH_ARM_SHA2_IMPL_H */
@@ -14,6 +14,37 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(USE_SHA256_ACCEL) && defined(__GNUC__) && (SECP256K1_GNUC_PREREQ(5,0) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__) || (defined(USE_SHA256_ACCEL_ARM) && defined(__aarch64__) && defined(__linux__)))
+/* Round constants, shared by the hardware-accelerated implementations. */
+static const uint32_t secp256k1_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+# if defined(__x86_64__) || defined(__i386__)
+#  if defined(HAVE_BUILTIN_CPU_SUPPORTS_SHA)
+#   define SECP256K1_SHA256_X86_SHANI 1
+#   include "hash_x86_shani_impl.h"
+#  endif
+#  define SECP256K1_SHA256_X86_AVX2 1
+#  include "hash_x86_avx2_impl.h"
+/* Minimum number of messages for which the AVX2 lanes are used. Below this,
+ * hashing the messages one at a time is faster. */
+#  ifndef SECP256K1_SHA256_MULTI_MIN_LANES
+#   define SECP256K1_SHA256_MULTI_MIN_LANES 3
+#  endif
+# else
+#  define SECP256K1_SHA256_ARM_SHA2 1
+#  include "hash_arm_sha2_impl.h"
+# endif
+#endif
+
 #define Ch(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
 #define Maj(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define Sigma0(x) (((x) >> 2 | (x) << 30) ^ ((x) >> 13 | (x) << 19) ^ ((x) >> 22 | (x) << 10))
@@ -47,7 +78,7 @@ static void secp256k1_sha256_initialize(secp256k1_sha256 *hash) {
 }
 
 /** Perform one SHA-256 transformation, processing 16 big endian 32-bit words. */
-static void secp256k1_sha256_transform(uint32_t* s, const uint32_t* chunk) {
+static void secp256k1_sha256_transform_portable(uint32_t* s, const uint32_t* chunk) {
     uint32_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
     uint32_t w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
 
@@ -129,6 +160,37 @@ static void secp256k1_sha256_transform(uint32_t* s, const uint32_t* chunk) {
     s[7] += h;
 }
 
+#if defined(SECP256K1_SHA256_X86_SHANI) || defined(SECP256K1_SHA256_ARM_SHA2)
+/** Returns whether the hardware SHA-256 transform is usable on this CPU. The
+ * check is made on every call, so no detection state is kept: on x86 the
+ * backends use __builtin_cpu_supports, which reads the CPU features that the
+ * compiler runtime detected at load time and, unlike cpuid, is cheap enough
+ * to call for every transform. */
+static int secp256k1_sha256_accel_available(void) {
+#if defined(SECP256K1_SHA256_X86_SHANI)
+    return secp256k1_sha256_shani_available();
+#else
+    return secp256k1_sha256_arm_sha2_available();
+#endif
+}
+#endif
+
+/** Perform one SHA-256 transformation, using hardware instructions if available. */
+static void secp256k1_sha256_transform(uint32_t* s, const uint32_t* chunk) {
+#if defined(SECP256K1_SHA256_X86_SHANI)
+    if (secp256k1_sha256_accel_available()) {
+        secp256k1_sha256_transform_shani(s, chunk);
+        return;
+    }
+#elif defined(SECP256K1_SHA256_ARM_SHA2)
+    if (secp256k1_sha256_accel_available()) {
+        secp256k1_sha256_transform_arm_sha2(s, chunk);
+        return;
+    }
+#endif
+    secp256k1_sha256_transform_portable(s, chunk);
+}
+
 static void secp256k1_sha256_write(secp256k1_sha256 *hash, const unsigned char *data, size_t len) {
     size_t bufsize = hash->bytes & 0x3F;
     hash->bytes += len;
@@ -164,6 +226,99 @@ static void secp256k1_sha256_finalize(secp256k1_sha256 *hash, unsigned char *out
     memcpy(out32, (const unsigned char*)out, 32);
 }
 
+#if defined(SECP256K1_SHA256_X86_AVX2)
+/* Fill blk with bytes [offset, offset + 64) of the padded message consisting of
+ * the prefix_len bytes at prefix, the len bytes at data, the padding and the 8
+ * byte length sizedesc, which is total_len bytes long. */
+static void secp256k1_sha256_multi_fill(unsigned char *blk, size_t offset, const unsigned char *prefix, size_t prefix_len,
+ const unsigned char *data, size_t len, const unsigned char *sizedesc, size_t total_len) {
+    size_t lo, hi;
+    memset(blk, 0, 64);
+    if (offset < prefix_len) {
+        hi = prefix_len < offset + 64 ? prefix_len : offset + 64;
+        memcpy(blk, prefix + offset, hi - offset);
+    }
+    lo = offset > prefix_len ? offset : prefix_len;
+    hi = prefix_len + len < offset + 64 ? prefix_len + len : offset + 64;
+    if (lo < hi) {
+        memcpy(blk + (lo - offset), data + (lo - prefix_len), hi - lo);
+    }
+    if (prefix_len + len >= offset && prefix_len + len < offset + 64) {
+        blk[prefix_len + len - offset] = 0x80;
+    }
+    if (offset + 64 == total_len) {
+        memcpy(blk + 56, sizedesc, 8);
+    }
+}
+
+/* Hash up to eight messages in the lanes of the AVX2 transform. Unused lanes
+ * repeat the first message. */
+static void secp256k1_sha256_finalize_8way_avx2(unsigned char *out32, const secp256k1_sha256 *base, const unsigned char * const *data, size_t len, size_t n) {
+    uint32_t s[64];
+    unsigned char blks[8][64];
+    const unsigned char *blkptrs[8];
+    unsigned char sizedesc[8];
+    uint64_t bits = ((uint64_t)base->bytes + len) << 3;
+    size_t prefix_len = base->bytes & 0x3F;
+    size_t total_len = ((prefix_len + len + 8) / 64 + 1) * 64;
+    size_t offset;
+    int i, l;
+    VERIFY_CHECK(n >= 1 && n <= 8);
+
+    for (i = 0; i < 8; i++) {
+        sizedesc[i] = bits >> (56 - 8 * i);
+        for (l = 0; l < 8; l++) {
+            s[8 * i + l] = base->s[i];
+        }
+    }
+    for (l = 0; l < 8; l++) {
+        blkptrs[l] = blks[l];
+    }
+    for (offset = 0; offset < total_len; offset += 64) {
+        for (l = 0; l < 8; l++) {
+            secp256k1_sha256_multi_fill(blks[l], offset, (const unsigned char*)base->buf, prefix_len,
+                                        data[(size_t)l < n ? (size_t)l : 0], len, sizedesc, total_len);
+        }
+        secp256k1_sha256_transform_8way_avx2(s, blkptrs);
+    }
+    for (l = 0; (size_t)l < n; l++) {
+        for (i = 0; i < 8; i++) {
+            uint32_t v = s[8 * i + l];
+            out32[32 * l + 4 * i] = v >> 24;
+            out32[32 * l + 4 * i + 1] = v >> 16;
+            out32[32 * l + 4 * i + 2] = v >> 8;
+            out32[32 * l + 4 * i + 3] = v;
+        }
+    }
+}
+#endif
+
+static void secp256k1_sha256_finalize_multi(unsigned char *out32, const secp256k1_sha256 *base, const unsigned char * const *data, size_t len, size_t n) {
+    size_t i;
+#if defined(SECP256K1_SHA256_X86_AVX2)
+    /* A single SHA-NI transform is about as fast per message as eight AVX2
+     * lanes, so the lanes only pay off on CPUs without SHA-NI. */
+    if (n >= SECP256K1_SHA256_MULTI_MIN_LANES &&
+#if defined(SECP256K1_SHA256_X86_SHANI)
+        !secp256k1_sha256_accel_available() &&
+#endif
+        secp256k1_sha256_avx2_available()) {
+        while (n >= SECP256K1_SHA256_MULTI_MIN_LANES) {
+            size_t m = n < 8 ? n : 8;
+            secp256k1_sha256_finalize_8way_avx2(out32, base, data, len, m);
+            out32 += 32 * m;
+            data += m;
+            n -= m;
+        }
+    }
+#endif
+    for (i = 0; i < n; i++) {
+        secp256k1_sha256 sha = *base;
+        secp256k1_sha256_write(&sha, data[i], len);
+        secp256k1_sha256_finalize(&sha, out32 + 32 * i);
+    }
+}
+
 /* Initializes a sha256 struct and writes the 64 byte string
  * SHA256(tag)||SHA256(tag) into it. */
 static void secp256k1_sha256_initialize_tagged(secp256k1_sha256 *hash, const unsigned char *tag, size_t taglen) {
@@ -0,0 +1,125 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#ifndef SECP256K1_HASH_X86_AVX2_IMPL_H
+#define SECP256K1_HASH_X86_AVX2_IMPL_H
+
+/* Eight-lane SHA-256 transform using AVX2, processing one block of eight
+ * independent messages at once. The transform is compiled for AVX2 via a
+ * target attribute, so it must only be called after
+ * secp256k1_sha256_avx2_available has returned 1. The round constants
+ * secp256k1_sha256_k are defined in hash_impl.h. */
+
+#include <immintrin.h>
+
+#include "util.h"
+
+/* The avx2 check includes the OS support for the YMM registers. */
+static int secp256k1_sha256_avx2_available(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+#define SECP256K1_AVX2_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define SECP256K1_AVX2_XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+
+/** Perform one SHA-256 transformation on each of eight lanes. The state is
+ *  stored word-major: s[8*i + l] is word i of lane l. blocks[l] points to the
+ *  64-byte block for lane l. */
+__attribute__((target("avx2")))
+static void secp256k1_sha256_transform_8way_avx2(uint32_t* s, const unsigned char * const *blocks) {
+    const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                          12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    __m256i w[16];
+    __m256i a, b, c, d, e, f, g, h;
+    int i;
+
+    a = _mm256_loadu_si256((const __m256i*)(const void*)&s[0]);
+    b = _mm256_loadu_si256((const __m256i*)(const void*)&s[8]);
+    c = _mm256_loadu_si256((const __m256i*)(const void*)&s[16]);
+    d = _mm256_loadu_si256((const __m256i*)(const void*)&s[24]);
+    e = _mm256_loadu_si256((const __m256i*)(const void*)&s[32]);
+    f = _mm256_loadu_si256((const __m256i*)(const void*)&s[40]);
+    g = _mm256_loadu_si256((const __m256i*)(const void*)&s[48]);
+    h = _mm256_loadu_si256((const __m256i*)(const void*)&s[56]);
+
+    /* Transpose the blocks so that w[i] holds message word i of every lane. */
+    for (i = 0; i < 16; i += 8) {
+        __m256i r0, r1, r2, r3, r4, r5, r6, r7, t0, t1, t2, t3, t4, t5, t6, t7;
+        r0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[0] + 4*i)), bswap);
+        r1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[1] + 4*i)), bswap);
+        r2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[2] + 4*i)), bswap);
+        r3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[3] + 4*i)), bswap);
+        r4 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[4] + 4*i)), bswap);
+        r5 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[5] + 4*i)), bswap);
+        r6 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[6] + 4*i)), bswap);
+        r7 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(const void*)(blocks[7] + 4*i)), bswap);
+        t0 = _mm256_unpacklo_epi32(r0, r1);
+        t1 = _mm256_unpackhi_epi32(r0, r1);
+        t2 = _mm256_unpacklo_epi32(r2, r3);
+        t3 = _mm256_unpackhi_epi32(r2, r3);
+        t4 = _mm256_unpacklo_epi32(r4, r5);
+        t5 = _mm256_unpackhi_epi32(r4, r5);
+        t6 = _mm256_unpacklo_epi32(r6, r7);
+        t7 = _mm256_unpackhi_epi32(r6, r7);
+        r0 = _mm256_unpacklo_epi64(t0, t2);
+        r1 = _mm256_unpackhi_epi64(t0, t2);
+        r2 = _mm256_unpacklo_epi64(t1, t3);
+        r3 = _mm256_unpackhi_epi64(t1, t3);
+        r4 = _mm256_unpacklo_epi64(t4, t6);
+        r5 = _mm256_unpackhi_epi64(t4, t6);
+        r6 = _mm256_unpacklo_epi64(t5, t7);
+        r7 = _mm256_unpackhi_epi64(t5, t7);
+        w[i + 0] = _mm256_permute2x128_si256(r0, r4, 0x20);
+        w[i + 1] = _mm256_permute2x128_si256(r1, r5, 0x20);
+        w[i + 2] = _mm256_permute2x128_si256(r2, r6, 0x20);
+        w[i + 3] = _mm256_permute2x128_si256(r3, r7, 0x20);
+        w[i + 4] = _mm256_permute2x128_si256(r0, r4, 0x31);
+        w[i + 5] = _mm256_permute2x128_si256(r1, r5, 0x31);
+        w[i + 6] = _mm256_permute2x128_si256(r2, r6, 0x31);
+        w[i + 7] = _mm256_permute2x128_si256(r3, r7, 0x31);
+    }
+
+    for (i = 0; i < 64; i++) {
+        __m256i t1, t2, wi;
+        if (i < 16) {
+            wi = w[i];
+        } else {
+            __m256i w2 = w[(i - 2) & 15], w15 = w[(i - 15) & 15];
+            wi = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], w[(i - 7) & 15]),
+                 _mm256_add_epi32(SECP256K1_AVX2_XOR3(SECP256K1_AVX2_ROTR(w2, 17), SECP256K1_AVX2_ROTR(w2, 19), _mm256_srli_epi32(w2, 10)),
+                                  SECP256K1_AVX2_XOR3(SECP256K1_AVX2_ROTR(w15, 7), SECP256K1_AVX2_ROTR(w15, 18), _mm256_srli_epi32(w15, 3))));
+            w[i & 15] = wi;
+        }
+        /* t1 = h + Sigma1(e) + Ch(e, f, g) + k + w */
+        t1 = _mm256_add_epi32(_mm256_add_epi32(h, SECP256K1_AVX2_XOR3(SECP256K1_AVX2_ROTR(e, 6), SECP256K1_AVX2_ROTR(e, 11), SECP256K1_AVX2_ROTR(e, 25))),
+             _mm256_add_epi32(_mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g))),
+                              _mm256_add_epi32(_mm256_set1_epi32((int)secp256k1_sha256_k[i]), wi)));
+        /* t2 = Sigma0(a) + Maj(a, b, c) */
+        t2 = _mm256_add_epi32(SECP256K1_AVX2_XOR3(SECP256K1_AVX2_ROTR(a, 2), SECP256K1_AVX2_ROTR(a, 13), SECP256K1_AVX2_ROTR(a, 22)),
+                              _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b))));
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    _mm256_storeu_si256((__m256i*)(void*)&s[0], _mm256_add_epi32(a, _mm256_loadu_si256((const __m256i*)(const void*)&s[0])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[8], _mm256_add_epi32(b, _mm256_loadu_si256((const __m256i*)(const void*)&s[8])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[16], _mm256_add_epi32(c, _mm256_loadu_si256((const __m256i*)(const void*)&s[16])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[24], _mm256_add_epi32(d, _mm256_loadu_si256((const __m256i*)(const void*)&s[24])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[32], _mm256_add_epi32(e, _mm256_loadu_si256((const __m256i*)(const void*)&s[32])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[40], _mm256_add_epi32(f, _mm256_loadu_si256((const __m256i*)(const void*)&s[40])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[48], _mm256_add_epi32(g, _mm256_loadu_si256((const __m256i*)(const void*)&s[48])));
+    _mm256_storeu_si256((__m256i*)(void*)&s[56], _mm256_add_epi32(h, _mm256_loadu_si256((const __m256i*)(const void*)&s[56])));
+}
+
+#undef SECP256K1_AVX2_ROTR
+#undef SECP256K1_AVX2_XOR3
+
+#endif /* SECP256K1_HASH_X86_AVX2_IMPL_H */
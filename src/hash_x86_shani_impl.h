@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#ifndef SECP256K1_HASH_X86_SHANI_IMPL_H
+#define SECP256K1_HASH_X86_SHANI_IMPL_H
+
+/* SHA-256 transform using the x86 SHA extensions (SHA-NI). The functions in
+ * this file are compiled for the required instruction sets via target
+ * attributes, so they must only be called after
+ * secp256k1_sha256_shani_available has returned 1.
+ * The round constants secp256k1_sha256_k are defined in hash_impl.h. */
+
+#include <immintrin.h>
+
+#include "util.h"
+
+static int secp256k1_sha256_shani_available(void) {
+    return __builtin_cpu_supports("sha") && __builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.1");
+}
+
+/* Perform four rounds using message words m (w[4i..4i+3]). The state is kept as
+ * s0 = ABEF and s1 = CDGH as required by sha256rnds2. */
+#define SECP256K1_SHANI_QUADROUND(s0, s1, m, i) do { \
+    __m128i msg_ = _mm_add_epi32((m), _mm_loadu_si128((const __m128i*)(const void*)&secp256k1_sha256_k[4*(i)])); \
+    (s1) = _mm_sha256rnds2_epu32((s1), (s0), msg_); \
+    (s0) = _mm_sha256rnds2_epu32((s0), (s1), _mm_shuffle_epi32(msg_, 0x0e)); \
+} while(0)
+
+/* Complete the message words m2 using m0 (the preceding words) and m1 (the most recent). */
+#define SECP256K1_SHANI_SCHEDULE_FINISH(m0, m1, m2) do { \
+    (m2) = _mm_sha256msg2_epu32(_mm_add_epi32((m2), _mm_alignr_epi8((m1), (m0), 4)), (m1)); \
+} while(0)
+
+/* Start computing the message words that replace m0. */
+#define SECP256K1_SHANI_SCHEDULE_START(m0, m1) do { \
+    (m0) = _mm_sha256msg1_epu32((m0), (m1)); \
+} while(0)
+
+__attribute__((target("ssse3,sse4.1,sha")))
+static void secp256k1_sha256_transform_shani(uint32_t* s, const uint32_t* chunk) {
+    const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    const unsigned char *in = (const unsigned char *)chunk;
+    __m128i m0, m1, m2, m3, s0, s1, t0, t1, so0, so1;
+
+    /* Load the state and convert ABCD, EFGH into ABEF, CDGH. */
+    t0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(const void*)&s[0]), 0xB1);
+    t1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(const void*)&s[4]), 0x1B);
+    s0 = _mm_alignr_epi8(t0, t1, 8);
+    s1 = _mm_blend_epi16(t1, t0, 0xF0);
+    so0 = s0;
+    so1 = s1;
+
+    m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(const void*)(in + 0)), bswap);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m0, 0);
+    m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(const void*)(in + 16)), bswap);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m1, 1);
+    SECP256K1_SHANI_SCHEDULE_START(m0, m1);
+    m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(const void*)(in + 32)), bswap);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m2, 2);
+    SECP256K1_SHANI_SCHEDULE_START(m1, m2);
+    m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(const void*)(in + 48)), bswap);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m3, 3);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m2, m3, m0); SECP256K1_SHANI_SCHEDULE_START(m2, m3);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m0, 4);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m3, m0, m1); SECP256K1_SHANI_SCHEDULE_START(m3, m0);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m1, 5);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m0, m1, m2); SECP256K1_SHANI_SCHEDULE_START(m0, m1);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m2, 6);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m1, m2, m3); SECP256K1_SHANI_SCHEDULE_START(m1, m2);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m3, 7);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m2, m3, m0); SECP256K1_SHANI_SCHEDULE_START(m2, m3);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m0, 8);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m3, m0, m1); SECP256K1_SHANI_SCHEDULE_START(m3, m0);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m1, 9);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m0, m1, m2); SECP256K1_SHANI_SCHEDULE_START(m0, m1);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m2, 10);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m1, m2, m3); SECP256K1_SHANI_SCHEDULE_START(m1, m2);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m3, 11);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m2, m3, m0); SECP256K1_SHANI_SCHEDULE_START(m2, m3);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m0, 12);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m3, m0, m1); SECP256K1_SHANI_SCHEDULE_START(m3, m0);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m1, 13);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m0, m1, m2);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m2, 14);
+    SECP256K1_SHANI_SCHEDULE_FINISH(m1, m2, m3);
+    SECP256K1_SHANI_QUADROUND(s0, s1, m3, 15);
+
+    s0 = _mm_add_epi32(s0, so0);
+    s1 = _mm_add_epi32(s1, so1);
+
+    /* Convert ABEF, CDGH back into ABCD, EFGH and store the state. */
+    t0 = _mm_shuffle_epi32(s0, 0x1B);
+    t1 = _mm_shuffle_epi32(s1, 0xB1);
+    _mm_storeu_si128((__m128i*)(void*)&s[0], _mm_blend_epi16(t0, t1, 0xF0));
+    _mm_storeu_si128((__m128i*)(void*)&s[4], _mm_alignr_epi8(t1, t0, 8));
+}
+
+#undef SECP256K1_SHANI_QUADROUND
+#undef SECP256K1_SHANI_SCHEDULE_FINISH
+#undef SECP256K1_SHANI_SCHEDULE_START
+
+#endif /* SECP256K1_HASH_X86_SHANI_IMPL_H */
@@ -67,7 +67,20 @@ int secp256k1_generator_serialize(const secp256k1_context* ctx, unsigned char *o
     return 1;
 }
 
-static void shallue_van_de_woestijne(secp256k1_ge* ge, const secp256k1_fe* t) {
+/* Computes the joint denominator j = wd * c^2 * t^2 used by shallue_van_de_woestijne, with c^2 = -3. */
+static void shallue_van_de_woestijne_denominator(secp256k1_fe* j, const secp256k1_fe* t) {
+    secp256k1_fe t2, wd;
+
+    secp256k1_fe_sqr(&t2, t); /* mag 1 */
+    secp256k1_fe_set_int(&wd, 8);
+    secp256k1_fe_add(&wd, &t2); /* mag 2 */
+    secp256k1_fe_mul(j, &wd, &t2); /* mag 1 */
+    secp256k1_fe_mul_int(j, 3); /* mag 3 */
+    secp256k1_fe_negate(j, j, 3); /* mag 4 */
+}
+
+/* Same as shallue_van_de_woestijne, with jinv the inverse of the joint denominator of t (or zero if it is zero). */
+static void shallue_van_de_woestijne_jinv(secp256k1_ge* ge, const secp256k1_fe* t, const secp256k1_fe* jinv) {
     /* Implements the algorithm from:
      *    Indifferentiable Hashing to Barreto-Naehrig Curves
      *    Pierre-Alain Fouque and Mehdi Tibouchi
@@ -104,7 +117,7 @@ static void shallue_van_de_woestijne(secp256k1_ge* ge, const secp256k1_fe* t) {
     static const secp256k1_fe b = SECP256K1_FE_CONST(0, 0, 0, 0, 0, 0, 0, 7);
     static const secp256k1_fe b_plus_one = SECP256K1_FE_CONST(0, 0, 0, 0, 0, 0, 0, 8);
 
-    secp256k1_fe wn, wd, x1n, x2n, x3n, x3d, jinv, tmp, x1, x2, x3, alphain, betain, gammain, y1, y2, y3;
+    secp256k1_fe wn, wd, x1n, x2n, x3n, x3d, tmp, x1, x2, x3, alphain, betain, gammain, y1, y2, y3;
     int alphaquad, betaquad;
 
     secp256k1_fe_mul(&wn, &c, t); /* mag 1 */
@@ -121,14 +134,12 @@ static void shallue_van_de_woestijne(secp256k1_ge* ge, const secp256k1_fe* t) {
     secp256k1_fe_sqr(&x3d, &x3d); /* mag 1 */
     secp256k1_fe_sqr(&x3n, &wd); /* mag 1 */
     secp256k1_fe_add(&x3n, &x3d); /* mag 2 */
-    secp256k1_fe_mul(&jinv, &x3d, &wd); /* mag 1 */
-    secp256k1_fe_inv(&jinv, &jinv); /* mag 1 */
     secp256k1_fe_mul(&x1, &x1n, &x3d); /* mag 1 */
-    secp256k1_fe_mul(&x1, &x1, &jinv); /* mag 1 */
+    secp256k1_fe_mul(&x1, &x1, jinv); /* mag 1 */
     secp256k1_fe_mul(&x2, &x2n, &x3d); /* mag 1 */
-    secp256k1_fe_mul(&x2, &x2, &jinv); /* mag 1 */
+    secp256k1_fe_mul(&x2, &x2, jinv); /* mag 1 */
     secp256k1_fe_mul(&x3, &x3n, &wd); /* mag 1 */
-    secp256k1_fe_mul(&x3, &x3, &jinv); /* mag 1 */
+    secp256k1_fe_mul(&x3, &x3, jinv); /* mag 1 */
 
     secp256k1_fe_sqr(&alphain, &x1); /* mag 1 */
     secp256k1_fe_mul(&alphain, &alphain, &x1); /* mag 1 */
@@ -160,6 +171,46 @@ static void shallue_van_de_woestijne(secp256k1_ge* ge, const secp256k1_fe* t) {
     secp256k1_fe_cmov(&ge->y, &tmp, secp256k1_fe_is_odd(t));
 }
 
+static void shallue_van_de_woestijne(secp256k1_ge* ge, const secp256k1_fe* t) {
+    secp256k1_fe jinv;
+
+    shallue_van_de_woestijne_denominator(&jinv, t);
+    secp256k1_fe_inv(&jinv, &jinv);
+    shallue_van_de_woestijne_jinv(ge, t, &jinv);
+}
+
+/* Sets r[i] to the inverse of a[i] (zero if a[i] is zero) for 0 <= i < len, using a single
+ * field inversion (Montgomery's trick). Runs in constant time. r and a must not overlap. */
+static void secp256k1_generator_fe_inv_all(secp256k1_fe* r, const secp256k1_fe* a, size_t len) {
+    static const secp256k1_fe one = SECP256K1_FE_CONST(0, 0, 0, 0, 0, 0, 0, 1);
+    secp256k1_fe u, inv, zero;
+    size_t i;
+
+    if (len == 0) {
+        return;
+    }
+    /* Zero elements are replaced by one, so that they do not spoil the other inverses. */
+    r[0] = a[0];
+    secp256k1_fe_cmov(&r[0], &one, secp256k1_fe_normalizes_to_zero(&a[0]));
+    for (i = 1; i < len; i++) {
+        u = a[i];
+        secp256k1_fe_cmov(&u, &one, secp256k1_fe_normalizes_to_zero(&a[i]));
+        secp256k1_fe_mul(&r[i], &r[i - 1], &u);
+    }
+    secp256k1_fe_inv(&inv, &r[len - 1]);
+    for (i = len - 1; i > 0; i--) {
+        u = a[i];
+        secp256k1_fe_cmov(&u, &one, secp256k1_fe_normalizes_to_zero(&a[i]));
+        secp256k1_fe_mul(&r[i], &r[i - 1], &inv);
+        secp256k1_fe_mul(&inv, &inv, &u);
+    }
+    r[0] = inv;
+    secp256k1_fe_clear(&zero);
+    for (i = 0; i < len; i++) {
+        secp256k1_fe_cmov(&r[i], &zero, secp256k1_fe_normalizes_to_zero(&a[i]));
+    }
+}
+
 static int secp256k1_generator_generate_internal(const secp256k1_context* ctx, secp256k1_generator* gen, const unsigned char *key32, const unsigned char *blind32) {
     static const unsigned char prefix1[17] = "1st generation: ";
     static const unsigned char prefix2[17] = "2nd generation: ";
@@ -210,6 +261,68 @@ int secp256k1_generator_generate(const secp256k1_context* ctx, secp256k1_generat
     return secp256k1_generator_generate_internal(ctx, gen, key32, NULL);
 }
 
+/* Number of generators derived side by side in secp256k1_generator_generate_batch. */
+#define SECP256K1_GENERATOR_GENERATE_BATCH 32
+
+int secp256k1_generator_generate_batch(const secp256k1_context* ctx, secp256k1_generator* gens, const unsigned char * const *seeds32, size_t n) {
+    static const unsigned char prefix1[17] = "1st generation: ";
+    static const unsigned char prefix2[17] = "2nd generation: ";
+    secp256k1_sha256 sha256_prefix1;
+    secp256k1_sha256 sha256_prefix2;
+    unsigned char b32[2 * SECP256K1_GENERATOR_GENERATE_BATCH * 32];
+    secp256k1_fe t[2 * SECP256K1_GENERATOR_GENERATE_BATCH];
+    secp256k1_fe den[2 * SECP256K1_GENERATOR_GENERATE_BATCH];
+    secp256k1_fe inv[2 * SECP256K1_GENERATOR_GENERATE_BATCH];
+    secp256k1_gej accum[SECP256K1_GENERATOR_GENERATE_BATCH];
+    secp256k1_ge add;
+    size_t start;
+    size_t count;
+    size_t i;
+    int ret = 1;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n == 0 || gens != NULL);
+    ARG_CHECK(n == 0 || seeds32 != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(seeds32[i] != NULL);
+    }
+
+    secp256k1_sha256_initialize(&sha256_prefix1);
+    secp256k1_sha256_write(&sha256_prefix1, prefix1, 16);
+    secp256k1_sha256_initialize(&sha256_prefix2);
+    secp256k1_sha256_write(&sha256_prefix2, prefix2, 16);
+
+    for (start = 0; start < n; start += count) {
+        count = n - start;
+        if (count > SECP256K1_GENERATOR_GENERATE_BATCH) {
+            count = SECP256K1_GENERATOR_GENERATE_BATCH;
+        }
+        /* The first hashes go to t[0..count), the second ones to t[count..2*count). */
+        secp256k1_sha256_finalize_multi(&b32[0], &sha256_prefix1, &seeds32[start], 32, count);
+        secp256k1_sha256_finalize_multi(&b32[32 * count], &sha256_prefix2, &seeds32[start], 32, count);
+        for (i = 0; i < 2 * count; i++) {
+            ret &= secp256k1_fe_set_b32(&t[i], &b32[32 * i]);
+            shallue_van_de_woestijne_denominator(&den[i], &t[i]);
+        }
+        secp256k1_generator_fe_inv_all(inv, den, 2 * count);
+
+        for (i = 0; i < count; i++) {
+            shallue_van_de_woestijne_jinv(&add, &t[i], &inv[i]);
+            secp256k1_gej_set_ge(&accum[i], &add);
+            shallue_van_de_woestijne_jinv(&add, &t[count + i], &inv[count + i]);
+            secp256k1_gej_add_ge(&accum[i], &accum[i], &add);
+            den[i] = accum[i].z;
+        }
+        /* Convert all sums to affine coordinates with one more inversion. */
+        secp256k1_generator_fe_inv_all(inv, den, count);
+        for (i = 0; i < count; i++) {
+            secp256k1_ge_set_gej_zinv(&add, &accum[i], &inv[i]);
+            secp256k1_generator_save(&gens[start + i], &add);
+        }
+    }
+    return ret;
+}
+
 int secp256k1_generator_generate_blinded(const secp256k1_context* ctx, secp256k1_generator* gen, const unsigned char *key32, const unsigned char *blind32) {
     VERIFY_CHECK(ctx != NULL);
     ARG_CHECK(gen != NULL);
@@ -21,6 +21,7 @@ void test_generator_api(void) {
     unsigned char key[32];
     unsigned char blind[32];
     unsigned char sergen[33];
+    const unsigned char *keys[1];
     secp256k1_context *none = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
     secp256k1_context *sign = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
     secp256k1_context *vrfy = secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
@@ -38,6 +39,7 @@ void test_generator_api(void) {
     secp256k1_context_set_illegal_callback(sttc, counting_illegal_callback_fn, &ecount);
     secp256k1_testrand256(key);
     secp256k1_testrand256(blind);
+    keys[0] = key;
 
     CHECK(secp256k1_generator_generate(none, &gen, key) == 1);
     CHECK(ecount == 0);
@@ -76,6 +78,18 @@ void test_generator_api(void) {
     CHECK(secp256k1_generator_parse(none, &gen, NULL) == 0);
     CHECK(ecount == 10);
 
+    CHECK(secp256k1_generator_generate_batch(none, &gen, keys, 1) == 1);
+    CHECK(ecount == 10);
+    CHECK(secp256k1_generator_generate_batch(none, NULL, NULL, 0) == 1);
+    CHECK(ecount == 10);
+    CHECK(secp256k1_generator_generate_batch(none, NULL, keys, 1) == 0);
+    CHECK(ecount == 11);
+    CHECK(secp256k1_generator_generate_batch(none, &gen, NULL, 1) == 0);
+    CHECK(ecount == 12);
+    keys[0] = NULL;
+    CHECK(secp256k1_generator_generate_batch(none, &gen, keys, 1) == 0);
+    CHECK(ecount == 13);
+
     secp256k1_context_destroy(none);
     secp256k1_context_destroy(sign);
     secp256k1_context_destroy(vrfy);
@@ -139,6 +153,35 @@ void test_shallue_van_de_woestijne(void) {
     }
 }
 
+void test_shallue_van_de_woestijne_batch(void) {
+    /* Inverting the denominators of many t values at once, including a zero one, gives the
+     * same points as shallue_van_de_woestijne. */
+    secp256k1_fe t[33];
+    secp256k1_fe den[33];
+    secp256k1_fe inv[33];
+    secp256k1_ge ge1, ge2;
+    secp256k1_ge_storage ges1, ges2;
+    int i;
+
+    secp256k1_fe_set_int(&t[0], 0);
+    for (i = 1; i < 33; i++) {
+        random_field_element_test(&t[i]);
+    }
+    for (i = 0; i < 33; i++) {
+        shallue_van_de_woestijne_denominator(&den[i], &t[i]);
+    }
+    CHECK(secp256k1_fe_normalizes_to_zero(&den[0]));
+    secp256k1_generator_fe_inv_all(inv, den, 33);
+    CHECK(secp256k1_fe_normalizes_to_zero(&inv[0]));
+    for (i = 0; i < 33; i++) {
+        shallue_van_de_woestijne(&ge1, &t[i]);
+        shallue_van_de_woestijne_jinv(&ge2, &t[i], &inv[i]);
+        secp256k1_ge_to_storage(&ges1, &ge1);
+        secp256k1_ge_to_storage(&ges2, &ge2);
+        CHECK(memcmp(&ges1, &ges2, sizeof(secp256k1_ge_storage)) == 0);
+    }
+}
+
 void test_generator_generate(void) {
     static const secp256k1_ge_storage results[32] = {
         SECP256K1_GE_STORAGE_CONST(0x806cd8ed, 0xd6c153e3, 0x4aa9b9a0, 0x8755c4be, 0x4718b1ef, 0xb26cb93f, 0xfdd99e1b, 0x21f2af8e, 0xc7062208, 0xcc649a03, 0x1bdc1a33, 0x9d01f115, 0x4bcd0dca, 0xfe0b875d, 0x62f35f73, 0x28673006),
@@ -175,10 +218,13 @@ void test_generator_generate(void) {
         SECP256K1_GE_STORAGE_CONST(0x38e02eaf, 0x2c8774fd, 0x58b8b373, 0x732457f1, 0x16dbe53b, 0xea5683d9, 0xada20dd7, 0x14ce20a6, 0x6ac5362e, 0xbb425416, 0x8250f43f, 0xa4ee2b63, 0x0406324f, 0x1c876d60, 0xebe5be2c, 0x6eb1515b),
     };
     secp256k1_generator gen;
+    secp256k1_generator gens[32];
     secp256k1_ge ge;
     secp256k1_ge_storage ges;
     int i;
     unsigned char v[32];
+    unsigned char vs[32][32];
+    const unsigned char *vptrs[32];
     unsigned char s[32] = {0};
     secp256k1_scalar sc;
     secp256k1_scalar_set_b32(&sc, s, NULL);
@@ -194,6 +240,17 @@ void test_generator_generate(void) {
         secp256k1_ge_to_storage(&ges, &ge);
         CHECK(memcmp(&ges, &results[i - 1], sizeof(secp256k1_ge_storage)) == 0);
     }
+    for (i = 0; i < 32; i++) {
+        memset(vs[i], 0, 31);
+        vs[i][31] = i + 1;
+        vptrs[i] = vs[i];
+    }
+    CHECK(secp256k1_generator_generate_batch(ctx, gens, vptrs, 32));
+    for (i = 0; i < 32; i++) {
+        secp256k1_generator_load(&ge, &gens[i]);
+        secp256k1_ge_to_storage(&ges, &ge);
+        CHECK(memcmp(&ges, &results[i], sizeof(secp256k1_ge_storage)) == 0);
+    }
 
     /* There is no range restriction on the value, but the blinder must be a
      * valid scalar. Check that an invalid blinder causes the call to fail
@@ -204,6 +261,28 @@ void test_generator_generate(void) {
     CHECK(!secp256k1_generator_generate_blinded(ctx, &gen, v, s));
 }
 
+void test_generator_generate_batch(void) {
+    /* Spans several internal batches, with a partial one at the end. */
+    secp256k1_generator gen;
+    secp256k1_generator gens[75];
+    unsigned char seeds[75][32];
+    const unsigned char *seed_ptrs[75];
+    size_t n;
+    size_t i;
+
+    for (i = 0; i < 75; i++) {
+        secp256k1_testrand256(seeds[i]);
+        seed_ptrs[i] = seeds[i];
+    }
+    for (n = 0; n <= 75; n += 1 + secp256k1_testrand_int(16)) {
+        CHECK(secp256k1_generator_generate_batch(ctx, gens, seed_ptrs, n));
+        for (i = 0; i < n; i++) {
+            CHECK(secp256k1_generator_generate(ctx, &gen, seeds[i]));
+            CHECK(memcmp(&gen, &gens[i], sizeof(gen)) == 0);
+        }
+    }
+}
+
 void test_generator_fixed_vector(void) {
     const unsigned char two_g[33] = {
         0x0b,
@@ -225,9 +304,11 @@ void test_generator_fixed_vector(void) {
 
 void run_generator_tests(void) {
     test_shallue_van_de_woestijne();
+    test_shallue_van_de_woestijne_batch();
     test_generator_fixed_vector();
     test_generator_api();
     test_generator_generate();
+    test_generator_generate_batch();
 }
 
 #endif
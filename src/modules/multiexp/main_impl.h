@@ -0,0 +1,245 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_MULTIEXP_MAIN_H
+#define SECP256K1_MODULE_MULTIEXP_MAIN_H
+
+#include "include/secp256k1.h"
+#include "include/secp256k1_multiexp.h"
+
+typedef struct {
+    const secp256k1_context *ctx;
+    secp256k1_multiexp_callback cb;
+    void *cbdata;
+    const secp256k1_pubkey * const *points;
+    const unsigned char * const *scalars32;
+    size_t offset;
+} secp256k1_multiexp_ecmult_data;
+
+/* Adapts the public interface (arrays or a user callback) to secp256k1_ecmult_multi_callback. */
+static int secp256k1_multiexp_ecmult_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *cbdata) {
+    const secp256k1_multiexp_ecmult_data *data = (const secp256k1_multiexp_ecmult_data *) cbdata;
+    unsigned char buf[32];
+    const unsigned char *scalar32;
+    const secp256k1_pubkey *point;
+    secp256k1_pubkey tmp;
+    int overflow;
+
+    if (data->cb != NULL) {
+        if (!data->cb(buf, &tmp, idx, data->cbdata)) {
+            return 0;
+        }
+        scalar32 = buf;
+        point = &tmp;
+    } else {
+        scalar32 = data->scalars32[data->offset + idx];
+        point = data->points[data->offset + idx];
+    }
+    secp256k1_scalar_set_b32(sc, scalar32, &overflow);
+    if (overflow) {
+        return 0;
+    }
+    return secp256k1_pubkey_load(data->ctx, pt, point);
+}
+
+static int secp256k1_multiexp_internal(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const unsigned char *g_scalar32, secp256k1_multiexp_ecmult_data *data, size_t n_points) {
+    secp256k1_scalar g_scalar;
+    secp256k1_gej rj;
+    secp256k1_ge r;
+    int overflow;
+
+    if (result != NULL) {
+        memset(result, 0, sizeof(*result));
+    }
+    *is_infinity = 0;
+    if (g_scalar32 != NULL) {
+        secp256k1_scalar_set_b32(&g_scalar, g_scalar32, &overflow);
+        if (overflow) {
+            return 0;
+        }
+    }
+    if (!secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &rj, g_scalar32 != NULL ? &g_scalar : NULL, secp256k1_multiexp_ecmult_callback, (void *) data, n_points)) {
+        return 0;
+    }
+    if (secp256k1_gej_is_infinity(&rj)) {
+        *is_infinity = 1;
+        return 1;
+    }
+    if (result != NULL) {
+        secp256k1_ge_set_gej_var(&r, &rj);
+        secp256k1_pubkey_save(result, &r);
+    }
+    return 1;
+}
+
+int secp256k1_multiexp(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const unsigned char *g_scalar32, const secp256k1_pubkey * const *points, const unsigned char * const *scalars32, size_t n_points) {
+    secp256k1_multiexp_ecmult_data data;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(is_infinity != NULL);
+    ARG_CHECK(n_points == 0 || points != NULL);
+    ARG_CHECK(n_points == 0 || scalars32 != NULL);
+    for (i = 0; i < n_points; i++) {
+        ARG_CHECK(points[i] != NULL);
+        ARG_CHECK(scalars32[i] != NULL);
+    }
+
+    data.ctx = ctx;
+    data.cb = NULL;
+    data.cbdata = NULL;
+    data.points = points;
+    data.scalars32 = scalars32;
+    data.offset = 0;
+    return secp256k1_multiexp_internal(ctx, scratch, result, is_infinity, g_scalar32, &data, n_points);
+}
+
+int secp256k1_multiexp_with_callback(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const unsigned char *g_scalar32, secp256k1_multiexp_callback cb, void *cbdata, size_t n_points) {
+    secp256k1_multiexp_ecmult_data data;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(is_infinity != NULL);
+    ARG_CHECK(n_points == 0 || cb != NULL);
+
+    data.ctx = ctx;
+    data.cb = cb;
+    data.cbdata = cbdata;
+    data.points = NULL;
+    data.scalars32 = NULL;
+    data.offset = 0;
+    return secp256k1_multiexp_internal(ctx, scratch, result, is_infinity, g_scalar32, &data, n_points);
+}
+
+typedef struct {
+    secp256k1_gej r;
+    int ret;
+} secp256k1_multiexp_task_result;
+
+typedef struct {
+    const secp256k1_context *ctx;
+    secp256k1_scratch_space * const *scratches;
+    secp256k1_multiexp_task_result *results;
+    size_t n_tasks;
+    const secp256k1_pubkey * const *points;
+    const unsigned char * const *scalars32;
+    size_t n_points;
+} secp256k1_multiexp_parallel_data;
+
+/* Runs the multiexp over the task_idx-th slice of the points. Every task only
+ * reads the shared inputs and writes to its own result slot and scratch space,
+ * so tasks can run concurrently. */
+static void secp256k1_multiexp_parallel_task(void *task_data, size_t task_idx) {
+    const secp256k1_multiexp_parallel_data *pd = (const secp256k1_multiexp_parallel_data *) task_data;
+    secp256k1_multiexp_ecmult_data data;
+    size_t begin = (pd->n_points * task_idx) / pd->n_tasks;
+    size_t end = (pd->n_points * (task_idx + 1)) / pd->n_tasks;
+
+    data.ctx = pd->ctx;
+    data.cb = NULL;
+    data.cbdata = NULL;
+    data.points = pd->points;
+    data.scalars32 = pd->scalars32;
+    data.offset = begin;
+    pd->results[task_idx].ret = secp256k1_ecmult_multi_var(&pd->ctx->error_callback, pd->scratches[task_idx], &pd->results[task_idx].r, NULL, secp256k1_multiexp_ecmult_callback, (void *) &data, end - begin);
+}
+
+int secp256k1_multiexp_parallel(const secp256k1_context* ctx, secp256k1_scratch_space * const *scratches, size_t n_tasks, secp256k1_multiexp_executor executor, void *executor_data, secp256k1_pubkey *result, int *is_infinity, const unsigned char *g_scalar32, const secp256k1_pubkey * const *points, const unsigned char * const *scalars32, size_t n_points) {
+    secp256k1_multiexp_parallel_data pd;
+    secp256k1_multiexp_ecmult_data data;
+    secp256k1_scalar g_scalar;
+    secp256k1_gej rj;
+    secp256k1_ge r;
+    size_t scratch_checkpoint;
+    size_t i;
+    int overflow;
+    int ret = 1;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(scratches != NULL);
+    ARG_CHECK(n_tasks > 0);
+    ARG_CHECK(scratches[0] != NULL);
+    ARG_CHECK(executor != NULL);
+    ARG_CHECK(is_infinity != NULL);
+    ARG_CHECK(n_points == 0 || points != NULL);
+    ARG_CHECK(n_points == 0 || scalars32 != NULL);
+    for (i = 0; i < n_points; i++) {
+        ARG_CHECK(points[i] != NULL);
+        ARG_CHECK(scalars32[i] != NULL);
+    }
+
+    /* Tasks with fewer points than this are not worth the overhead of the
+     * executor; run serially on the first scratch space instead. */
+    if (n_tasks > n_points / ECMULT_PIPPENGER_THRESHOLD) {
+        n_tasks = n_points / ECMULT_PIPPENGER_THRESHOLD;
+    }
+    scratch_checkpoint = secp256k1_scratch_checkpoint(&ctx->error_callback, scratches[0]);
+    pd.results = NULL;
+    if (n_tasks > 1) {
+        pd.results = (secp256k1_multiexp_task_result *) secp256k1_scratch_alloc(&ctx->error_callback, scratches[0], n_tasks * sizeof(*pd.results));
+    }
+    if (pd.results == NULL) {
+        data.ctx = ctx;
+        data.cb = NULL;
+        data.cbdata = NULL;
+        data.points = points;
+        data.scalars32 = scalars32;
+        data.offset = 0;
+        return secp256k1_multiexp_internal(ctx, scratches[0], result, is_infinity, g_scalar32, &data, n_points);
+    }
+
+    if (result != NULL) {
+        memset(result, 0, sizeof(*result));
+    }
+    *is_infinity = 0;
+    if (g_scalar32 != NULL) {
+        secp256k1_scalar_set_b32(&g_scalar, g_scalar32, &overflow);
+        if (overflow) {
+            secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratches[0], scratch_checkpoint);
+            return 0;
+        }
+    }
+
+    pd.ctx = ctx;
+    pd.scratches = scratches;
+    pd.n_tasks = n_tasks;
+    pd.points = points;
+    pd.scalars32 = scalars32;
+    pd.n_points = n_points;
+    for (i = 0; i < n_tasks; i++) {
+        pd.results[i].ret = 0;
+    }
+    if (!executor(secp256k1_multiexp_parallel_task, &pd, n_tasks, executor_data)) {
+        secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratches[0], scratch_checkpoint);
+        return 0;
+    }
+
+    /* Combine the partial sums in task order so that the result does not
+     * depend on the order in which the executor ran the tasks. */
+    secp256k1_gej_set_infinity(&rj);
+    if (g_scalar32 != NULL) {
+        secp256k1_scalar szero;
+        secp256k1_scalar_set_int(&szero, 0);
+        secp256k1_ecmult(&rj, &rj, &szero, &g_scalar);
+    }
+    for (i = 0; i < n_tasks; i++) {
+        ret &= pd.results[i].ret;
+        secp256k1_gej_add_var(&rj, &rj, &pd.results[i].r, NULL);
+    }
+    secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratches[0], scratch_checkpoint);
+    if (!ret) {
+        return 0;
+    }
+    if (secp256k1_gej_is_infinity(&rj)) {
+        *is_infinity = 1;
+        return 1;
+    }
+    if (result != NULL) {
+        secp256k1_ge_set_gej_var(&r, &rj);
+        secp256k1_pubkey_save(result, &r);
+    }
+    return 1;
+}
+
+#endif
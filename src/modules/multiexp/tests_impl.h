@@ -0,0 +1,338 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_MULTIEXP_TESTS_H
+#define SECP256K1_MODULE_MULTIEXP_TESTS_H
+
+#include "include/secp256k1_multiexp.h"
+
+typedef struct {
+    const secp256k1_pubkey *points;
+    const unsigned char *scalars;
+    size_t fail_idx;
+} multiexp_test_data;
+
+static int multiexp_test_callback(unsigned char *scalar32, secp256k1_pubkey *point, size_t idx, void *data) {
+    const multiexp_test_data *d = (const multiexp_test_data *) data;
+    if (idx == d->fail_idx) {
+        return 0;
+    }
+    memcpy(scalar32, &d->scalars[32 * idx], 32);
+    *point = d->points[idx];
+    return 1;
+}
+
+/* Computes the expected result of a multiexp by summing individual tweaked multiplications */
+static int multiexp_test_naive(secp256k1_pubkey *result, const unsigned char *g_scalar32, const secp256k1_pubkey *points, const unsigned char *scalars, size_t n) {
+    secp256k1_gej acc;
+    secp256k1_gej tmpj;
+    secp256k1_ge ge;
+    secp256k1_scalar sc;
+    secp256k1_scalar zero;
+    size_t i;
+
+    secp256k1_scalar_set_int(&zero, 0);
+    secp256k1_gej_set_infinity(&acc);
+    if (g_scalar32 != NULL) {
+        secp256k1_scalar_set_b32(&sc, g_scalar32, NULL);
+        secp256k1_ecmult(&tmpj, &acc, &zero, &sc);
+        acc = tmpj;
+    }
+    for (i = 0; i < n; i++) {
+        CHECK(secp256k1_pubkey_load(ctx, &ge, &points[i]));
+        secp256k1_gej_set_ge(&tmpj, &ge);
+        secp256k1_scalar_set_b32(&sc, &scalars[32 * i], NULL);
+        secp256k1_ecmult(&tmpj, &tmpj, &sc, NULL);
+        secp256k1_gej_add_var(&acc, &acc, &tmpj, NULL);
+    }
+    if (secp256k1_gej_is_infinity(&acc)) {
+        return 0;
+    }
+    secp256k1_ge_set_gej(&ge, &acc);
+    secp256k1_pubkey_save(result, &ge);
+    return 1;
+}
+
+static void test_multiexp_api(void) {
+    secp256k1_context *none = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
+    secp256k1_pubkey points[2];
+    const secp256k1_pubkey *point_ptrs[2];
+    unsigned char scalars[2][32];
+    const unsigned char *scalar_ptrs[2];
+    unsigned char overflow[32];
+    secp256k1_pubkey result;
+    multiexp_test_data data;
+    int is_inf;
+    int ecount = 0;
+    size_t i;
+
+    secp256k1_context_set_illegal_callback(none, counting_illegal_callback_fn, &ecount);
+    for (i = 0; i < 2; i++) {
+        unsigned char sk[32];
+        secp256k1_testrand256(sk);
+        CHECK(secp256k1_ec_pubkey_create(ctx, &points[i], sk) == 1);
+        secp256k1_testrand256(scalars[i]);
+        point_ptrs[i] = &points[i];
+        scalar_ptrs[i] = scalars[i];
+    }
+    data.points = points;
+    data.scalars = &scalars[0][0];
+    data.fail_idx = 2;
+    memset(overflow, 0xFF, sizeof(overflow));
+
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, 2) == 1);
+    CHECK(ecount == 0);
+    CHECK(secp256k1_multiexp(none, NULL, NULL, &is_inf, scalars[0], point_ptrs, scalar_ptrs, 2) == 1);
+    CHECK(ecount == 0);
+    CHECK(secp256k1_multiexp(none, NULL, &result, NULL, NULL, point_ptrs, scalar_ptrs, 2) == 0);
+    CHECK(ecount == 1);
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, NULL, scalar_ptrs, 2) == 0);
+    CHECK(ecount == 2);
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, point_ptrs, NULL, 2) == 0);
+    CHECK(ecount == 3);
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, NULL, NULL, 0) == 1);
+    CHECK(ecount == 3);
+    CHECK(is_inf == 1);
+    point_ptrs[1] = NULL;
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, 2) == 0);
+    CHECK(ecount == 4);
+    point_ptrs[1] = &points[1];
+    scalar_ptrs[0] = NULL;
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, 2) == 0);
+    CHECK(ecount == 5);
+    scalar_ptrs[0] = scalars[0];
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, overflow, point_ptrs, scalar_ptrs, 2) == 0);
+    scalar_ptrs[1] = overflow;
+    CHECK(secp256k1_multiexp(none, NULL, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, 2) == 0);
+    CHECK(ecount == 5);
+
+    CHECK(secp256k1_multiexp_with_callback(none, NULL, &result, &is_inf, NULL, multiexp_test_callback, &data, 2) == 1);
+    CHECK(ecount == 5);
+    CHECK(secp256k1_multiexp_with_callback(none, NULL, &result, NULL, NULL, multiexp_test_callback, &data, 2) == 0);
+    CHECK(ecount == 6);
+    CHECK(secp256k1_multiexp_with_callback(none, NULL, &result, &is_inf, NULL, NULL, &data, 2) == 0);
+    CHECK(ecount == 7);
+    CHECK(secp256k1_multiexp_with_callback(none, NULL, &result, &is_inf, NULL, NULL, NULL, 0) == 1);
+    CHECK(ecount == 7);
+    data.fail_idx = 1;
+    CHECK(secp256k1_multiexp_with_callback(none, NULL, &result, &is_inf, NULL, multiexp_test_callback, &data, 2) == 0);
+    CHECK(ecount == 7);
+
+    secp256k1_context_destroy(none);
+}
+
+static void test_multiexp_random(size_t n, secp256k1_scratch_space *scratch) {
+    secp256k1_pubkey *points = (secp256k1_pubkey *) checked_malloc(&ctx->error_callback, n * sizeof(*points));
+    const secp256k1_pubkey **point_ptrs = (const secp256k1_pubkey **) checked_malloc(&ctx->error_callback, n * sizeof(*point_ptrs));
+    unsigned char *scalars = (unsigned char *) checked_malloc(&ctx->error_callback, n * 32);
+    const unsigned char **scalar_ptrs = (const unsigned char **) checked_malloc(&ctx->error_callback, n * sizeof(*scalar_ptrs));
+    unsigned char g_scalar[32];
+    secp256k1_pubkey expected, result;
+    multiexp_test_data data;
+    secp256k1_scalar sc;
+    int is_inf;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        unsigned char sk[32];
+        secp256k1_testrand256(sk);
+        CHECK(secp256k1_ec_pubkey_create(ctx, &points[i], sk) == 1);
+        random_scalar_order_test(&sc);
+        secp256k1_scalar_get_b32(&scalars[32 * i], &sc);
+        point_ptrs[i] = &points[i];
+        scalar_ptrs[i] = &scalars[32 * i];
+    }
+    random_scalar_order_test(&sc);
+    secp256k1_scalar_get_b32(g_scalar, &sc);
+    data.points = points;
+    data.scalars = scalars;
+    data.fail_idx = n;
+
+    CHECK(multiexp_test_naive(&expected, g_scalar, points, scalars, n) == 1);
+    CHECK(secp256k1_multiexp(ctx, scratch, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+    CHECK(is_inf == 0);
+    CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+    CHECK(secp256k1_multiexp_with_callback(ctx, scratch, &result, &is_inf, g_scalar, multiexp_test_callback, &data, n) == 1);
+    CHECK(is_inf == 0);
+    CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+
+    CHECK(multiexp_test_naive(&expected, NULL, points, scalars, n) == 1);
+    CHECK(secp256k1_multiexp(ctx, scratch, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 1);
+    CHECK(is_inf == 0);
+    CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+
+    /* Cancel the sum by adding -(sum) * G */
+    if (n > 0) {
+        secp256k1_scalar acc, tmp;
+        unsigned char sk[32];
+        secp256k1_scalar_set_int(&acc, 0);
+        for (i = 0; i < n; i++) {
+            /* Replace each point by a_i * G with known a_i */
+            random_scalar_order_test(&tmp);
+            secp256k1_scalar_get_b32(sk, &tmp);
+            CHECK(secp256k1_ec_pubkey_create(ctx, &points[i], sk) == 1);
+            secp256k1_scalar_set_b32(&sc, &scalars[32 * i], NULL);
+            secp256k1_scalar_mul(&tmp, &tmp, &sc);
+            secp256k1_scalar_add(&acc, &acc, &tmp);
+        }
+        secp256k1_scalar_negate(&acc, &acc);
+        secp256k1_scalar_get_b32(g_scalar, &acc);
+        memset(&result, 0xFF, sizeof(result));
+        CHECK(secp256k1_multiexp(ctx, scratch, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+        CHECK(is_inf == 1);
+        memset(&expected, 0, sizeof(expected));
+        CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+    }
+
+    free(points);
+    free(point_ptrs);
+    free(scalars);
+    free(scalar_ptrs);
+}
+
+typedef struct {
+    int reverse;
+    int fail;
+    size_t calls;
+} multiexp_test_executor_data;
+
+/* Runs the tasks one after another, optionally in reverse order to check that
+ * the result does not depend on the schedule. */
+static int multiexp_test_executor(secp256k1_multiexp_task task, void *task_data, size_t n_tasks, void *executor_data) {
+    multiexp_test_executor_data *d = (multiexp_test_executor_data *) executor_data;
+    size_t i;
+    if (d->fail) {
+        return 0;
+    }
+    for (i = 0; i < n_tasks; i++) {
+        task(task_data, d->reverse ? n_tasks - 1 - i : i);
+        d->calls++;
+    }
+    return 1;
+}
+
+static void test_multiexp_parallel(void) {
+    secp256k1_scratch_space *scratches[4];
+    secp256k1_context *none = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
+    size_t n = 4 * ECMULT_PIPPENGER_THRESHOLD + 7;
+    secp256k1_pubkey *points = (secp256k1_pubkey *) checked_malloc(&ctx->error_callback, n * sizeof(*points));
+    const secp256k1_pubkey **point_ptrs = (const secp256k1_pubkey **) checked_malloc(&ctx->error_callback, n * sizeof(*point_ptrs));
+    unsigned char *scalars = (unsigned char *) checked_malloc(&ctx->error_callback, n * 32);
+    const unsigned char **scalar_ptrs = (const unsigned char **) checked_malloc(&ctx->error_callback, n * sizeof(*scalar_ptrs));
+    unsigned char g_scalar[32];
+    unsigned char overflow[32];
+    secp256k1_pubkey expected, result;
+    multiexp_test_executor_data ed;
+    secp256k1_scalar sc;
+    int is_inf;
+    int ecount = 0;
+    size_t i;
+
+    secp256k1_context_set_illegal_callback(none, counting_illegal_callback_fn, &ecount);
+    for (i = 0; i < 4; i++) {
+        scratches[i] = secp256k1_scratch_space_create(ctx, 64 * 1024);
+    }
+    for (i = 0; i < n; i++) {
+        unsigned char sk[32];
+        secp256k1_testrand256(sk);
+        CHECK(secp256k1_ec_pubkey_create(ctx, &points[i], sk) == 1);
+        random_scalar_order_test(&sc);
+        secp256k1_scalar_get_b32(&scalars[32 * i], &sc);
+        point_ptrs[i] = &points[i];
+        scalar_ptrs[i] = &scalars[32 * i];
+    }
+    random_scalar_order_test(&sc);
+    secp256k1_scalar_get_b32(g_scalar, &sc);
+    memset(overflow, 0xFF, sizeof(overflow));
+    CHECK(secp256k1_multiexp(ctx, scratches[0], &expected, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+    CHECK(is_inf == 0);
+
+    for (i = 1; i <= 4; i++) {
+        ed.reverse = 0;
+        ed.fail = 0;
+        ed.calls = 0;
+        CHECK(secp256k1_multiexp_parallel(ctx, scratches, i, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+        CHECK(is_inf == 0);
+        CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+        CHECK(ed.calls == (i > 1 ? i : 0));
+        ed.reverse = 1;
+        CHECK(secp256k1_multiexp_parallel(ctx, scratches, i, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+        CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+    }
+    /* Too few points to split */
+    ed.calls = 0;
+    CHECK(secp256k1_multiexp(ctx, scratches[0], &expected, &is_inf, g_scalar, point_ptrs, scalar_ptrs, ECMULT_PIPPENGER_THRESHOLD) == 1);
+    CHECK(secp256k1_multiexp_parallel(ctx, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, ECMULT_PIPPENGER_THRESHOLD) == 1);
+    CHECK(secp256k1_memcmp_var(&expected, &result, sizeof(result)) == 0);
+    CHECK(ed.calls == 0);
+
+    /* Failures */
+    ed.fail = 1;
+    CHECK(secp256k1_multiexp_parallel(ctx, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 0);
+    ed.fail = 0;
+    CHECK(secp256k1_multiexp_parallel(ctx, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, overflow, point_ptrs, scalar_ptrs, n) == 0);
+    scalar_ptrs[n - 1] = overflow;
+    CHECK(secp256k1_multiexp_parallel(ctx, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 0);
+    scalar_ptrs[n - 1] = &scalars[32 * (n - 1)];
+    /* The scratch space of the first task is restored */
+    CHECK(secp256k1_multiexp_parallel(ctx, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, g_scalar, point_ptrs, scalar_ptrs, n) == 1);
+    CHECK(secp256k1_scratch_checkpoint(&ctx->error_callback, scratches[0]) == 0);
+
+    /* API */
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, NULL, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 1);
+    CHECK(ecount == 0);
+    CHECK(secp256k1_multiexp_parallel(none, NULL, 4, multiexp_test_executor, &ed, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 1);
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 0, multiexp_test_executor, &ed, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 2);
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, NULL, &ed, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 3);
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, &result, NULL, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 4);
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, NULL, NULL, scalar_ptrs, n) == 0);
+    CHECK(ecount == 5);
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, NULL, point_ptrs, NULL, n) == 0);
+    CHECK(ecount == 6);
+    point_ptrs[n - 1] = NULL;
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 7);
+    point_ptrs[n - 1] = &points[n - 1];
+    scalar_ptrs[0] = NULL;
+    CHECK(secp256k1_multiexp_parallel(none, scratches, 4, multiexp_test_executor, &ed, &result, &is_inf, NULL, point_ptrs, scalar_ptrs, n) == 0);
+    CHECK(ecount == 8);
+    scalar_ptrs[0] = &scalars[0];
+
+    for (i = 0; i < 4; i++) {
+        secp256k1_scratch_space_destroy(ctx, scratches[i]);
+    }
+    secp256k1_context_destroy(none);
+    free(points);
+    free(point_ptrs);
+    free(scalars);
+    free(scalar_ptrs);
+}
+
+void run_multiexp_tests(void) {
+    secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    secp256k1_scratch_space *small_scratch = secp256k1_scratch_space_create(ctx, 2048);
+    int i;
+
+    test_multiexp_api();
+    for (i = 0; i < count; i++) {
+        size_t n = 1 + secp256k1_testrand_int(16);
+        test_multiexp_random(n, scratch);
+        test_multiexp_random(n, small_scratch);
+        test_multiexp_random(n, NULL);
+    }
+    /* Large enough to use Pippenger's algorithm */
+    test_multiexp_random(ECMULT_PIPPENGER_THRESHOLD + 12, scratch);
+    test_multiexp_random(ECMULT_PIPPENGER_THRESHOLD + 12, small_scratch);
+    test_multiexp_parallel();
+
+    secp256k1_scratch_space_destroy(ctx, scratch);
+    secp256k1_scratch_space_destroy(ctx, small_scratch);
+}
+
+#endif
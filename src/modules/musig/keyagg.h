@@ -12,6 +12,7 @@
 
 #include "../../field.h"
 #include "../../group.h"
+#include "../../hash.h"
 #include "../../scalar.h"
 
 typedef struct {
@@ -22,6 +23,21 @@ typedef struct {
     int internal_key_parity;
 } secp256k1_keyagg_cache_internal;
 
+struct secp256k1_musig_keyagg_state_struct {
+    size_t n_pubkeys;
+    size_t capacity;
+    /* Loaded public keys, their 32-byte serializations and their KeyAgg
+     * coefficients as of the last call to secp256k1_musig_keyagg_state_agg. */
+    secp256k1_ge *pts;
+    unsigned char *sers;
+    secp256k1_scalar *coefs;
+    /* midstates[i] is the KeyAgg list hash after writing the first 2*i keys,
+     * which fill exactly i SHA256 blocks. The first n_midstates entries are
+     * valid, the first one always is. */
+    secp256k1_sha256 *midstates;
+    size_t n_midstates;
+};
+
 /* Requires that the saved point is not infinity */
 static void secp256k1_point_save(unsigned char *data, secp256k1_ge *ge);
 
@@ -15,6 +15,7 @@
 #include "../../field.h"
 #include "../../group.h"
 #include "../../hash.h"
+#include "../../precomputed_tagged_hash.h"
 #include "../../util.h"
 
 static void secp256k1_point_save(unsigned char *data, secp256k1_ge *ge) {
@@ -93,17 +94,7 @@ static int secp256k1_keyagg_cache_load(const secp256k1_context* ctx, secp256k1_k
 /* Initializes SHA256 with fixed midstate. This midstate was computed by applying
  * SHA256 to SHA256("KeyAgg list")||SHA256("KeyAgg list"). */
 static void secp256k1_musig_keyagglist_sha256(secp256k1_sha256 *sha) {
-    secp256k1_sha256_initialize(sha);
-
-    sha->s[0] = 0xb399d5e0ul;
-    sha->s[1] = 0xc8fff302ul;
-    sha->s[2] = 0x6badac71ul;
-    sha->s[3] = 0x07c5b7f1ul;
-    sha->s[4] = 0x9701e2eful;
-    sha->s[5] = 0x2a72ecf8ul;
-    sha->s[6] = 0x201a4c7bul;
-    sha->s[7] = 0xab148a38ul;
-    sha->bytes = 64;
+    secp256k1_sha256_initialize_tagged_musig_keyagg_list(sha);
 }
 
 /* Computes pk_hash = tagged_hash(pk[0], ..., pk[np-1]) */
@@ -126,17 +117,7 @@ static int secp256k1_musig_compute_pk_hash(const secp256k1_context *ctx, unsigne
 /* Initializes SHA256 with fixed midstate. This midstate was computed by applying
  * SHA256 to SHA256("KeyAgg coefficient")||SHA256("KeyAgg coefficient"). */
 static void secp256k1_musig_keyaggcoef_sha256(secp256k1_sha256 *sha) {
-    secp256k1_sha256_initialize(sha);
-
-    sha->s[0] = 0x6ef02c5aul;
-    sha->s[1] = 0x06a480deul;
-    sha->s[2] = 0x1f298665ul;
-    sha->s[3] = 0x1d1134f2ul;
-    sha->s[4] = 0x56a0b063ul;
-    sha->s[5] = 0x52da4147ul;
-    sha->s[6] = 0xf280d9d4ul;
-    sha->s[7] = 0x4484be15ul;
-    sha->bytes = 64;
+    secp256k1_sha256_initialize_tagged_musig_keyagg_coef(sha);
 }
 
 /* Compute KeyAgg coefficient which is constant 1 for the second pubkey and
@@ -165,32 +146,136 @@ static void secp256k1_musig_keyaggcoef(secp256k1_scalar *r, const secp256k1_keya
     secp256k1_musig_keyaggcoef_internal(r, cache_i->pk_hash, x, &cache_i->second_pk_x);
 }
 
+/* Number of KeyAgg coefficients computed at once by secp256k1_musig_pubkey_agg_callback. */
+#define SECP256K1_MUSIG_KEYAGGCOEF_BATCH 8
+
+/* Compute the KeyAgg coefficients of the n points pts, as
+ * secp256k1_musig_keyaggcoef_internal does for a single one. The tagged hashes
+ * only differ in the x coordinate, so they are computed side by side. */
+static void secp256k1_musig_keyaggcoef_multi(secp256k1_scalar *r, const unsigned char *pk_hash, const secp256k1_ge *pts, const secp256k1_fe *second_pk_x, size_t n) {
+    secp256k1_sha256 sha;
+    unsigned char xs[SECP256K1_MUSIG_KEYAGGCOEF_BATCH][32];
+    const unsigned char *xptrs[SECP256K1_MUSIG_KEYAGGCOEF_BATCH];
+    unsigned char hashes[SECP256K1_MUSIG_KEYAGGCOEF_BATCH * 32];
+    size_t idx[SECP256K1_MUSIG_KEYAGGCOEF_BATCH];
+    size_t n_hash = 0;
+    size_t i;
+    VERIFY_CHECK(n <= SECP256K1_MUSIG_KEYAGGCOEF_BATCH);
+
+    for (i = 0; i < SECP256K1_MUSIG_KEYAGGCOEF_BATCH; i++) {
+        xptrs[i] = xs[i];
+    }
+    for (i = 0; i < n; i++) {
+        if (secp256k1_fe_cmp_var(&pts[i].x, second_pk_x) == 0) {
+            secp256k1_scalar_set_int(&r[i], 1);
+        } else {
+            secp256k1_fe_get_b32(xs[n_hash], &pts[i].x);
+            idx[n_hash++] = i;
+        }
+    }
+    secp256k1_musig_keyaggcoef_sha256(&sha);
+    secp256k1_sha256_write(&sha, pk_hash, 32);
+    secp256k1_sha256_finalize_multi(hashes, &sha, xptrs, 32, n_hash);
+    for (i = 0; i < n_hash; i++) {
+        secp256k1_scalar_set_b32(&r[idx[i]], &hashes[32 * i], NULL);
+    }
+}
+
 typedef struct {
     const secp256k1_context *ctx;
     /* pk_hash is the hash of the public keys */
     unsigned char pk_hash[32];
     const secp256k1_xonly_pubkey * const* pks;
+    size_t n_pks;
     secp256k1_fe second_pk_x;
+    /* Points and coefficients of the n_cached pubkeys starting at index cache_offset */
+    secp256k1_ge pts[SECP256K1_MUSIG_KEYAGGCOEF_BATCH];
+    secp256k1_scalar coefs[SECP256K1_MUSIG_KEYAGGCOEF_BATCH];
+    size_t cache_offset;
+    size_t n_cached;
 } secp256k1_musig_pubkey_agg_ecmult_data;
 
-/* Callback for batch EC multiplication to compute keyaggcoef_0*P0 + keyaggcoef_1*P1 + ...  */
+/* Callback for batch EC multiplication to compute keyaggcoef_0*P0 + keyaggcoef_1*P1 + ...
+ * The coefficients are computed for SECP256K1_MUSIG_KEYAGGCOEF_BATCH pubkeys at a time. */
 static int secp256k1_musig_pubkey_agg_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data) {
     secp256k1_musig_pubkey_agg_ecmult_data *ctx = (secp256k1_musig_pubkey_agg_ecmult_data *) data;
-    int ret;
-    ret = secp256k1_xonly_pubkey_load(ctx->ctx, pt, ctx->pks[idx]);
-    /* pubkey_load can't fail because the same pks have already been loaded in
-     * `musig_compute_pk_hash` (and we test this). */
-    VERIFY_CHECK(ret);
-    secp256k1_musig_keyaggcoef_internal(sc, ctx->pk_hash, &pt->x, &ctx->second_pk_x);
+    if (idx < ctx->cache_offset || idx >= ctx->cache_offset + ctx->n_cached) {
+        size_t i;
+        ctx->cache_offset = idx;
+        ctx->n_cached = ctx->n_pks - idx < SECP256K1_MUSIG_KEYAGGCOEF_BATCH ? ctx->n_pks - idx : SECP256K1_MUSIG_KEYAGGCOEF_BATCH;
+        for (i = 0; i < ctx->n_cached; i++) {
+            int ret = secp256k1_xonly_pubkey_load(ctx->ctx, &ctx->pts[i], ctx->pks[idx + i]);
+            /* pubkey_load can't fail because the same pks have already been loaded in
+             * `musig_compute_pk_hash` (and we test this). */
+            VERIFY_CHECK(ret);
+        }
+        secp256k1_musig_keyaggcoef_multi(ctx->coefs, ctx->pk_hash, ctx->pts, &ctx->second_pk_x, ctx->n_cached);
+    }
+    *pt = ctx->pts[idx - ctx->cache_offset];
+    *sc = ctx->coefs[idx - ctx->cache_offset];
     return 1;
 }
 
+typedef struct {
+    const secp256k1_ge *pts;
+    const secp256k1_scalar *coefs;
+} secp256k1_musig_pubkey_agg_precomputed_data;
+
+/* Callback for batch EC multiplication when all points and coefficients were computed in advance. */
+static int secp256k1_musig_pubkey_agg_precomputed_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data) {
+    secp256k1_musig_pubkey_agg_precomputed_data *ctx = (secp256k1_musig_pubkey_agg_precomputed_data *) data;
+    *pt = ctx->pts[idx];
+    *sc = ctx->coefs[idx];
+    return 1;
+}
+
+/* Loads all pubkeys into pts and computes their KeyAgg coefficients, so that
+ * the multiexponentiation does not have to compute them on the fly. */
+static void secp256k1_musig_pubkey_agg_precompute(const secp256k1_context* ctx, secp256k1_ge *pts, secp256k1_scalar *coefs, const secp256k1_musig_pubkey_agg_ecmult_data *ecmult_data) {
+    size_t i;
+    for (i = 0; i < ecmult_data->n_pks; i++) {
+        int ret = secp256k1_xonly_pubkey_load(ctx, &pts[i], ecmult_data->pks[i]);
+        /* See secp256k1_musig_pubkey_agg_callback */
+        VERIFY_CHECK(ret);
+    }
+    for (i = 0; i < ecmult_data->n_pks; i += SECP256K1_MUSIG_KEYAGGCOEF_BATCH) {
+        size_t n = ecmult_data->n_pks - i < SECP256K1_MUSIG_KEYAGGCOEF_BATCH ? ecmult_data->n_pks - i : SECP256K1_MUSIG_KEYAGGCOEF_BATCH;
+        secp256k1_musig_keyaggcoef_multi(&coefs[i], ecmult_data->pk_hash, &pts[i], &ecmult_data->second_pk_x, n);
+    }
+}
+
+/* Writes the aggregate public key pkj to agg_pk and keyagg_cache, each of which
+ * can be NULL. */
+static void secp256k1_musig_pubkey_agg_save(secp256k1_xonly_pubkey *agg_pk, secp256k1_musig_keyagg_cache *keyagg_cache, secp256k1_gej *pkj, const secp256k1_fe *second_pk_x, const unsigned char *pk_hash) {
+    secp256k1_ge pkp;
+
+    secp256k1_ge_set_gej(&pkp, pkj);
+    secp256k1_fe_normalize_var(&pkp.y);
+    /* The resulting public key is infinity with negligible probability */
+    VERIFY_CHECK(!secp256k1_ge_is_infinity(&pkp));
+    if (keyagg_cache != NULL) {
+        secp256k1_keyagg_cache_internal cache_i = { 0 };
+        cache_i.pk = pkp;
+        cache_i.second_pk_x = *second_pk_x;
+        memcpy(cache_i.pk_hash, pk_hash, sizeof(cache_i.pk_hash));
+        secp256k1_keyagg_cache_save(keyagg_cache, &cache_i);
+    }
+
+    secp256k1_extrakeys_ge_even_y(&pkp);
+    if (agg_pk != NULL) {
+        secp256k1_xonly_pubkey_save(agg_pk, &pkp);
+    }
+}
+
 int secp256k1_musig_pubkey_agg(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_xonly_pubkey *agg_pk, secp256k1_musig_keyagg_cache *keyagg_cache, const secp256k1_xonly_pubkey * const* pubkeys, size_t n_pubkeys) {
     secp256k1_musig_pubkey_agg_ecmult_data ecmult_data;
+    secp256k1_musig_pubkey_agg_precomputed_data precomputed_data;
+    secp256k1_ge *pts = NULL;
+    secp256k1_scalar *coefs = NULL;
+    size_t checkpoint = 0;
     secp256k1_gej pkj;
-    secp256k1_ge pkp;
     size_t i;
-    (void) scratch;
+    int ret;
 
     VERIFY_CHECK(ctx != NULL);
     if (agg_pk != NULL) {
@@ -201,6 +286,9 @@ int secp256k1_musig_pubkey_agg(const secp256k1_context* ctx, secp256k1_scratch_s
 
     ecmult_data.ctx = ctx;
     ecmult_data.pks = pubkeys;
+    ecmult_data.n_pks = n_pubkeys;
+    ecmult_data.cache_offset = 0;
+    ecmult_data.n_cached = 0;
     /* No point on the curve has an X coordinate equal to 0 */
     secp256k1_fe_set_int(&ecmult_data.second_pk_x, 0);
     for (i = 1; i < n_pubkeys; i++) {
@@ -217,33 +305,282 @@ int secp256k1_musig_pubkey_agg(const secp256k1_context* ctx, secp256k1_scratch_s
     if (!secp256k1_musig_compute_pk_hash(ctx, ecmult_data.pk_hash, pubkeys, n_pubkeys)) {
         return 0;
     }
-    /* TODO: actually use optimized ecmult_multi algorithms by providing a
-     * scratch space */
-    if (!secp256k1_ecmult_multi_var(&ctx->error_callback, NULL, &pkj, NULL, secp256k1_musig_pubkey_agg_callback, (void *) &ecmult_data, n_pubkeys)) {
+    if (scratch != NULL) {
+        checkpoint = secp256k1_scratch_checkpoint(&ctx->error_callback, scratch);
+        pts = (secp256k1_ge *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, n_pubkeys * sizeof(secp256k1_ge));
+        coefs = (secp256k1_scalar *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, n_pubkeys * sizeof(secp256k1_scalar));
+    }
+    if (pts != NULL && coefs != NULL) {
+        /* The rest of the scratch space is used by the multiexponentiation. */
+        secp256k1_musig_pubkey_agg_precompute(ctx, pts, coefs, &ecmult_data);
+        precomputed_data.pts = pts;
+        precomputed_data.coefs = coefs;
+        ret = secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &pkj, NULL, secp256k1_musig_pubkey_agg_precomputed_callback, (void *) &precomputed_data, n_pubkeys);
+        secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratch, checkpoint);
+    } else {
+        /* Release pts if only it could be allocated, so that the
+         * multiexponentiation gets the whole scratch space. */
+        if (scratch != NULL) {
+            secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratch, checkpoint);
+        }
+        ret = secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &pkj, NULL, secp256k1_musig_pubkey_agg_callback, (void *) &ecmult_data, n_pubkeys);
+    }
+    if (!ret) {
         /* In order to reach this line with the current implementation of
          * ecmult_multi_var one would need to provide a callback that can
          * fail. */
         return 0;
     }
-    secp256k1_ge_set_gej(&pkp, &pkj);
-    secp256k1_fe_normalize_var(&pkp.y);
-    /* The resulting public key is infinity with negligible probability */
-    VERIFY_CHECK(!secp256k1_ge_is_infinity(&pkp));
-    if (keyagg_cache != NULL) {
-        secp256k1_keyagg_cache_internal cache_i = { 0 };
-        cache_i.pk = pkp;
-        cache_i.second_pk_x = ecmult_data.second_pk_x;
-        memcpy(cache_i.pk_hash, ecmult_data.pk_hash, sizeof(cache_i.pk_hash));
-        secp256k1_keyagg_cache_save(keyagg_cache, &cache_i);
+    secp256k1_musig_pubkey_agg_save(agg_pk, keyagg_cache, &pkj, &ecmult_data.second_pk_x, ecmult_data.pk_hash);
+    return 1;
+}
+
+/* Grows the arrays of state so that they can hold capacity keys. */
+static int secp256k1_musig_keyagg_state_reserve(const secp256k1_context* ctx, secp256k1_musig_keyagg_state *state, size_t capacity) {
+    secp256k1_ge *pts;
+    unsigned char *sers;
+    secp256k1_scalar *coefs;
+    secp256k1_sha256 *midstates;
+
+    if (capacity <= state->capacity) {
+        return 1;
+    }
+    pts = (secp256k1_ge *)checked_malloc(&ctx->error_callback, capacity * sizeof(*pts));
+    sers = (unsigned char *)checked_malloc(&ctx->error_callback, capacity * 32);
+    coefs = (secp256k1_scalar *)checked_malloc(&ctx->error_callback, capacity * sizeof(*coefs));
+    midstates = (secp256k1_sha256 *)checked_malloc(&ctx->error_callback, (capacity / 2 + 1) * sizeof(*midstates));
+    if (pts == NULL || sers == NULL || coefs == NULL || midstates == NULL) {
+        free(pts);
+        free(sers);
+        free(coefs);
+        free(midstates);
+        return 0;
+    }
+    if (state->n_pubkeys > 0) {
+        memcpy(pts, state->pts, state->n_pubkeys * sizeof(*pts));
+        memcpy(sers, state->sers, state->n_pubkeys * 32);
+    }
+    if (state->n_midstates > 0) {
+        memcpy(midstates, state->midstates, state->n_midstates * sizeof(*midstates));
     }
+    free(state->pts);
+    free(state->sers);
+    free(state->coefs);
+    free(state->midstates);
+    state->pts = pts;
+    state->sers = sers;
+    state->coefs = coefs;
+    state->midstates = midstates;
+    state->capacity = capacity;
+    return 1;
+}
 
-    secp256k1_extrakeys_ge_even_y(&pkp);
+/* Forgets the list hash midstates that include the key at position index. */
+static void secp256k1_musig_keyagg_state_invalidate(secp256k1_musig_keyagg_state *state, size_t index) {
+    if (state->n_midstates > index / 2 + 1) {
+        state->n_midstates = index / 2 + 1;
+    }
+}
+
+/* Loads pubkey into position index of state. */
+static int secp256k1_musig_keyagg_state_load(const secp256k1_context* ctx, secp256k1_musig_keyagg_state *state, size_t index, const secp256k1_xonly_pubkey *pubkey) {
+    secp256k1_ge pt;
+
+    if (!secp256k1_xonly_pubkey_load(ctx, &pt, pubkey)) {
+        return 0;
+    }
+    state->pts[index] = pt;
+    secp256k1_fe_get_b32(&state->sers[32 * index], &pt.x);
+    return 1;
+}
+
+secp256k1_musig_keyagg_state* secp256k1_musig_keyagg_state_create(const secp256k1_context* ctx, const secp256k1_xonly_pubkey * const* pubkeys, size_t n_pubkeys) {
+    secp256k1_musig_keyagg_state *state;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(pubkeys != NULL || n_pubkeys == 0);
+
+    state = (secp256k1_musig_keyagg_state *)checked_malloc(&ctx->error_callback, sizeof(*state));
+    if (state == NULL) {
+        return NULL;
+    }
+    memset(state, 0, sizeof(*state));
+    if (!secp256k1_musig_keyagg_state_reserve(ctx, state, n_pubkeys > 0 ? n_pubkeys : 1)) {
+        free(state);
+        return NULL;
+    }
+    secp256k1_musig_keyagglist_sha256(&state->midstates[0]);
+    state->n_midstates = 1;
+    for (i = 0; i < n_pubkeys; i++) {
+        if (!secp256k1_musig_keyagg_state_load(ctx, state, i, pubkeys[i])) {
+            secp256k1_musig_keyagg_state_destroy(state);
+            return NULL;
+        }
+    }
+    state->n_pubkeys = n_pubkeys;
+    return state;
+}
+
+void secp256k1_musig_keyagg_state_destroy(secp256k1_musig_keyagg_state* state) {
+    if (state != NULL) {
+        free(state->pts);
+        free(state->sers);
+        free(state->coefs);
+        free(state->midstates);
+        free(state);
+    }
+}
+
+int secp256k1_musig_keyagg_state_set_pubkey(const secp256k1_context* ctx, secp256k1_musig_keyagg_state *state, size_t index, const secp256k1_xonly_pubkey *pubkey) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(state != NULL);
+    ARG_CHECK(index < state->n_pubkeys);
+    ARG_CHECK(pubkey != NULL);
+
+    if (!secp256k1_musig_keyagg_state_load(ctx, state, index, pubkey)) {
+        return 0;
+    }
+    secp256k1_musig_keyagg_state_invalidate(state, index);
+    return 1;
+}
+
+int secp256k1_musig_keyagg_state_insert_pubkey(const secp256k1_context* ctx, secp256k1_musig_keyagg_state *state, size_t index, const secp256k1_xonly_pubkey *pubkey) {
+    secp256k1_ge pt;
+    size_t n_move;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(state != NULL);
+    ARG_CHECK(index <= state->n_pubkeys);
+    ARG_CHECK(pubkey != NULL);
+
+    if (!secp256k1_xonly_pubkey_load(ctx, &pt, pubkey)) {
+        return 0;
+    }
+    if (state->n_pubkeys == state->capacity
+        && !secp256k1_musig_keyagg_state_reserve(ctx, state, 2 * state->capacity)) {
+        return 0;
+    }
+    n_move = state->n_pubkeys - index;
+    memmove(&state->pts[index + 1], &state->pts[index], n_move * sizeof(*state->pts));
+    memmove(&state->sers[32 * (index + 1)], &state->sers[32 * index], n_move * 32);
+    state->pts[index] = pt;
+    secp256k1_fe_get_b32(&state->sers[32 * index], &pt.x);
+    state->n_pubkeys++;
+    secp256k1_musig_keyagg_state_invalidate(state, index);
+    return 1;
+}
+
+int secp256k1_musig_keyagg_state_remove_pubkey(const secp256k1_context* ctx, secp256k1_musig_keyagg_state *state, size_t index) {
+    size_t n_move;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(state != NULL);
+    ARG_CHECK(index < state->n_pubkeys);
+
+    n_move = state->n_pubkeys - index - 1;
+    memmove(&state->pts[index], &state->pts[index + 1], n_move * sizeof(*state->pts));
+    memmove(&state->sers[32 * index], &state->sers[32 * (index + 1)], n_move * 32);
+    state->n_pubkeys--;
+    secp256k1_musig_keyagg_state_invalidate(state, index);
+    return 1;
+}
+
+int secp256k1_musig_keyagg_state_agg(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_xonly_pubkey *agg_pk, secp256k1_musig_keyagg_cache *keyagg_cache, secp256k1_musig_keyagg_state *state) {
+    secp256k1_musig_pubkey_agg_precomputed_data precomputed_data;
+    secp256k1_sha256 sha;
+    unsigned char pk_hash[32];
+    secp256k1_fe second_pk_x;
+    secp256k1_gej pkj;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
     if (agg_pk != NULL) {
-        secp256k1_xonly_pubkey_save(agg_pk, &pkp);
+        memset(agg_pk, 0, sizeof(*agg_pk));
+    }
+    ARG_CHECK(state != NULL);
+    ARG_CHECK(state->n_pubkeys > 0);
+
+    /* Continue hashing the list from the last valid midstate, and remember
+     * the midstates of the keys written from there. */
+    sha = state->midstates[state->n_midstates - 1];
+    for (i = 2 * (state->n_midstates - 1); i < state->n_pubkeys; i++) {
+        secp256k1_sha256_write(&sha, &state->sers[32 * i], 32);
+        if (i % 2 == 1) {
+            state->midstates[(i + 1) / 2] = sha;
+        }
+    }
+    state->n_midstates = state->n_pubkeys / 2 + 1;
+    secp256k1_sha256_finalize(&sha, pk_hash);
+
+    /* No point on the curve has an X coordinate equal to 0 */
+    secp256k1_fe_set_int(&second_pk_x, 0);
+    for (i = 1; i < state->n_pubkeys; i++) {
+        if (secp256k1_memcmp_var(&state->sers[0], &state->sers[32 * i], 32) != 0) {
+            second_pk_x = state->pts[i].x;
+            break;
+        }
+    }
+
+    for (i = 0; i < state->n_pubkeys; i += SECP256K1_MUSIG_KEYAGGCOEF_BATCH) {
+        size_t n = state->n_pubkeys - i < SECP256K1_MUSIG_KEYAGGCOEF_BATCH ? state->n_pubkeys - i : SECP256K1_MUSIG_KEYAGGCOEF_BATCH;
+        secp256k1_musig_keyaggcoef_multi(&state->coefs[i], pk_hash, &state->pts[i], &second_pk_x, n);
+    }
+    precomputed_data.pts = state->pts;
+    precomputed_data.coefs = state->coefs;
+    if (!secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &pkj, NULL, secp256k1_musig_pubkey_agg_precomputed_callback, (void *) &precomputed_data, state->n_pubkeys)) {
+        /* See secp256k1_musig_pubkey_agg */
+        return 0;
     }
+    secp256k1_musig_pubkey_agg_save(agg_pk, keyagg_cache, &pkj, &second_pk_x, pk_hash);
     return 1;
 }
 
+int secp256k1_musig_keyagg_state_serialize(const secp256k1_context* ctx, unsigned char *output, size_t *outputlen, const secp256k1_musig_keyagg_state *state) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(outputlen != NULL);
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(state != NULL);
+
+    if (*outputlen < 32 * state->n_pubkeys) {
+        return 0;
+    }
+    *outputlen = 32 * state->n_pubkeys;
+    if (state->n_pubkeys > 0) {
+        memcpy(output, state->sers, *outputlen);
+    }
+    return 1;
+}
+
+secp256k1_musig_keyagg_state* secp256k1_musig_keyagg_state_parse(const secp256k1_context* ctx, const unsigned char *input, size_t inputlen) {
+    secp256k1_musig_keyagg_state *state;
+    size_t n_pubkeys;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(input != NULL || inputlen == 0);
+
+    if (inputlen % 32 != 0) {
+        return NULL;
+    }
+    state = secp256k1_musig_keyagg_state_create(ctx, NULL, 0);
+    n_pubkeys = inputlen / 32;
+    if (state == NULL || !secp256k1_musig_keyagg_state_reserve(ctx, state, n_pubkeys)) {
+        secp256k1_musig_keyagg_state_destroy(state);
+        return NULL;
+    }
+    for (i = 0; i < n_pubkeys; i++) {
+        secp256k1_xonly_pubkey pubkey;
+        if (!secp256k1_xonly_pubkey_parse(ctx, &pubkey, &input[32 * i])
+            || !secp256k1_musig_keyagg_state_load(ctx, state, i, &pubkey)) {
+            secp256k1_musig_keyagg_state_destroy(state);
+            return NULL;
+        }
+    }
+    state->n_pubkeys = n_pubkeys;
+    return state;
+}
+
 int secp256k1_musig_pubkey_get(const secp256k1_context* ctx, secp256k1_pubkey *agg_pk, secp256k1_musig_keyagg_cache *keyagg_cache) {
     secp256k1_keyagg_cache_internal cache_i;
     VERIFY_CHECK(ctx != NULL);
@@ -16,7 +16,9 @@
 #include "keyagg.h"
 #include "session.h"
 #include "../../eckey.h"
+#include "../../ecmult.h"
 #include "../../hash.h"
+#include "../../precomputed_tagged_hash.h"
 #include "../../scalar.h"
 #include "../../util.h"
 
@@ -226,35 +228,35 @@ static int secp256k1_xonly_ge_serialize(unsigned char *output32, secp256k1_ge *g
     return 1;
 }
 
-static void secp256k1_nonce_function_musig(secp256k1_scalar *k, const unsigned char *session_id, const unsigned char *msg32, const unsigned char *key32, const unsigned char *agg_pk32, const unsigned char *extra_input32) {
-    secp256k1_sha256 sha;
-    unsigned char seed[32];
-    unsigned char i;
+/* Writes the inputs of the MuSig nonce function that follow the session id to
+ * buf, which must have room for 132 bytes, and returns their length. */
+static size_t secp256k1_nonce_function_musig_inputs(unsigned char *buf, const unsigned char *msg32, const unsigned char *key32, const unsigned char *agg_pk32, const unsigned char *extra_input32) {
     enum { n_extra_in = 4 };
     const unsigned char *extra_in[n_extra_in];
+    size_t len = 0;
+    int i;
 
-    /* TODO: this doesn't have the same sidechannel resistance as the BIP340
-     * nonce function because the seckey feeds directly into SHA. */
-
-    /* Subtract one from `sizeof` to avoid hashing the implicit null byte */
-    secp256k1_sha256_initialize_tagged(&sha, (unsigned char*)"MuSig/nonce", sizeof("MuSig/nonce") - 1);
-    secp256k1_sha256_write(&sha, session_id, 32);
     extra_in[0] = msg32;
     extra_in[1] = key32;
     extra_in[2] = agg_pk32;
     extra_in[3] = extra_input32;
     for (i = 0; i < n_extra_in; i++) {
-        unsigned char len;
         if (extra_in[i] != NULL) {
-            len = 32;
-            secp256k1_sha256_write(&sha, &len, 1);
-            secp256k1_sha256_write(&sha, extra_in[i], 32);
+            buf[len++] = 32;
+            memcpy(&buf[len], extra_in[i], 32);
+            len += 32;
         } else {
-            len = 0;
-            secp256k1_sha256_write(&sha, &len, 1);
+            buf[len++] = 0;
         }
     }
-    secp256k1_sha256_finalize(&sha, seed);
+    return len;
+}
+
+/* Computes k[0] and k[1] from the seed hashed from the session id and the
+ * other inputs of the nonce function. */
+static void secp256k1_nonce_function_musig_expand(secp256k1_scalar *k, const unsigned char *seed) {
+    secp256k1_sha256 sha;
+    unsigned char i;
 
     for (i = 0; i < 2; i++) {
         unsigned char buf[32];
@@ -266,22 +268,32 @@ static void secp256k1_nonce_function_musig(secp256k1_scalar *k, const unsigned c
     }
 }
 
-int secp256k1_musig_nonce_gen(const secp256k1_context* ctx, secp256k1_musig_secnonce *secnonce, secp256k1_musig_pubnonce *pubnonce, const unsigned char *session_id32, const unsigned char *seckey, const unsigned char *msg32, const secp256k1_musig_keyagg_cache *keyagg_cache, const unsigned char *extra_input32) {
+static void secp256k1_nonce_function_musig(secp256k1_scalar *k, const unsigned char *session_id, const unsigned char *msg32, const unsigned char *key32, const unsigned char *agg_pk32, const unsigned char *extra_input32) {
+    secp256k1_sha256 sha;
+    unsigned char seed[32];
+    unsigned char inputs[132];
+    size_t inputs_len;
+
+    /* TODO: this doesn't have the same sidechannel resistance as the BIP340
+     * nonce function because the seckey feeds directly into SHA. */
+
+    secp256k1_sha256_initialize_tagged_musig_nonce(&sha);
+    secp256k1_sha256_write(&sha, session_id, 32);
+    inputs_len = secp256k1_nonce_function_musig_inputs(inputs, msg32, key32, agg_pk32, extra_input32);
+    secp256k1_sha256_write(&sha, inputs, inputs_len);
+    secp256k1_sha256_finalize(&sha, seed);
+    secp256k1_nonce_function_musig_expand(k, seed);
+}
+
+/* Checks the session id and seckey like secp256k1_musig_nonce_gen and sets
+ * *pk_ser_ptr to the serialized aggregate public key of keyagg_cache (or NULL if
+ * keyagg_cache is NULL). Returns 0 if keyagg_cache is invalid. Otherwise sets
+ * *valid to whether the nonces are allowed to be used for signing. */
+static int secp256k1_musig_nonce_gen_prepare(const secp256k1_context* ctx, int *valid, unsigned char **pk_ser_ptr, unsigned char *pk_ser, const unsigned char *session_id32, const unsigned char *seckey, const secp256k1_musig_keyagg_cache *keyagg_cache) {
     secp256k1_keyagg_cache_internal cache_i;
-    secp256k1_scalar k[2];
-    secp256k1_ge nonce_pt[2];
     int i;
-    unsigned char pk_ser[32];
-    unsigned char *pk_ser_ptr = NULL;
-    int ret = 1;
 
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(secnonce != NULL);
-    memset(secnonce, 0, sizeof(*secnonce));
-    ARG_CHECK(pubnonce != NULL);
-    memset(pubnonce, 0, sizeof(*pubnonce));
-    ARG_CHECK(session_id32 != NULL);
-    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    *valid = 1;
     if (seckey == NULL) {
         /* Check in constant time that the session_id is not 0 as a
          * defense-in-depth measure that may protect against a faulty RNG. */
@@ -289,17 +301,18 @@ int secp256k1_musig_nonce_gen(const secp256k1_context* ctx, secp256k1_musig_secn
         for (i = 0; i < 32; i++) {
             acc |= session_id32[i];
         }
-        ret &= !!acc;
+        *valid &= !!acc;
         memset(&acc, 0, sizeof(acc));
     }
 
     /* Check that the seckey is valid to be able to sign for it later. */
     if (seckey != NULL) {
         secp256k1_scalar sk;
-        ret &= secp256k1_scalar_set_b32_seckey(&sk, seckey);
+        *valid &= secp256k1_scalar_set_b32_seckey(&sk, seckey);
         secp256k1_scalar_clear(&sk);
     }
 
+    *pk_ser_ptr = NULL;
     if (keyagg_cache != NULL) {
         int ret_tmp;
         if (!secp256k1_keyagg_cache_load(ctx, &cache_i, keyagg_cache)) {
@@ -308,7 +321,28 @@ int secp256k1_musig_nonce_gen(const secp256k1_context* ctx, secp256k1_musig_secn
         ret_tmp = secp256k1_xonly_ge_serialize(pk_ser, &cache_i.pk);
         /* Serialization can not fail because the loaded point can not be infinity. */
         VERIFY_CHECK(ret_tmp);
-        pk_ser_ptr = pk_ser;
+        *pk_ser_ptr = pk_ser;
+    }
+    return 1;
+}
+
+int secp256k1_musig_nonce_gen(const secp256k1_context* ctx, secp256k1_musig_secnonce *secnonce, secp256k1_musig_pubnonce *pubnonce, const unsigned char *session_id32, const unsigned char *seckey, const unsigned char *msg32, const secp256k1_musig_keyagg_cache *keyagg_cache, const unsigned char *extra_input32) {
+    secp256k1_scalar k[2];
+    secp256k1_ge nonce_pt[2];
+    int i;
+    unsigned char pk_ser[32];
+    unsigned char *pk_ser_ptr;
+    int ret;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secnonce != NULL);
+    memset(secnonce, 0, sizeof(*secnonce));
+    ARG_CHECK(pubnonce != NULL);
+    memset(pubnonce, 0, sizeof(*pubnonce));
+    ARG_CHECK(session_id32 != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    if (!secp256k1_musig_nonce_gen_prepare(ctx, &ret, &pk_ser_ptr, pk_ser, session_id32, seckey, keyagg_cache)) {
+        return 0;
     }
     secp256k1_nonce_function_musig(k, session_id32, msg32, seckey, pk_ser_ptr, extra_input32);
     VERIFY_CHECK(!secp256k1_scalar_is_zero(&k[0]));
@@ -329,6 +363,124 @@ int secp256k1_musig_nonce_gen(const secp256k1_context* ctx, secp256k1_musig_secn
     return ret;
 }
 
+/* Number of nonces whose hashes and points are computed together by
+ * secp256k1_musig_nonce_gen_batch. */
+#define SECP256K1_MUSIG_NONCE_GEN_BATCH 8
+
+/* Derives the session ids of the n nonces starting at index offset from
+ * base, which holds the tagged hash state after writing the seed. */
+static void secp256k1_musig_batch_session_ids(unsigned char *session_ids, const secp256k1_sha256 *base, uint64_t offset, size_t n) {
+    unsigned char ctrs[SECP256K1_MUSIG_NONCE_GEN_BATCH][8];
+    const unsigned char *ctr_ptrs[SECP256K1_MUSIG_NONCE_GEN_BATCH];
+    size_t i;
+    int j;
+    VERIFY_CHECK(n <= SECP256K1_MUSIG_NONCE_GEN_BATCH);
+
+    for (i = 0; i < n; i++) {
+        uint64_t ctr = offset + i;
+        for (j = 7; j >= 0; j--) {
+            ctrs[i][j] = ctr & 0xff;
+            ctr >>= 8;
+        }
+        ctr_ptrs[i] = ctrs[i];
+    }
+    secp256k1_sha256_finalize_multi(session_ids, base, ctr_ptrs, 8, n);
+}
+
+int secp256k1_musig_nonce_gen_batch(const secp256k1_context* ctx, secp256k1_musig_secnonce *secnonces, secp256k1_musig_pubnonce *pubnonces, const unsigned char *session_id_seed32, size_t n_nonces, const unsigned char *seckey, const unsigned char *msg32, const secp256k1_musig_keyagg_cache *keyagg_cache, const unsigned char *extra_input32) {
+    secp256k1_sha256 id_sha, nonce_sha, k_sha;
+    unsigned char session_ids[SECP256K1_MUSIG_NONCE_GEN_BATCH * 32];
+    unsigned char nonce_in[SECP256K1_MUSIG_NONCE_GEN_BATCH][32 + 132];
+    const unsigned char *nonce_in_ptrs[SECP256K1_MUSIG_NONCE_GEN_BATCH];
+    unsigned char seeds[SECP256K1_MUSIG_NONCE_GEN_BATCH * 32];
+    unsigned char k_in[2 * SECP256K1_MUSIG_NONCE_GEN_BATCH][33];
+    const unsigned char *k_in_ptrs[2 * SECP256K1_MUSIG_NONCE_GEN_BATCH];
+    unsigned char k_ser[2 * SECP256K1_MUSIG_NONCE_GEN_BATCH * 32];
+    secp256k1_gej nonce_ptj[2 * SECP256K1_MUSIG_NONCE_GEN_BATCH];
+    secp256k1_ge nonce_pt[2 * SECP256K1_MUSIG_NONCE_GEN_BATCH];
+    unsigned char inputs[132];
+    size_t inputs_len;
+    unsigned char pk_ser[32];
+    unsigned char *pk_ser_ptr;
+    size_t i, j;
+    int ret;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secnonces != NULL || n_nonces == 0);
+    ARG_CHECK(pubnonces != NULL || n_nonces == 0);
+    for (i = 0; i < n_nonces; i++) {
+        memset(&secnonces[i], 0, sizeof(secnonces[i]));
+        memset(&pubnonces[i], 0, sizeof(pubnonces[i]));
+    }
+    ARG_CHECK(session_id_seed32 != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    if (!secp256k1_musig_nonce_gen_prepare(ctx, &ret, &pk_ser_ptr, pk_ser, session_id_seed32, seckey, keyagg_cache)) {
+        return 0;
+    }
+
+    secp256k1_sha256_initialize_tagged_musig_batch_session_id(&id_sha);
+    secp256k1_sha256_write(&id_sha, session_id_seed32, 32);
+    secp256k1_sha256_initialize_tagged_musig_nonce(&nonce_sha);
+    secp256k1_sha256_initialize(&k_sha);
+    inputs_len = secp256k1_nonce_function_musig_inputs(inputs, msg32, seckey, pk_ser_ptr, extra_input32);
+    for (i = 0; i < SECP256K1_MUSIG_NONCE_GEN_BATCH; i++) {
+        memcpy(&nonce_in[i][32], inputs, inputs_len);
+        nonce_in_ptrs[i] = nonce_in[i];
+        for (j = 0; j < 2; j++) {
+            k_in[2 * i + j][32] = j;
+            k_in_ptrs[2 * i + j] = k_in[2 * i + j];
+        }
+    }
+
+    for (i = 0; i < n_nonces; i += SECP256K1_MUSIG_NONCE_GEN_BATCH) {
+        size_t n = n_nonces - i < SECP256K1_MUSIG_NONCE_GEN_BATCH ? n_nonces - i : SECP256K1_MUSIG_NONCE_GEN_BATCH;
+
+        /* The hashes of secp256k1_nonce_function_musig, computed side by
+         * side for the n nonces. */
+        secp256k1_musig_batch_session_ids(session_ids, &id_sha, i, n);
+        for (j = 0; j < n; j++) {
+            memcpy(nonce_in[j], &session_ids[32 * j], 32);
+        }
+        secp256k1_sha256_finalize_multi(seeds, &nonce_sha, nonce_in_ptrs, 32 + inputs_len, n);
+        for (j = 0; j < 2 * n; j++) {
+            memcpy(k_in[j], &seeds[32 * (j / 2)], 32);
+        }
+        secp256k1_sha256_finalize_multi(k_ser, &k_sha, k_in_ptrs, 33, 2 * n);
+
+        for (j = 0; j < n; j++) {
+            secp256k1_scalar k[2];
+            secp256k1_scalar_set_b32(&k[0], &k_ser[64 * j], NULL);
+            secp256k1_scalar_set_b32(&k[1], &k_ser[64 * j + 32], NULL);
+            VERIFY_CHECK(!secp256k1_scalar_is_zero(&k[0]));
+            VERIFY_CHECK(!secp256k1_scalar_is_zero(&k[1]));
+            VERIFY_CHECK(!secp256k1_scalar_eq(&k[0], &k[1]));
+            secp256k1_musig_secnonce_save(&secnonces[i + j], k);
+            secp256k1_musig_secnonce_invalidate(ctx, &secnonces[i + j], !ret);
+            secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &nonce_ptj[2 * j], &k[0]);
+            secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &nonce_ptj[2 * j + 1], &k[1]);
+            secp256k1_scalar_clear(&k[0]);
+            secp256k1_scalar_clear(&k[1]);
+        }
+        /* The nonce points won't be infinity because k != 0 with overwhelming
+         * probability. A single inversion brings all of them to affine
+         * coordinates. */
+        secp256k1_ge_set_all_gej(nonce_pt, nonce_ptj, 2 * n);
+        secp256k1_declassify(ctx, nonce_pt, 2 * n * sizeof(*nonce_pt));
+        for (j = 0; j < n; j++) {
+            secp256k1_musig_pubnonce_save(&pubnonces[i + j], &nonce_pt[2 * j]);
+        }
+    }
+    memset(session_ids, 0, sizeof(session_ids));
+    memset(nonce_in, 0, sizeof(nonce_in));
+    memset(seeds, 0, sizeof(seeds));
+    memset(k_in, 0, sizeof(k_in));
+    memset(k_ser, 0, sizeof(k_ser));
+    memset(inputs, 0, sizeof(inputs));
+    memset(nonce_ptj, 0, sizeof(nonce_ptj));
+    memset(&id_sha, 0, sizeof(id_sha));
+    return ret;
+}
+
 static int secp256k1_musig_sum_nonces(const secp256k1_context* ctx, secp256k1_gej *summed_nonces, const secp256k1_musig_pubnonce * const* pubnonces, size_t n_pubnonces) {
     size_t i;
     int j;
@@ -378,7 +530,7 @@ static int secp256k1_musig_compute_noncehash(unsigned char *noncehash, secp256k1
     secp256k1_sha256 sha;
     int i;
 
-    secp256k1_sha256_initialize_tagged(&sha, (unsigned char*)"MuSig/noncecoef", sizeof("MuSig/noncecoef") - 1);
+    secp256k1_sha256_initialize_tagged_musig_noncecoef(&sha);
     for (i = 0; i < 2; i++) {
         size_t size;
         if (!secp256k1_eckey_pubkey_serialize(&aggnonce[i], buf, &size, 1)) {
@@ -617,47 +769,32 @@ int secp256k1_musig_partial_sign(const secp256k1_context* ctx, secp256k1_musig_p
     return 1;
 }
 
-int secp256k1_musig_partial_sig_verify(const secp256k1_context* ctx, const secp256k1_musig_partial_sig *partial_sig, const secp256k1_musig_pubnonce *pubnonce, const secp256k1_xonly_pubkey *pubkey, const secp256k1_musig_keyagg_cache *keyagg_cache, const secp256k1_musig_session *session) {
-    secp256k1_keyagg_cache_internal cache_i;
-    secp256k1_musig_session_internal session_i;
-    secp256k1_scalar mu, e, s;
-    secp256k1_gej pkj;
-    secp256k1_ge nonce_pt[2];
-    secp256k1_gej rj;
-    secp256k1_gej tmp;
-    secp256k1_ge pkp;
-
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(partial_sig != NULL);
-    ARG_CHECK(pubnonce != NULL);
-    ARG_CHECK(pubkey != NULL);
-    ARG_CHECK(keyagg_cache != NULL);
-    ARG_CHECK(session != NULL);
+/* Loads the signer's public key and public nonce and computes the scalars of
+ * the partial signature verification equation
+ *
+ *   s*G = e*P + nonce_pt[0] + b*nonce_pt[1]
+ *
+ * where b is the nonce coefficient of the session. The KeyAgg coefficient and
+ * the signs that depend on the parities of the aggregate key and the final
+ * nonce are folded into e and nonce_pt. */
+static int secp256k1_musig_partial_sig_verify_load(const secp256k1_context* ctx, secp256k1_scalar *e, secp256k1_ge *pkp, secp256k1_ge *nonce_pt, const secp256k1_musig_pubnonce *pubnonce, const secp256k1_xonly_pubkey *pubkey, const secp256k1_keyagg_cache_internal *cache_i, const secp256k1_musig_session_internal *session_i) {
+    secp256k1_scalar mu;
 
-    if (!secp256k1_musig_session_load(ctx, &session_i, session)) {
-        return 0;
-    }
-
-    /* Compute "effective" nonce rj = aggnonce[0] + b*aggnonce[1] */
-    /* TODO: use multiexp to compute -s*G + e*mu*pubkey + aggnonce[0] + b*aggnonce[1] */
     if (!secp256k1_musig_pubnonce_load(ctx, nonce_pt, pubnonce)) {
         return 0;
     }
-    secp256k1_gej_set_ge(&rj, &nonce_pt[1]);
-    secp256k1_ecmult(&rj, &rj, &session_i.noncecoef, NULL);
-    secp256k1_gej_add_ge_var(&rj, &rj, &nonce_pt[0], NULL);
-
-    if (!secp256k1_xonly_pubkey_load(ctx, &pkp, pubkey)) {
-        return 0;
+    if (session_i->fin_nonce_parity) {
+        secp256k1_ge_neg(&nonce_pt[0], &nonce_pt[0]);
+        secp256k1_ge_neg(&nonce_pt[1], &nonce_pt[1]);
     }
-    if (!secp256k1_keyagg_cache_load(ctx, &cache_i, keyagg_cache)) {
+    if (!secp256k1_xonly_pubkey_load(ctx, pkp, pubkey)) {
         return 0;
     }
     /* Multiplying the challenge by the KeyAgg coefficient is equivalent
      * to multiplying the signer's public key by the coefficient, except
      * much easier to do. */
-    secp256k1_musig_keyaggcoef(&mu, &cache_i, &pkp.x);
-    secp256k1_scalar_mul(&e, &session_i.challenge, &mu);
+    secp256k1_musig_keyaggcoef(&mu, cache_i, &pkp->x);
+    secp256k1_scalar_mul(e, &session_i->challenge, &mu);
 
     /* When producing a partial signature, signer i uses a possibly
      * negated secret key:
@@ -695,26 +832,183 @@ int secp256k1_musig_partial_sig_verify(const secp256k1_context* ctx, const secp2
      * which will have the same end result as negating |P[i]|, since they are
      * multiplied later anyway.
      */
-    if (secp256k1_fe_is_odd(&cache_i.pk.y)
-            != cache_i.internal_key_parity) {
-        secp256k1_scalar_negate(&e, &e);
+    if (secp256k1_fe_is_odd(&cache_i->pk.y)
+            != cache_i->internal_key_parity) {
+        secp256k1_scalar_negate(e, e);
     }
+    return 1;
+}
 
+int secp256k1_musig_partial_sig_verify(const secp256k1_context* ctx, const secp256k1_musig_partial_sig *partial_sig, const secp256k1_musig_pubnonce *pubnonce, const secp256k1_xonly_pubkey *pubkey, const secp256k1_musig_keyagg_cache *keyagg_cache, const secp256k1_musig_session *session) {
+    secp256k1_keyagg_cache_internal cache_i;
+    secp256k1_musig_session_internal session_i;
+    secp256k1_scalar s;
+    secp256k1_scalar na[2];
+    secp256k1_ge nonce_pt[2];
+    secp256k1_ge pkp;
+    secp256k1_gej a[2];
+    secp256k1_gej tmp;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(partial_sig != NULL);
+    ARG_CHECK(pubnonce != NULL);
+    ARG_CHECK(pubkey != NULL);
+    ARG_CHECK(keyagg_cache != NULL);
+    ARG_CHECK(session != NULL);
+
+    if (!secp256k1_musig_session_load(ctx, &session_i, session)) {
+        return 0;
+    }
+    if (!secp256k1_keyagg_cache_load(ctx, &cache_i, keyagg_cache)) {
+        return 0;
+    }
+    if (!secp256k1_musig_partial_sig_verify_load(ctx, &na[0], &pkp, nonce_pt, pubnonce, pubkey, &cache_i, &session_i)) {
+        return 0;
+    }
     if (!secp256k1_musig_partial_sig_load(ctx, &s, partial_sig)) {
         return 0;
     }
-    /* Compute -s*G + e*pkj + rj (e already includes the keyagg coefficient mu) */
+
+    /* Compute -s*G + e*P + b*nonce_pt[1] in a single multiexp and add nonce_pt[0] */
     secp256k1_scalar_negate(&s, &s);
-    secp256k1_gej_set_ge(&pkj, &pkp);
-    secp256k1_ecmult(&tmp, &pkj, &e, &s);
-    if (session_i.fin_nonce_parity) {
-        secp256k1_gej_neg(&rj, &rj);
-    }
-    secp256k1_gej_add_var(&tmp, &tmp, &rj, NULL);
+    secp256k1_gej_set_ge(&a[0], &pkp);
+    secp256k1_gej_set_ge(&a[1], &nonce_pt[1]);
+    na[1] = session_i.noncecoef;
+    secp256k1_ecmult_multi_small(&tmp, 2, a, na, &s);
+    secp256k1_gej_add_ge_var(&tmp, &tmp, &nonce_pt[0], NULL);
 
     return secp256k1_gej_is_infinity(&tmp);
 }
 
+typedef struct {
+    const secp256k1_context *ctx;
+    unsigned char seed[32];
+    const secp256k1_musig_pubnonce * const *pubnonces;
+    const secp256k1_xonly_pubkey * const *pubkeys;
+    const secp256k1_keyagg_cache_internal *cache_i;
+    const secp256k1_musig_session_internal *session_i;
+    /* Points and scalar of the signer loaded last */
+    size_t loaded;
+    secp256k1_ge pkp;
+    secp256k1_ge nonce_pt[2];
+    secp256k1_scalar e;
+} secp256k1_musig_partial_sig_verify_batch_data;
+
+/* Callback for secp256k1_ecmult_multi_var. Points 3*i, 3*i + 1 and 3*i + 2
+ * are P_i, nonce_pt_i[0] and nonce_pt_i[1] with scalars a_i*e_i, a_i and
+ * a_i*b. The points of a signer are loaded when its first point is reached. */
+static int secp256k1_musig_partial_sig_verify_batch_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *cbdata) {
+    secp256k1_musig_partial_sig_verify_batch_data *data = (secp256k1_musig_partial_sig_verify_batch_data *) cbdata;
+    size_t i = idx / 3;
+
+    if (data->loaded != i) {
+        if (!secp256k1_musig_partial_sig_verify_load(data->ctx, &data->e, &data->pkp, data->nonce_pt, data->pubnonces[i], data->pubkeys[i], data->cache_i, data->session_i)) {
+            return 0;
+        }
+        data->loaded = i;
+    }
+    secp256k1_scalar_batch_randomizer(sc, data->seed, i);
+    switch (idx % 3) {
+    case 0:
+        secp256k1_scalar_mul(sc, sc, &data->e);
+        *pt = data->pkp;
+        break;
+    case 1:
+        *pt = data->nonce_pt[0];
+        break;
+    default:
+        secp256k1_scalar_mul(sc, sc, &data->session_i->noncecoef);
+        *pt = data->nonce_pt[1];
+    }
+    return 1;
+}
+
+/* Checks -(sum a_i*s_i)*G + sum a_i*(e_i*P_i + nonce_pt_i[0] + b*nonce_pt_i[1]) = 0,
+ * which weights the verification equation of signer i with its randomizer a_i. */
+static int secp256k1_musig_partial_sig_verify_batch_internal(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, const secp256k1_musig_partial_sig * const *partial_sigs, const secp256k1_musig_pubnonce * const *pubnonces, const secp256k1_xonly_pubkey * const *pubkeys, const secp256k1_musig_keyagg_cache *keyagg_cache, const secp256k1_musig_session *session, size_t n_sigs) {
+    secp256k1_musig_partial_sig_verify_batch_data data;
+    secp256k1_keyagg_cache_internal cache_i;
+    secp256k1_musig_session_internal session_i;
+    secp256k1_sha256 sha;
+    secp256k1_scalar sum;
+    secp256k1_gej rj;
+    size_t i;
+
+    if (!secp256k1_musig_session_load(ctx, &session_i, session)) {
+        return 0;
+    }
+    if (!secp256k1_keyagg_cache_load(ctx, &cache_i, keyagg_cache)) {
+        return 0;
+    }
+
+    /* The seed covers the session, the key aggregation cache and every
+     * signer's partial signature, nonce and public key. */
+    secp256k1_sha256_initialize_tagged_musig_partial_sig_batch(&sha);
+    secp256k1_sha256_write(&sha, session->data, sizeof(session->data));
+    secp256k1_sha256_write(&sha, keyagg_cache->data, sizeof(keyagg_cache->data));
+    for (i = 0; i < n_sigs; i++) {
+        secp256k1_sha256_write(&sha, partial_sigs[i]->data, sizeof(partial_sigs[i]->data));
+        secp256k1_sha256_write(&sha, pubnonces[i]->data, sizeof(pubnonces[i]->data));
+        secp256k1_sha256_write(&sha, pubkeys[i]->data, sizeof(pubkeys[i]->data));
+    }
+    secp256k1_sha256_finalize(&sha, data.seed);
+
+    secp256k1_scalar_clear(&sum);
+    for (i = 0; i < n_sigs; i++) {
+        secp256k1_scalar s;
+        secp256k1_scalar a;
+        if (!secp256k1_musig_partial_sig_load(ctx, &s, partial_sigs[i])) {
+            return 0;
+        }
+        secp256k1_scalar_batch_randomizer(&a, data.seed, i);
+        secp256k1_scalar_mul(&s, &s, &a);
+        secp256k1_scalar_add(&sum, &sum, &s);
+    }
+    secp256k1_scalar_negate(&sum, &sum);
+
+    data.ctx = ctx;
+    data.pubnonces = pubnonces;
+    data.pubkeys = pubkeys;
+    data.cache_i = &cache_i;
+    data.session_i = &session_i;
+    data.loaded = SIZE_MAX;
+    if (!secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &rj, &sum, secp256k1_musig_partial_sig_verify_batch_callback, (void *) &data, 3 * n_sigs)) {
+        return 0;
+    }
+    return secp256k1_gej_is_infinity(&rj);
+}
+
+int secp256k1_musig_partial_sig_verify_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index, const secp256k1_musig_partial_sig * const *partial_sigs, const secp256k1_musig_pubnonce * const *pubnonces, const secp256k1_xonly_pubkey * const *pubkeys, const secp256k1_musig_keyagg_cache *keyagg_cache, const secp256k1_musig_session *session, size_t n_sigs) {
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_sigs == 0 || partial_sigs != NULL);
+    ARG_CHECK(n_sigs == 0 || pubnonces != NULL);
+    ARG_CHECK(n_sigs == 0 || pubkeys != NULL);
+    ARG_CHECK(keyagg_cache != NULL);
+    ARG_CHECK(session != NULL);
+    ARG_CHECK(n_sigs <= SIZE_MAX / 3);
+    for (i = 0; i < n_sigs; i++) {
+        ARG_CHECK(partial_sigs[i] != NULL);
+        ARG_CHECK(pubnonces[i] != NULL);
+        ARG_CHECK(pubkeys[i] != NULL);
+    }
+
+    if (secp256k1_musig_partial_sig_verify_batch_internal(ctx, scratch, partial_sigs, pubnonces, pubkeys, keyagg_cache, session, n_sigs)) {
+        return 1;
+    }
+    if (failed_index != NULL) {
+        /* Verify individually to find the culprit, as documented for failed_index. */
+        for (i = 0; i < n_sigs; i++) {
+            if (!secp256k1_musig_partial_sig_verify(ctx, partial_sigs[i], pubnonces[i], pubkeys[i], keyagg_cache, session)) {
+                break;
+            }
+        }
+        *failed_index = i;
+    }
+    return 0;
+}
+
 int secp256k1_musig_partial_sig_agg(const secp256k1_context* ctx, unsigned char *sig64, const secp256k1_musig_session *session, const secp256k1_musig_partial_sig * const* partial_sigs, size_t n_sigs) {
     size_t i;
     secp256k1_musig_session_internal session_i;
@@ -80,6 +80,61 @@ void musig_simple_test(secp256k1_scratch_space *scratch) {
     CHECK(secp256k1_schnorrsig_verify(ctx, final_sig, msg, sizeof(msg), &agg_pk) == 1);
 }
 
+/* Check that batch verification of the partial signatures of a session agrees
+ * with verifying them one by one. */
+void musig_partial_sig_verify_batch_test(secp256k1_scratch_space *scratch) {
+    enum { N_SIGNERS = 10 };
+    unsigned char sk[32];
+    unsigned char session_id[32];
+    unsigned char msg[32];
+    secp256k1_keypair keypair[N_SIGNERS];
+    secp256k1_xonly_pubkey pk[N_SIGNERS];
+    const secp256k1_xonly_pubkey *pk_ptr[N_SIGNERS];
+    secp256k1_musig_secnonce secnonce[N_SIGNERS];
+    secp256k1_musig_pubnonce pubnonce[N_SIGNERS];
+    const secp256k1_musig_pubnonce *pubnonce_ptr[N_SIGNERS];
+    secp256k1_musig_partial_sig partial_sig[N_SIGNERS];
+    const secp256k1_musig_partial_sig *partial_sig_ptr[N_SIGNERS];
+    secp256k1_musig_partial_sig tmp;
+    secp256k1_musig_aggnonce aggnonce;
+    secp256k1_musig_keyagg_cache keyagg_cache;
+    secp256k1_musig_session session;
+    size_t n_signers = 1 + secp256k1_testrand_int(N_SIGNERS);
+    size_t failed_index;
+    size_t i;
+
+    secp256k1_testrand256(msg);
+    for (i = 0; i < n_signers; i++) {
+        secp256k1_testrand256(session_id);
+        secp256k1_testrand256(sk);
+        CHECK(create_keypair_and_pk(&keypair[i], &pk[i], sk));
+        CHECK(secp256k1_musig_nonce_gen(ctx, &secnonce[i], &pubnonce[i], session_id, sk, NULL, NULL, NULL) == 1);
+        pk_ptr[i] = &pk[i];
+        pubnonce_ptr[i] = &pubnonce[i];
+        partial_sig_ptr[i] = &partial_sig[i];
+    }
+    CHECK(secp256k1_musig_pubkey_agg(ctx, scratch, NULL, &keyagg_cache, pk_ptr, n_signers) == 1);
+    CHECK(secp256k1_musig_nonce_agg(ctx, &aggnonce, pubnonce_ptr, n_signers) == 1);
+    CHECK(secp256k1_musig_nonce_process(ctx, &session, &aggnonce, msg, &keyagg_cache, NULL) == 1);
+    for (i = 0; i < n_signers; i++) {
+        CHECK(secp256k1_musig_partial_sign(ctx, &partial_sig[i], &secnonce[i], &keypair[i], &keyagg_cache, &session) == 1);
+    }
+
+    CHECK(secp256k1_musig_partial_sig_verify_batch(ctx, scratch, &failed_index, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, n_signers) == 1);
+    CHECK(secp256k1_musig_partial_sig_verify_batch(ctx, NULL, &failed_index, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, n_signers) == 1);
+
+    /* Replace a partial signature by one of another signer */
+    i = secp256k1_testrand_int(n_signers);
+    tmp = partial_sig[i];
+    partial_sig[i] = partial_sig[(i + 1) % n_signers];
+    if (n_signers > 1) {
+        CHECK(secp256k1_musig_partial_sig_verify_batch(ctx, scratch, &failed_index, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, n_signers) == 0);
+        CHECK(failed_index == i);
+    }
+    partial_sig[i] = tmp;
+    CHECK(secp256k1_musig_partial_sig_verify_batch(ctx, scratch, &failed_index, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, n_signers) == 1);
+}
+
 void pubnonce_summing_to_inf(secp256k1_musig_pubnonce *pubnonce) {
     secp256k1_ge ge[2];
     int i;
@@ -529,6 +584,39 @@ void musig_api_tests(secp256k1_scratch_space *scratch) {
     CHECK(secp256k1_musig_partial_sig_verify(vrfy, &partial_sig[0], &pubnonce[0], &pk[0], &keyagg_cache, &session) == 1);
     CHECK(secp256k1_musig_partial_sig_verify(vrfy, &partial_sig[1], &pubnonce[1], &pk[1], &keyagg_cache, &session) == 1);
 
+    /** Batch partial signature verification */
+    ecount = 0;
+    {
+        const secp256k1_musig_pubnonce *swapped_pubnonce_ptr[2];
+        size_t failed_index;
+        swapped_pubnonce_ptr[0] = &pubnonce[1];
+        swapped_pubnonce_ptr[1] = &pubnonce[0];
+        CHECK(secp256k1_musig_partial_sig_verify_batch(none, scratch, &failed_index, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, 2) == 1);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, NULL, NULL, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, 2) == 1);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, NULL, NULL, NULL, &keyagg_cache, &session, 0) == 1);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, &failed_index, partial_sig_ptr, swapped_pubnonce_ptr, pk_ptr, &keyagg_cache, &session, 2) == 0);
+        CHECK(failed_index == 0);
+        CHECK(ecount == 0);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, NULL, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 1);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, invalid_partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 2);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, NULL, pk_ptr, &keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 3);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, NULL, &keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 4);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, invalid_pk_ptr2, &keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 5);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, pk_ptr, NULL, &session, 2) == 0);
+        CHECK(ecount == 6);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, pk_ptr, &invalid_keyagg_cache, &session, 2) == 0);
+        CHECK(ecount == 7);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, NULL, 2) == 0);
+        CHECK(ecount == 8);
+        CHECK(secp256k1_musig_partial_sig_verify_batch(vrfy, scratch, NULL, partial_sig_ptr, pubnonce_ptr, pk_ptr, &keyagg_cache, &invalid_session, 2) == 0);
+        CHECK(ecount == 9);
+    }
+
     /** Signature aggregation and verification */
     ecount = 0;
     CHECK(secp256k1_musig_partial_sig_agg(none, pre_sig, &session, partial_sig_ptr, 2) == 1);
@@ -664,6 +752,82 @@ void musig_nonce_test(void) {
     }
 }
 
+/* Check that secp256k1_musig_nonce_gen_batch outputs the same nonces as
+ * secp256k1_musig_nonce_gen with the derived session ids. */
+void musig_nonce_gen_batch_test(void) {
+    enum { N_NONCES = 20 };
+    secp256k1_musig_secnonce secnonce[N_NONCES];
+    secp256k1_musig_pubnonce pubnonce[N_NONCES];
+    secp256k1_musig_secnonce secnonce_i;
+    secp256k1_musig_pubnonce pubnonce_i;
+    secp256k1_musig_keyagg_cache keyagg_cache;
+    secp256k1_xonly_pubkey pk;
+    const secp256k1_xonly_pubkey *pk_ptr[1];
+    unsigned char seed[32];
+    unsigned char zeros32[32] = { 0 };
+    unsigned char sk[32];
+    unsigned char msg[32];
+    unsigned char extra_input[32];
+    const unsigned char *sk_ptr, *msg_ptr, *extra_input_ptr;
+    const secp256k1_musig_keyagg_cache *keyagg_cache_ptr;
+    secp256k1_context *sign = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
+    size_t n_nonces = secp256k1_testrand_int(N_NONCES + 1);
+    int ecount = 0;
+    size_t i;
+    int j;
+
+    secp256k1_context_set_illegal_callback(sign, counting_illegal_callback_fn, &ecount);
+    secp256k1_testrand256(seed);
+    secp256k1_testrand256(sk);
+    secp256k1_testrand256(msg);
+    secp256k1_testrand256(extra_input);
+    CHECK(create_keypair_and_pk(NULL, &pk, sk) == 1);
+    pk_ptr[0] = &pk;
+    CHECK(secp256k1_musig_pubkey_agg(ctx, NULL, NULL, &keyagg_cache, pk_ptr, 1) == 1);
+    sk_ptr = secp256k1_testrand_bits(1) ? sk : NULL;
+    msg_ptr = secp256k1_testrand_bits(1) ? msg : NULL;
+    keyagg_cache_ptr = secp256k1_testrand_bits(1) ? &keyagg_cache : NULL;
+    extra_input_ptr = secp256k1_testrand_bits(1) ? extra_input : NULL;
+
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, seed, n_nonces, sk_ptr, msg_ptr, keyagg_cache_ptr, extra_input_ptr) == 1);
+    for (i = 0; i < n_nonces; i++) {
+        secp256k1_sha256 sha;
+        unsigned char session_id[32];
+        unsigned char ctr[8];
+        for (j = 0; j < 8; j++) {
+            ctr[j] = (i >> (8 * (7 - j))) & 0xff;
+        }
+        secp256k1_sha256_initialize_tagged(&sha, (unsigned char*)"MuSig/batchsessionid", sizeof("MuSig/batchsessionid") - 1);
+        secp256k1_sha256_write(&sha, seed, sizeof(seed));
+        secp256k1_sha256_write(&sha, ctr, sizeof(ctr));
+        secp256k1_sha256_finalize(&sha, session_id);
+        CHECK(secp256k1_musig_nonce_gen(sign, &secnonce_i, &pubnonce_i, session_id, sk_ptr, msg_ptr, keyagg_cache_ptr, extra_input_ptr) == 1);
+        CHECK(secp256k1_memcmp_var(&secnonce[i], &secnonce_i, sizeof(secnonce_i)) == 0);
+        CHECK(secp256k1_memcmp_var(&pubnonce[i], &pubnonce_i, sizeof(pubnonce_i)) == 0);
+    }
+    CHECK(ecount == 0);
+
+    /* A zero seed is rejected without seckey, like a zero session id */
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, zeros32, 1, NULL, NULL, NULL, NULL) == 0);
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, zeros32, 1, sk, NULL, NULL, NULL) == 1);
+    /* An invalid seckey is rejected */
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, seed, 2, zeros32, NULL, NULL, NULL) == 0);
+    CHECK(ecount == 0);
+
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, NULL, NULL, seed, 0, NULL, NULL, NULL, NULL) == 1);
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, NULL, pubnonce, seed, 1, NULL, NULL, NULL, NULL) == 0);
+    CHECK(ecount == 1);
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, NULL, seed, 1, NULL, NULL, NULL, NULL) == 0);
+    CHECK(ecount == 2);
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, NULL, 1, NULL, NULL, NULL, NULL) == 0);
+    CHECK(ecount == 3);
+    memset(&keyagg_cache, 0, sizeof(keyagg_cache));
+    CHECK(secp256k1_musig_nonce_gen_batch(sign, secnonce, pubnonce, seed, 1, NULL, NULL, &keyagg_cache, NULL) == 0);
+    CHECK(ecount == 4);
+
+    secp256k1_context_destroy(sign);
+}
+
 void scriptless_atomic_swap(secp256k1_scratch_space *scratch) {
     /* Throughout this test "a" and "b" refer to two hypothetical blockchains,
      * while the indices 0 and 1 refer to the two signers. Here signer 0 is
@@ -911,6 +1075,195 @@ void musig_tweak_test(secp256k1_scratch_space *scratch) {
     }
 }
 
+/* Check that aggregating many, possibly repeated, keys matches summing
+ * keyaggcoef_i*P_i one key at a time, with and without scratch space. */
+void musig_keyagg_many_test(secp256k1_scratch_space *scratch) {
+    enum { N_PKS = 100 };
+    unsigned char sk[32];
+    secp256k1_xonly_pubkey pk[N_PKS];
+    const secp256k1_xonly_pubkey *pk_ptr[N_PKS];
+    secp256k1_musig_keyagg_cache keyagg_cache;
+    secp256k1_xonly_pubkey agg_pk;
+    secp256k1_xonly_pubkey agg_pk_scratch;
+    secp256k1_scratch_space *scratch_small;
+    secp256k1_keyagg_cache_internal cache_i;
+    secp256k1_gej sumj;
+    secp256k1_ge sum;
+    secp256k1_scalar zero;
+    size_t n_pks = 1 + secp256k1_testrand_int(N_PKS);
+    size_t i;
+
+    for (i = 0; i < n_pks; i++) {
+        if (i > 0 && secp256k1_testrand_bits(2) == 0) {
+            pk[i] = pk[secp256k1_testrand_int(i)];
+        } else {
+            secp256k1_testrand256(sk);
+            CHECK(create_keypair_and_pk(NULL, &pk[i], sk) == 1);
+        }
+        pk_ptr[i] = &pk[i];
+    }
+    CHECK(secp256k1_musig_pubkey_agg(ctx, NULL, &agg_pk, &keyagg_cache, pk_ptr, n_pks) == 1);
+    CHECK(secp256k1_keyagg_cache_load(ctx, &cache_i, &keyagg_cache) == 1);
+    CHECK(secp256k1_musig_pubkey_agg(ctx, scratch, &agg_pk_scratch, NULL, pk_ptr, n_pks) == 1);
+    CHECK(secp256k1_memcmp_var(&agg_pk, &agg_pk_scratch, sizeof(agg_pk)) == 0);
+    /* Room for the precomputed points and coefficients, but hardly for the multiexponentiation */
+    scratch_small = secp256k1_scratch_space_create(ctx, n_pks * (sizeof(secp256k1_ge) + sizeof(secp256k1_scalar)) + 256);
+    CHECK(secp256k1_musig_pubkey_agg(ctx, scratch_small, &agg_pk_scratch, NULL, pk_ptr, n_pks) == 1);
+    CHECK(secp256k1_memcmp_var(&agg_pk, &agg_pk_scratch, sizeof(agg_pk)) == 0);
+    secp256k1_scratch_space_destroy(ctx, scratch_small);
+    /* Room for the points but not the coefficients, which must leave the whole
+     * scratch space to the multiexponentiation */
+    scratch_small = secp256k1_scratch_space_create(ctx, n_pks * sizeof(secp256k1_ge) + ALIGNMENT);
+    CHECK(secp256k1_musig_pubkey_agg(ctx, scratch_small, &agg_pk_scratch, NULL, pk_ptr, n_pks) == 1);
+    CHECK(secp256k1_memcmp_var(&agg_pk, &agg_pk_scratch, sizeof(agg_pk)) == 0);
+    CHECK(scratch_small->alloc_size == 0);
+    secp256k1_scratch_space_destroy(ctx, scratch_small);
+
+    secp256k1_scalar_set_int(&zero, 0);
+    secp256k1_gej_set_infinity(&sumj);
+    for (i = 0; i < n_pks; i++) {
+        secp256k1_ge pt;
+        secp256k1_gej ptj;
+        secp256k1_scalar coef;
+        CHECK(secp256k1_xonly_pubkey_load(ctx, &pt, &pk[i]) == 1);
+        secp256k1_musig_keyaggcoef(&coef, &cache_i, &pt.x);
+        secp256k1_gej_set_ge(&ptj, &pt);
+        secp256k1_ecmult(&ptj, &ptj, &coef, &zero);
+        secp256k1_gej_add_var(&sumj, &sumj, &ptj, NULL);
+    }
+    secp256k1_ge_set_gej(&sum, &sumj);
+    ge_equals_ge(&sum, &cache_i.pk);
+}
+
+/* Check that a key aggregation state gives the same results as
+ * secp256k1_musig_pubkey_agg while keys are replaced, inserted and removed. */
+void musig_keyagg_state_test(secp256k1_scratch_space *scratch) {
+    enum { N_PKS = 40 };
+    unsigned char sk[32];
+    secp256k1_xonly_pubkey pk[N_PKS];
+    const secp256k1_xonly_pubkey *pk_ptr[N_PKS];
+    secp256k1_xonly_pubkey new_pk;
+    secp256k1_xonly_pubkey invalid_pk;
+    secp256k1_musig_keyagg_state *state;
+    secp256k1_musig_keyagg_state *state2;
+    secp256k1_musig_keyagg_cache keyagg_cache;
+    secp256k1_musig_keyagg_cache keyagg_cache_state;
+    secp256k1_xonly_pubkey agg_pk;
+    secp256k1_xonly_pubkey agg_pk_state;
+    unsigned char ser[32 * N_PKS];
+    unsigned char ser2[32 * N_PKS];
+    size_t serlen, serlen2;
+    size_t n_pks = 1 + secp256k1_testrand_int(N_PKS / 2);
+    secp256k1_context *vrfy = secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
+    int ecount = 0;
+    size_t i, j;
+
+    secp256k1_context_set_illegal_callback(vrfy, counting_illegal_callback_fn, &ecount);
+    memset(&invalid_pk, 0, sizeof(invalid_pk));
+    for (i = 0; i < n_pks; i++) {
+        secp256k1_testrand256(sk);
+        CHECK(create_keypair_and_pk(NULL, &pk[i], sk) == 1);
+        pk_ptr[i] = &pk[i];
+    }
+
+    /** API **/
+    CHECK(secp256k1_musig_keyagg_state_create(vrfy, NULL, 1) == NULL);
+    CHECK(ecount == 1);
+    state = secp256k1_musig_keyagg_state_create(vrfy, NULL, 0);
+    CHECK(state != NULL);
+    CHECK(secp256k1_musig_keyagg_state_agg(vrfy, scratch, &agg_pk_state, NULL, state) == 0);
+    CHECK(ecount == 2);
+    CHECK(secp256k1_musig_keyagg_state_set_pubkey(vrfy, state, 0, &pk[0]) == 0);
+    CHECK(ecount == 3);
+    CHECK(secp256k1_musig_keyagg_state_remove_pubkey(vrfy, state, 0) == 0);
+    CHECK(ecount == 4);
+    CHECK(secp256k1_musig_keyagg_state_insert_pubkey(vrfy, state, 1, &pk[0]) == 0);
+    CHECK(ecount == 5);
+    CHECK(secp256k1_musig_keyagg_state_insert_pubkey(vrfy, state, 0, &invalid_pk) == 0);
+    CHECK(ecount == 6);
+    CHECK(secp256k1_musig_keyagg_state_insert_pubkey(vrfy, state, 0, &pk[0]) == 1);
+    CHECK(secp256k1_musig_keyagg_state_set_pubkey(vrfy, state, 0, &invalid_pk) == 0);
+    CHECK(ecount == 7);
+    serlen = 31;
+    CHECK(secp256k1_musig_keyagg_state_serialize(vrfy, ser, &serlen, state) == 0);
+    serlen = 32;
+    CHECK(secp256k1_musig_keyagg_state_serialize(vrfy, ser, &serlen, state) == 1);
+    CHECK(secp256k1_musig_keyagg_state_parse(vrfy, ser, 31) == NULL);
+    CHECK(ecount == 7);
+    CHECK(secp256k1_musig_keyagg_state_parse(vrfy, NULL, 32) == NULL);
+    CHECK(ecount == 8);
+    memset(ser, 0xff, 32);
+    CHECK(secp256k1_musig_keyagg_state_parse(vrfy, ser, 32) == NULL);
+    CHECK(ecount == 8);
+    secp256k1_musig_keyagg_state_destroy(state);
+    secp256k1_musig_keyagg_state_destroy(NULL);
+
+    /** Random updates **/
+    state = secp256k1_musig_keyagg_state_create(ctx, pk_ptr, n_pks);
+    CHECK(state != NULL);
+    for (i = 0; i < 20; i++) {
+        CHECK(secp256k1_musig_pubkey_agg(ctx, NULL, &agg_pk, &keyagg_cache, pk_ptr, n_pks) == 1);
+        CHECK(secp256k1_musig_keyagg_state_agg(ctx, i % 2 ? scratch : NULL, &agg_pk_state, &keyagg_cache_state, state) == 1);
+        CHECK(secp256k1_memcmp_var(&agg_pk, &agg_pk_state, sizeof(agg_pk)) == 0);
+        CHECK(secp256k1_memcmp_var(&keyagg_cache, &keyagg_cache_state, sizeof(keyagg_cache)) == 0);
+
+        /* Repeat a key sometimes, so that the second key changes */
+        if (secp256k1_testrand_bits(2) == 0) {
+            new_pk = pk[secp256k1_testrand_int(n_pks)];
+        } else {
+            secp256k1_testrand256(sk);
+            CHECK(create_keypair_and_pk(NULL, &new_pk, sk) == 1);
+        }
+        switch (secp256k1_testrand_int(n_pks > 1 ? 3 : 2)) {
+        case 0:
+            j = secp256k1_testrand_int(n_pks);
+            pk[j] = new_pk;
+            CHECK(secp256k1_musig_keyagg_state_set_pubkey(ctx, state, j, &new_pk) == 1);
+            break;
+        case 1:
+            if (n_pks == N_PKS) {
+                break;
+            }
+            j = secp256k1_testrand_int(n_pks + 1);
+            memmove(&pk[j + 1], &pk[j], (n_pks - j) * sizeof(pk[0]));
+            pk[j] = new_pk;
+            pk_ptr[n_pks] = &pk[n_pks];
+            n_pks++;
+            CHECK(secp256k1_musig_keyagg_state_insert_pubkey(ctx, state, j, &new_pk) == 1);
+            break;
+        case 2:
+            j = secp256k1_testrand_int(n_pks);
+            memmove(&pk[j], &pk[j + 1], (n_pks - j - 1) * sizeof(pk[0]));
+            n_pks--;
+            CHECK(secp256k1_musig_keyagg_state_remove_pubkey(ctx, state, j) == 1);
+            break;
+        }
+    }
+
+    /* Serialization round trip */
+    serlen = sizeof(ser);
+    CHECK(secp256k1_musig_keyagg_state_serialize(ctx, ser, &serlen, state) == 1);
+    CHECK(serlen == 32 * n_pks);
+    for (i = 0; i < n_pks; i++) {
+        unsigned char pk_ser[32];
+        CHECK(secp256k1_xonly_pubkey_serialize(ctx, pk_ser, &pk[i]) == 1);
+        CHECK(secp256k1_memcmp_var(&ser[32 * i], pk_ser, 32) == 0);
+    }
+    state2 = secp256k1_musig_keyagg_state_parse(ctx, ser, serlen);
+    CHECK(state2 != NULL);
+    serlen2 = sizeof(ser2);
+    CHECK(secp256k1_musig_keyagg_state_serialize(ctx, ser2, &serlen2, state2) == 1);
+    CHECK(serlen == serlen2 && secp256k1_memcmp_var(ser, ser2, serlen) == 0);
+    CHECK(secp256k1_musig_pubkey_agg(ctx, NULL, &agg_pk, &keyagg_cache, pk_ptr, n_pks) == 1);
+    CHECK(secp256k1_musig_keyagg_state_agg(ctx, scratch, &agg_pk_state, &keyagg_cache_state, state2) == 1);
+    CHECK(secp256k1_memcmp_var(&agg_pk, &agg_pk_state, sizeof(agg_pk)) == 0);
+    CHECK(secp256k1_memcmp_var(&keyagg_cache, &keyagg_cache_state, sizeof(keyagg_cache)) == 0);
+
+    secp256k1_musig_keyagg_state_destroy(state);
+    secp256k1_musig_keyagg_state_destroy(state2);
+    secp256k1_context_destroy(vrfy);
+}
+
 void musig_test_vectors_keyagg_helper(const unsigned char **pk_ser, int n_pks, const unsigned char *agg_pk_expected, int has_second_pk, int second_pk_idx) {
     secp256k1_xonly_pubkey *pk = malloc(n_pks * sizeof(*pk));
     const secp256k1_xonly_pubkey **pk_ptr = malloc(n_pks * sizeof(*pk_ptr));
@@ -1375,11 +1728,17 @@ void run_musig_tests(void) {
     }
     musig_api_tests(scratch);
     musig_nonce_test();
+    for (i = 0; i < count; i++) {
+        musig_nonce_gen_batch_test();
+    }
     for (i = 0; i < count; i++) {
         /* Run multiple times to ensure that pk and nonce have different y
          * parities */
         scriptless_atomic_swap(scratch);
         musig_tweak_test(scratch);
+        musig_keyagg_many_test(scratch);
+        musig_keyagg_state_test(scratch);
+        musig_partial_sig_verify_batch_test(scratch);
     }
     sha256_tag_test();
     musig_test_vectors_keyagg();
@@ -13,6 +13,38 @@
 #include "group.h"
 #include "ecmult.h"
 #include "ecmult_gen.h"
+#include "scratch.h"
+
+/** A single Borromean ring signature, as consumed by secp256k1_borromean_verify_multi. */
+typedef struct {
+    /** If non-NULL, receives the challenge of every ring member (needed for proof rewind). */
+    secp256k1_scalar *evalues;
+    const unsigned char *e0;
+    const secp256k1_scalar *s;
+    const secp256k1_gej *pubs;
+    const size_t *rsizes;
+    size_t nrings;
+    const unsigned char *m;
+    size_t mlen;
+} secp256k1_borromean_sig;
+
+/** Verifies nsigs independent Borromean signatures at once, sharing field inversions between them.
+ *  Returns 1 if all of them are valid and 0 otherwise. */
+int secp256k1_borromean_verify_multi(const secp256k1_borromean_sig *sigs, size_t nsigs);
+
+/** Fills in sig for the idx-th proof of a batch, allocating its ring data from scratch. m33 points to 33
+ *  bytes that may hold the signed message. Returns 1 on success, 0 if the proof is invalid and -1 if it
+ *  does not fit into the scratch space. */
+typedef int (*secp256k1_borromean_batch_load_callback)(secp256k1_borromean_sig *sig, unsigned char *m33, const secp256k1_callback *error_callback, secp256k1_scratch_space *scratch, size_t idx, void *data);
+
+/** Verifies the idx-th proof of a batch on its own, without scratch space. Returns 1 if it is valid. */
+typedef int (*secp256k1_borromean_batch_verify_callback)(size_t idx, void *data);
+
+/** Verifies n proofs, handing the Borromean signatures of as many as fit into scratch (which may be NULL)
+ *  to secp256k1_borromean_verify_multi at once. If the batch fails and failed_index is not NULL, it is set
+ *  to the index of the first invalid proof. Returns 1 if all proofs are valid and 0 otherwise. */
+int secp256k1_borromean_verify_batch(const secp256k1_callback *error_callback, secp256k1_scratch_space *scratch, size_t *failed_index,
+ secp256k1_borromean_batch_load_callback load, secp256k1_borromean_batch_verify_callback verify, void *data, size_t n);
 
 int secp256k1_borromean_verify(secp256k1_scalar *evalues, const unsigned char *e0, const secp256k1_scalar *s,
  const secp256k1_gej *pubs, const size_t *rsizes, size_t nrings, const unsigned char *m, size_t mlen);
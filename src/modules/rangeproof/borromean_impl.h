@@ -41,6 +41,10 @@ SECP256K1_INLINE static void secp256k1_borromean_hash(unsigned char *hash, const
     secp256k1_sha256_finalize(&sha256_en, hash);
 }
 
+/* Number of rings whose members are computed side by side in secp256k1_borromean_verify_multi. Each column
+ * of up to this many ring members shares a single field inversion. */
+#define SECP256K1_BORROMEAN_VERIFY_BATCH 64
+
 /**  "Borromean" ring signature.
  *   Verifies nrings concurrent ring signatures all sharing a challenge value.
  *   Signature is one s value per pubkey and a hash.
@@ -54,58 +58,223 @@ SECP256K1_INLINE static void secp256k1_borromean_hash(unsigned char *hash, const
  *   | | | en = to_scalar(e)
  *   | | r_i = r
  *   | return e_0 ==== H(r_{0..i}||m)
+ *
+ *   The rings are independent of each other (also across signatures), so they are walked in lockstep:
+ *   the j-th member of every ring in a batch is computed first, all of them are converted to affine
+ *   with one batch inversion, and only then are they hashed to obtain the next challenges.
  */
-int secp256k1_borromean_verify(secp256k1_scalar *evalues, const unsigned char *e0,
- const secp256k1_scalar *s, const secp256k1_gej *pubs, const size_t *rsizes, size_t nrings, const unsigned char *m, size_t mlen) {
-    secp256k1_gej rgej;
-    secp256k1_ge rge;
-    secp256k1_scalar ens;
+int secp256k1_borromean_verify_multi(const secp256k1_borromean_sig *sigs, size_t nsigs) {
+    secp256k1_gej rgej[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    secp256k1_ge rge[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    secp256k1_scalar ens[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    const secp256k1_borromean_sig *rsig[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    size_t rring[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    size_t roffset[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    size_t active[SECP256K1_BORROMEAN_VERIFY_BATCH];
+    unsigned char rlast[SECP256K1_BORROMEAN_VERIFY_BATCH][33];
+    unsigned char rstart[SECP256K1_BORROMEAN_VERIFY_BATCH * 32];
+    unsigned char rsuffix[SECP256K1_BORROMEAN_VERIFY_BATCH][8];
+    const unsigned char *rsuffixptr[SECP256K1_BORROMEAN_VERIFY_BATCH];
     secp256k1_sha256 sha256_e0;
     unsigned char tmp[33];
-    size_t i;
+    size_t sig;
+    size_t ring;
     size_t j;
+    size_t k;
+    size_t batch;
+    size_t nactive;
+    size_t maxsize;
     size_t count;
     size_t size;
     int overflow;
+    VERIFY_CHECK(sigs != NULL);
+    sig = 0;
+    ring = 0;
+    count = 0;
+    while (sig < nsigs) {
+        /* Gather the next batch of rings, possibly spanning several signatures. */
+        batch = 0;
+        maxsize = 0;
+        while (batch < SECP256K1_BORROMEAN_VERIFY_BATCH && sig < nsigs) {
+            const secp256k1_borromean_sig *cur = &sigs[sig];
+            VERIFY_CHECK(cur->e0 != NULL);
+            VERIFY_CHECK(cur->s != NULL);
+            VERIFY_CHECK(cur->pubs != NULL);
+            VERIFY_CHECK(cur->rsizes != NULL);
+            VERIFY_CHECK(cur->nrings > 0);
+            VERIFY_CHECK(cur->m != NULL);
+            VERIFY_CHECK(INT_MAX - count > cur->rsizes[ring]);
+            rsig[batch] = cur;
+            rring[batch] = ring;
+            roffset[batch] = count;
+            if (cur->rsizes[ring] > maxsize) {
+                maxsize = cur->rsizes[ring];
+            }
+            count += cur->rsizes[ring];
+            batch++;
+            ring++;
+            if (ring == cur->nrings) {
+                sig++;
+                ring = 0;
+                count = 0;
+            }
+        }
+        /* The ring-start hashes H(e0||m||i||0) of a signature share the prefix e0||m and only differ in the
+         * ring index, so they are computed side by side. */
+        for (k = 0; k < batch; k = j) {
+            secp256k1_sha256 sha256_start;
+            secp256k1_sha256_initialize(&sha256_start);
+            secp256k1_sha256_write(&sha256_start, rsig[k]->e0, 32);
+            secp256k1_sha256_write(&sha256_start, rsig[k]->m, rsig[k]->mlen);
+            for (j = k; j < batch && rsig[j] == rsig[k]; j++) {
+                memset(rsuffix[j], 0, 8);
+                rsuffix[j][0] = rring[j] >> 24;
+                rsuffix[j][1] = rring[j] >> 16;
+                rsuffix[j][2] = rring[j] >> 8;
+                rsuffix[j][3] = rring[j];
+                rsuffixptr[j] = rsuffix[j];
+            }
+            secp256k1_sha256_finalize_multi(&rstart[32 * k], &sha256_start, &rsuffixptr[k], 8, j - k);
+        }
+        for (k = 0; k < batch; k++) {
+            secp256k1_scalar_set_b32(&ens[k], &rstart[32 * k], &overflow);
+            if (overflow) {
+                return 0;
+            }
+        }
+        for (j = 0; j < maxsize; j++) {
+            nactive = 0;
+            for (k = 0; k < batch; k++) {
+                const secp256k1_borromean_sig *cur = rsig[k];
+                size_t idx;
+                if (j >= cur->rsizes[rring[k]]) {
+                    continue;
+                }
+                idx = roffset[k] + j;
+                if (secp256k1_scalar_is_zero(&cur->s[idx]) || secp256k1_scalar_is_zero(&ens[k]) || secp256k1_gej_is_infinity(&cur->pubs[idx])) {
+                    return 0;
+                }
+                if (cur->evalues) {
+                    /*If requested, save the challenges for proof rewind.*/
+                    cur->evalues[idx] = ens[k];
+                }
+                secp256k1_ecmult(&rgej[nactive], &cur->pubs[idx], &ens[k], &cur->s[idx]);
+                if (secp256k1_gej_is_infinity(&rgej[nactive])) {
+                    return 0;
+                }
+                active[nactive++] = k;
+            }
+            secp256k1_ge_set_all_gej_var(rge, rgej, nactive);
+            for (k = 0; k < nactive; k++) {
+                size_t r = active[k];
+                if (j != rsig[r]->rsizes[rring[r]] - 1) {
+                    secp256k1_eckey_pubkey_serialize(&rge[k], tmp, &size, 1);
+                    secp256k1_borromean_hash(tmp, rsig[r]->m, rsig[r]->mlen, tmp, 33, rring[r], j + 1);
+                    secp256k1_scalar_set_b32(&ens[r], tmp, &overflow);
+                    if (overflow) {
+                        return 0;
+                    }
+                } else {
+                    secp256k1_eckey_pubkey_serialize(&rge[k], rlast[r], &size, 1);
+                }
+            }
+        }
+        /* Rings are visited in order, so one running hash suffices to recompute every e0. */
+        for (k = 0; k < batch; k++) {
+            const secp256k1_borromean_sig *cur = rsig[k];
+            if (rring[k] == 0) {
+                secp256k1_sha256_initialize(&sha256_e0);
+            }
+            if (cur->rsizes[rring[k]] > 0) {
+                secp256k1_sha256_write(&sha256_e0, rlast[k], 33);
+            }
+            if (rring[k] == cur->nrings - 1) {
+                secp256k1_sha256_write(&sha256_e0, cur->m, cur->mlen);
+                secp256k1_sha256_finalize(&sha256_e0, tmp);
+                if (memcmp(cur->e0, tmp, 32) != 0) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+int secp256k1_borromean_verify(secp256k1_scalar *evalues, const unsigned char *e0,
+ const secp256k1_scalar *s, const secp256k1_gej *pubs, const size_t *rsizes, size_t nrings, const unsigned char *m, size_t mlen) {
+    secp256k1_borromean_sig sig;
     VERIFY_CHECK(e0 != NULL);
     VERIFY_CHECK(s != NULL);
     VERIFY_CHECK(pubs != NULL);
     VERIFY_CHECK(rsizes != NULL);
     VERIFY_CHECK(nrings > 0);
     VERIFY_CHECK(m != NULL);
-    count = 0;
-    secp256k1_sha256_initialize(&sha256_e0);
-    for (i = 0; i < nrings; i++) {
-        VERIFY_CHECK(INT_MAX - count > rsizes[i]);
-        secp256k1_borromean_hash(tmp, m, mlen, e0, 32, i, 0);
-        secp256k1_scalar_set_b32(&ens, tmp, &overflow);
-        for (j = 0; j < rsizes[i]; j++) {
-            if (overflow || secp256k1_scalar_is_zero(&s[count]) || secp256k1_scalar_is_zero(&ens) || secp256k1_gej_is_infinity(&pubs[count])) {
-                return 0;
-            }
-            if (evalues) {
-                /*If requested, save the challenges for proof rewind.*/
-                evalues[count] = ens;
+    sig.evalues = evalues;
+    sig.e0 = e0;
+    sig.s = s;
+    sig.pubs = pubs;
+    sig.rsizes = rsizes;
+    sig.nrings = nrings;
+    sig.m = m;
+    sig.mlen = mlen;
+    return secp256k1_borromean_verify_multi(&sig, 1);
+}
+
+/* Maximum number of proofs whose Borromean signatures are handed to secp256k1_borromean_verify_multi at once. */
+#define SECP256K1_BORROMEAN_VERIFY_BATCH_MAX_SIGS 64
+
+int secp256k1_borromean_verify_batch(const secp256k1_callback *error_callback, secp256k1_scratch_space *scratch, size_t *failed_index,
+ secp256k1_borromean_batch_load_callback load, secp256k1_borromean_batch_verify_callback verify, void *data, size_t n) {
+    secp256k1_borromean_sig sigs[SECP256K1_BORROMEAN_VERIFY_BATCH_MAX_SIGS];
+    unsigned char m[SECP256K1_BORROMEAN_VERIFY_BATCH_MAX_SIGS][33];
+    size_t start;
+    size_t group;
+    size_t i;
+    int ret;
+
+    ret = 1;
+    start = 0;
+    while (start < n) {
+        size_t checkpoint = 0;
+        if (scratch != NULL) {
+            checkpoint = secp256k1_scratch_checkpoint(error_callback, scratch);
+        }
+        /* Load as many proofs as fit into the scratch space. */
+        for (group = 0; scratch != NULL && group < SECP256K1_BORROMEAN_VERIFY_BATCH_MAX_SIGS && start + group < n; group++) {
+            int loaded = load(&sigs[group], m[group], error_callback, scratch, start + group, data);
+            if (loaded < 0) {
+                break;
             }
-            secp256k1_ecmult(&rgej, &pubs[count], &ens, &s[count]);
-            if (secp256k1_gej_is_infinity(&rgej)) {
-                return 0;
+            if (loaded == 0) {
+                ret = 0;
+                break;
             }
-            /* OPT: loop can be hoisted and split to use batch inversion across all the rings; this would make it much faster. */
-            secp256k1_ge_set_gej_var(&rge, &rgej);
-            secp256k1_eckey_pubkey_serialize(&rge, tmp, &size, 1);
-            if (j != rsizes[i] - 1) {
-                secp256k1_borromean_hash(tmp, m, mlen, tmp, 33, i, j + 1);
-                secp256k1_scalar_set_b32(&ens, tmp, &overflow);
-            } else {
-                secp256k1_sha256_write(&sha256_e0, tmp, size);
+        }
+        if (ret && group == 0) {
+            /* Not even a single proof fits into the scratch space, verify it on its own. */
+            ret = verify(start, data);
+            group = 1;
+        } else if (ret) {
+            ret = secp256k1_borromean_verify_multi(sigs, group);
+        }
+        if (scratch != NULL) {
+            secp256k1_scratch_apply_checkpoint(error_callback, scratch, checkpoint);
+        }
+        if (!ret) {
+            if (failed_index != NULL) {
+                /* The batch does not tell which proof is invalid, so check them one by one. */
+                for (i = start; i < n; i++) {
+                    if (!verify(i, data)) {
+                        break;
+                    }
+                }
+                *failed_index = i;
             }
-            count++;
+            return 0;
         }
+        start += group;
     }
-    secp256k1_sha256_write(&sha256_e0, m, mlen);
-    secp256k1_sha256_finalize(&sha256_e0, tmp);
-    return memcmp(e0, tmp, 32) == 0;
+    return 1;
 }
 
 int secp256k1_borromean_sign(const secp256k1_ecmult_gen_context *ecmult_gen_ctx,
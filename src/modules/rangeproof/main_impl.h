@@ -33,6 +33,24 @@ static const secp256k1_generator secp256k1_generator_h_internal = {{
 
 const secp256k1_generator *secp256k1_generator_h = &secp256k1_generator_h_internal;
 
+/* Number of commitments converted to affine coordinates together by secp256k1_pedersen_commit_batch. */
+#define SECP256K1_PEDERSEN_COMMIT_BATCH 64
+
+/* Minimum number of consecutive outputs sharing a generator for which
+ * secp256k1_pedersen_commit_batch builds a comb table for that generator. */
+#ifndef SECP256K1_PEDERSEN_COMMIT_TABLE_MIN
+#define SECP256K1_PEDERSEN_COMMIT_TABLE_MIN 8
+#endif
+
+struct secp256k1_generator_table_struct {
+    secp256k1_generator gen;
+    secp256k1_ge_storage prec[PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G];
+};
+
+/* Number of commitments summed together by secp256k1_pedersen_verify_tally
+ * when no scratch space is available. */
+#define SECP256K1_PEDERSEN_TALLY_CHUNK 64
+
 static void secp256k1_pedersen_commitment_load(secp256k1_ge* ge, const secp256k1_pedersen_commitment* commit) {
     secp256k1_fe fe;
     secp256k1_fe_set_b32(&fe, &commit->data[1]);
@@ -48,6 +66,23 @@ static void secp256k1_pedersen_commitment_save(secp256k1_pedersen_commitment* co
     commit->data[0] = 9 ^ secp256k1_fe_is_quad_var(&ge->y);
 }
 
+static void secp256k1_pedersen_commitment_expanded_load(secp256k1_ge* ge, const secp256k1_pedersen_commitment_expanded* commit) {
+    int succeed;
+    succeed = secp256k1_fe_set_b32(&ge->x, &commit->data[0]);
+    VERIFY_CHECK(succeed != 0);
+    succeed = secp256k1_fe_set_b32(&ge->y, &commit->data[32]);
+    VERIFY_CHECK(succeed != 0);
+    ge->infinity = 0;
+    (void) succeed;
+}
+
+static void secp256k1_pedersen_commitment_expanded_save(secp256k1_pedersen_commitment_expanded* commit, secp256k1_ge* ge) {
+    secp256k1_fe_normalize_var(&ge->x);
+    secp256k1_fe_normalize_var(&ge->y);
+    secp256k1_fe_get_b32(&commit->data[0], &ge->x);
+    secp256k1_fe_get_b32(&commit->data[32], &ge->y);
+}
+
 int secp256k1_pedersen_commitment_parse(const secp256k1_context* ctx, secp256k1_pedersen_commitment* commit, const unsigned char *input) {
     secp256k1_fe x;
     secp256k1_ge ge;
@@ -84,25 +119,64 @@ int secp256k1_pedersen_commitment_serialize(const secp256k1_context* ctx, unsign
     return 1;
 }
 
-/* Generates a pedersen commitment: *commit = blind * G + value * G2. The blinding factor is 32 bytes.*/
-int secp256k1_pedersen_commit(const secp256k1_context* ctx, secp256k1_pedersen_commitment *commit, const unsigned char *blind, uint64_t value, const secp256k1_generator* gen) {
+int secp256k1_pedersen_commitment_expand(const secp256k1_context* ctx, secp256k1_pedersen_commitment_expanded* expanded, const secp256k1_pedersen_commitment* commit) {
+    secp256k1_ge ge;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(expanded != NULL);
+    ARG_CHECK(commit != NULL);
+
+    secp256k1_pedersen_commitment_load(&ge, commit);
+    secp256k1_pedersen_commitment_expanded_save(expanded, &ge);
+    return 1;
+}
+
+secp256k1_generator_table* secp256k1_generator_table_create(const secp256k1_context* ctx, const secp256k1_generator *gen) {
+    secp256k1_generator_table *table;
+    secp256k1_gej *precj;
+    secp256k1_ge *prec;
+    secp256k1_ge genp;
+    int ret = 0;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(gen != NULL);
+
+    table = (secp256k1_generator_table *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_generator_table));
+    precj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_gej));
+    prec = (secp256k1_ge *)checked_malloc(&ctx->error_callback, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_ge));
+    if (table != NULL && precj != NULL && prec != NULL) {
+        table->gen = *gen;
+        secp256k1_generator_load(&genp, gen);
+        ret = secp256k1_pedersen_table_build(table->prec, &genp, precj, prec);
+    }
+    free(precj);
+    free(prec);
+    if (!ret) {
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+void secp256k1_generator_table_destroy(secp256k1_generator_table* table) {
+    free(table);
+}
+
+static int secp256k1_pedersen_commit_internal(const secp256k1_context* ctx, secp256k1_pedersen_commitment *commit, const unsigned char *blind, uint64_t value, const secp256k1_generator* gen, const secp256k1_ge_storage *gen_table) {
     secp256k1_ge genp;
     secp256k1_gej rj;
     secp256k1_ge r;
     secp256k1_scalar sec;
     int overflow;
     int ret = 0;
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
-    ARG_CHECK(commit != NULL);
-    ARG_CHECK(blind != NULL);
-    ARG_CHECK(gen != NULL);
     secp256k1_generator_load(&genp, gen);
     secp256k1_scalar_set_b32(&sec, blind, &overflow);
+    secp256k1_declassify(ctx, &overflow, sizeof(overflow));
     if (!overflow) {
-        secp256k1_pedersen_ecmult(&ctx->ecmult_gen_ctx, &rj, &sec, value, &genp);
+        secp256k1_pedersen_ecmult(&ctx->ecmult_gen_ctx, &rj, &sec, value, &genp, gen_table);
+        secp256k1_declassify(ctx, &rj.infinity, sizeof(rj.infinity));
         if (!secp256k1_gej_is_infinity(&rj)) {
             secp256k1_ge_set_gej(&r, &rj);
+            secp256k1_declassify(ctx, &r, sizeof(r));
             secp256k1_pedersen_commitment_save(commit, &r);
             ret = 1;
         }
@@ -113,6 +187,118 @@ int secp256k1_pedersen_commit(const secp256k1_context* ctx, secp256k1_pedersen_c
     return ret;
 }
 
+/* Generates a pedersen commitment: *commit = blind * G + value * G2. The blinding factor is 32 bytes.*/
+int secp256k1_pedersen_commit(const secp256k1_context* ctx, secp256k1_pedersen_commitment *commit, const unsigned char *blind, uint64_t value, const secp256k1_generator* gen) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(blind != NULL);
+    ARG_CHECK(gen != NULL);
+    return secp256k1_pedersen_commit_internal(ctx, commit, blind, value, gen, NULL);
+}
+
+int secp256k1_pedersen_commit_with_table(const secp256k1_context* ctx, secp256k1_pedersen_commitment *commit, const unsigned char *blind, uint64_t value, const secp256k1_generator_table* table) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(blind != NULL);
+    ARG_CHECK(table != NULL);
+    return secp256k1_pedersen_commit_internal(ctx, commit, blind, value, &table->gen, table->prec);
+}
+
+int secp256k1_pedersen_commit_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, secp256k1_pedersen_commitment *commits, const unsigned char * const *blinds, const uint64_t *values, const secp256k1_generator * const *gens, size_t n) {
+    secp256k1_gej rj[SECP256K1_PEDERSEN_COMMIT_BATCH];
+    secp256k1_ge r[SECP256K1_PEDERSEN_COMMIT_BATCH];
+    secp256k1_ge genp;
+    secp256k1_scalar sec;
+    secp256k1_ge_storage *table = NULL;
+    size_t checkpoint = 0;
+    size_t run_end = 0;
+    int use_table = 0;
+    size_t i, j, k;
+    int overflow;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(commits != NULL || n == 0);
+    ARG_CHECK(blinds != NULL || n == 0);
+    ARG_CHECK(values != NULL || n == 0);
+    ARG_CHECK(gens != NULL || n == 0);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(blinds[i] != NULL);
+        ARG_CHECK(gens[i] != NULL);
+    }
+
+    if (scratch != NULL && n >= SECP256K1_PEDERSEN_COMMIT_TABLE_MIN) {
+        checkpoint = secp256k1_scratch_checkpoint(&ctx->error_callback, scratch);
+        table = (secp256k1_ge_storage *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_ge_storage));
+    }
+    for (i = 0; ret && i < n; i += k) {
+        k = n - i < SECP256K1_PEDERSEN_COMMIT_BATCH ? n - i : SECP256K1_PEDERSEN_COMMIT_BATCH;
+        for (j = 0; j < k; j++) {
+            secp256k1_generator_load(&genp, gens[i + j]);
+            if (i + j == run_end) {
+                /* Start of a run of outputs sharing a generator. If it is long enough, build a
+                 * table for it, unless the generator is H which has a precomputed one. */
+                run_end = i + j + 1;
+                while (run_end < n && (gens[run_end] == gens[i + j] || memcmp(gens[run_end], gens[i + j], sizeof(*gens[i + j])) == 0)) {
+                    run_end++;
+                }
+                use_table = 0;
+                if (table != NULL && run_end - (i + j) >= SECP256K1_PEDERSEN_COMMIT_TABLE_MIN &&
+                    memcmp(gens[i + j], secp256k1_generator_h, sizeof(*gens[i + j])) != 0) {
+                    size_t build_checkpoint = secp256k1_scratch_checkpoint(&ctx->error_callback, scratch);
+                    secp256k1_gej *precj = (secp256k1_gej *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_gej));
+                    secp256k1_ge *prec = (secp256k1_ge *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_ge));
+                    if (precj != NULL && prec != NULL) {
+                        use_table = secp256k1_pedersen_table_build(table, &genp, precj, prec);
+                    }
+                    secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratch, build_checkpoint);
+                }
+            }
+            if (use_table) {
+                secp256k1_pedersen_ecmult_small_table(&rj[j], values[i + j], table);
+            } else {
+                secp256k1_pedersen_ecmult_small(&rj[j], values[i + j], &genp, NULL);
+            }
+            secp256k1_pedersen_small_fix_infinity(&rj[j], values[i + j], &genp);
+        }
+        /* Convert the value terms to affine coordinates together, then add each
+         * blinding term to its value term. */
+        secp256k1_ge_set_all_gej(r, rj, k);
+        for (j = 0; j < k; j++) {
+            secp256k1_scalar_set_b32(&sec, blinds[i + j], &overflow);
+            secp256k1_declassify(ctx, &overflow, sizeof(overflow));
+            if (overflow) {
+                ret = 0;
+                break;
+            }
+            secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &rj[j], &sec);
+            secp256k1_pedersen_add_small(&rj[j], &r[j], values[i + j]);
+            secp256k1_declassify(ctx, &rj[j].infinity, sizeof(rj[j].infinity));
+            if (secp256k1_gej_is_infinity(&rj[j])) {
+                ret = 0;
+                break;
+            }
+        }
+        if (!ret) {
+            break;
+        }
+        secp256k1_ge_set_all_gej(r, rj, k);
+        secp256k1_declassify(ctx, r, k * sizeof(r[0]));
+        for (j = 0; j < k; j++) {
+            secp256k1_pedersen_commitment_save(&commits[i + j], &r[j]);
+        }
+    }
+    if (table != NULL) {
+        secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratch, checkpoint);
+    }
+    secp256k1_scalar_clear(&sec);
+    memset(rj, 0, sizeof(rj));
+    memset(r, 0, sizeof(r));
+    return ret;
+}
+
 /** Takes a list of n pointers to 32 byte blinding values, the first negs of which are treated with positive sign and the rest
  *  negative, then calculates an additional blinding value that adds to zero.
  */
@@ -144,27 +330,106 @@ int secp256k1_pedersen_blind_sum(const secp256k1_context* ctx, unsigned char *bl
 }
 
 /* Takes two lists of commitments and sums the first set and subtracts the second and verifies that they sum to excess. */
-int secp256k1_pedersen_verify_tally(const secp256k1_context* ctx, const secp256k1_pedersen_commitment * const* commits, size_t pcnt, const secp256k1_pedersen_commitment * const* ncommits, size_t ncnt) {
+/* Adds the n points in pts to accj. The points are summed with batched affine
+ * additions (see secp256k1_ecmult_pippenger_affine_reduce), which overwrites
+ * pts. fe must have room for n elements. */
+static void secp256k1_pedersen_tally_add(secp256k1_gej *accj, secp256k1_ge *pts, secp256k1_fe *fe, size_t n) {
+    struct secp256k1_pippenger_affine_state aff;
+    size_t start = 0;
+
+    aff.pts = pts;
+    aff.fe = fe;
+    aff.bucket_start = &start;
+    aff.bucket_count = &n;
+    secp256k1_ecmult_pippenger_affine_reduce(&aff, 1);
+    if (n == 1) {
+        secp256k1_gej_add_ge_var(accj, accj, &pts[0], NULL);
+    }
+}
+
+/* Loads the i-th commitment of a tally. Exactly one of commits and ecommits is non-NULL. */
+static void secp256k1_pedersen_tally_load(secp256k1_ge *ge, const secp256k1_pedersen_commitment * const* commits, const secp256k1_pedersen_commitment_expanded * const* ecommits, size_t i) {
+    if (commits != NULL) {
+        secp256k1_pedersen_commitment_load(ge, commits[i]);
+    } else {
+        secp256k1_pedersen_commitment_expanded_load(ge, ecommits[i]);
+    }
+}
+
+static int secp256k1_pedersen_verify_tally_internal(const secp256k1_callback *error_callback, secp256k1_scratch *scratch,
+ const secp256k1_pedersen_commitment * const* commits, const secp256k1_pedersen_commitment_expanded * const* ecommits, size_t pcnt,
+ const secp256k1_pedersen_commitment * const* ncommits, const secp256k1_pedersen_commitment_expanded * const* encommits, size_t ncnt) {
+    secp256k1_ge pts_stack[SECP256K1_PEDERSEN_TALLY_CHUNK];
+    secp256k1_fe fe_stack[SECP256K1_PEDERSEN_TALLY_CHUNK];
+    secp256k1_ge *pts = pts_stack;
+    secp256k1_fe *fe = fe_stack;
+    size_t chunk = SECP256K1_PEDERSEN_TALLY_CHUNK;
+    size_t checkpoint = 0;
     secp256k1_gej accj;
-    secp256k1_ge add;
-    size_t i;
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(!pcnt || (commits != NULL));
-    ARG_CHECK(!ncnt || (ncommits != NULL));
-    (void) ctx;
+    size_t i, k;
+
+    if (scratch != NULL && pcnt + ncnt > SECP256K1_PEDERSEN_TALLY_CHUNK) {
+        size_t max_chunk = secp256k1_scratch_max_allocation(error_callback, scratch, 2) / (sizeof(secp256k1_ge) + sizeof(secp256k1_fe));
+        if (max_chunk > SECP256K1_PEDERSEN_TALLY_CHUNK) {
+            chunk = max_chunk < pcnt + ncnt ? max_chunk : pcnt + ncnt;
+            checkpoint = secp256k1_scratch_checkpoint(error_callback, scratch);
+            pts = (secp256k1_ge *) secp256k1_scratch_alloc(error_callback, scratch, chunk * sizeof(secp256k1_ge));
+            fe = (secp256k1_fe *) secp256k1_scratch_alloc(error_callback, scratch, chunk * sizeof(secp256k1_fe));
+            if (pts == NULL || fe == NULL) {
+                secp256k1_scratch_apply_checkpoint(error_callback, scratch, checkpoint);
+                return 0;
+            }
+        }
+    }
+
     secp256k1_gej_set_infinity(&accj);
-    for (i = 0; i < ncnt; i++) {
-        secp256k1_pedersen_commitment_load(&add, ncommits[i]);
-        secp256k1_gej_add_ge_var(&accj, &accj, &add, NULL);
+    k = 0;
+    for (i = 0; i < ncnt + pcnt; i++) {
+        if (i < ncnt) {
+            secp256k1_pedersen_tally_load(&pts[k], ncommits, encommits, i);
+            secp256k1_ge_neg(&pts[k], &pts[k]);
+        } else {
+            secp256k1_pedersen_tally_load(&pts[k], commits, ecommits, i - ncnt);
+        }
+        /* The affine additions require magnitude 1. */
+        secp256k1_fe_normalize_weak(&pts[k].y);
+        k++;
+        if (k == chunk) {
+            secp256k1_pedersen_tally_add(&accj, pts, fe, k);
+            k = 0;
+        }
     }
-    secp256k1_gej_neg(&accj, &accj);
-    for (i = 0; i < pcnt; i++) {
-        secp256k1_pedersen_commitment_load(&add, commits[i]);
-        secp256k1_gej_add_ge_var(&accj, &accj, &add, NULL);
+    if (k > 0) {
+        secp256k1_pedersen_tally_add(&accj, pts, fe, k);
+    }
+
+    if (pts != pts_stack) {
+        secp256k1_scratch_apply_checkpoint(error_callback, scratch, checkpoint);
     }
     return secp256k1_gej_is_infinity(&accj);
 }
 
+int secp256k1_pedersen_verify_tally(const secp256k1_context* ctx, const secp256k1_pedersen_commitment * const* commits, size_t pcnt, const secp256k1_pedersen_commitment * const* ncommits, size_t ncnt) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(!pcnt || (commits != NULL));
+    ARG_CHECK(!ncnt || (ncommits != NULL));
+    return secp256k1_pedersen_verify_tally_internal(&ctx->error_callback, NULL, commits, NULL, pcnt, ncommits, NULL, ncnt);
+}
+
+int secp256k1_pedersen_verify_tally_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, const secp256k1_pedersen_commitment * const* commits, size_t pcnt, const secp256k1_pedersen_commitment * const* ncommits, size_t ncnt) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(!pcnt || (commits != NULL));
+    ARG_CHECK(!ncnt || (ncommits != NULL));
+    return secp256k1_pedersen_verify_tally_internal(&ctx->error_callback, scratch, commits, NULL, pcnt, ncommits, NULL, ncnt);
+}
+
+int secp256k1_pedersen_verify_tally_expanded(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, const secp256k1_pedersen_commitment_expanded * const* commits, size_t pcnt, const secp256k1_pedersen_commitment_expanded * const* ncommits, size_t ncnt) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(!pcnt || (commits != NULL));
+    ARG_CHECK(!ncnt || (ncommits != NULL));
+    return secp256k1_pedersen_verify_tally_internal(&ctx->error_callback, scratch, NULL, commits, pcnt, NULL, ncommits, ncnt);
+}
+
 int secp256k1_pedersen_blind_generator_blind_sum(const secp256k1_context* ctx, const uint64_t *value, const unsigned char* const* generator_blind, unsigned char* const* blinding_factor, size_t n_total, size_t n_inputs) {
     secp256k1_scalar sum;
     secp256k1_scalar tmp;
@@ -248,6 +513,7 @@ int secp256k1_rangeproof_rewind(const secp256k1_context* ctx,
  unsigned char *blind_out, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
  uint64_t *min_value, uint64_t *max_value,
  const secp256k1_pedersen_commitment *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_rangeproof_header hdr;
     secp256k1_ge commitp;
     secp256k1_ge genp;
     VERIFY_CHECK(ctx != NULL);
@@ -260,14 +526,22 @@ int secp256k1_rangeproof_rewind(const secp256k1_context* ctx,
     ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
     ARG_CHECK(gen != NULL);
     ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    if (!secp256k1_rangeproof_header_parse(&hdr, proof, plen)) {
+        return 0;
+    }
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
     secp256k1_pedersen_commitment_load(&commitp, commit);
     secp256k1_generator_load(&genp, gen);
     return secp256k1_rangeproof_verify_impl(&ctx->ecmult_gen_ctx,
-     blind_out, value_out, message_out, outlen, nonce, min_value, max_value, &commitp, proof, plen, extra_commit, extra_commit_len, &genp);
+     blind_out, value_out, message_out, outlen, nonce, &commitp, &hdr, extra_commit, extra_commit_len, &genp, NULL);
 }
 
-int secp256k1_rangeproof_verify(const secp256k1_context* ctx, uint64_t *min_value, uint64_t *max_value,
- const secp256k1_pedersen_commitment *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+int secp256k1_rangeproof_rewind_with_table(const secp256k1_context* ctx,
+ unsigned char *blind_out, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
+ uint64_t *min_value, uint64_t *max_value,
+ const secp256k1_pedersen_commitment *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator_table* table) {
+    secp256k1_rangeproof_header hdr;
     secp256k1_ge commitp;
     secp256k1_ge genp;
     VERIFY_CHECK(ctx != NULL);
@@ -275,12 +549,285 @@ int secp256k1_rangeproof_verify(const secp256k1_context* ctx, uint64_t *min_valu
     ARG_CHECK(proof != NULL);
     ARG_CHECK(min_value != NULL);
     ARG_CHECK(max_value != NULL);
+    ARG_CHECK(message_out != NULL || outlen == NULL);
+    ARG_CHECK(nonce != NULL);
+    ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
+    ARG_CHECK(table != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    if (!secp256k1_rangeproof_header_parse(&hdr, proof, plen)) {
+        return 0;
+    }
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
+    secp256k1_pedersen_commitment_load(&commitp, commit);
+    secp256k1_generator_load(&genp, &table->gen);
+    return secp256k1_rangeproof_verify_impl(&ctx->ecmult_gen_ctx,
+     blind_out, value_out, message_out, outlen, nonce, &commitp, &hdr, extra_commit, extra_commit_len, &genp, table->prec);
+}
+
+static const unsigned char secp256k1_rangeproof_view_magic[4] = { 0x3c, 0x71, 0xe2, 0x9a };
+
+/* A view consists of a 4 byte magic, to detect views that were not filled by secp256k1_rangeproof_view_parse,
+ * followed by the parsed header, which includes the pointer to the proof. */
+static void secp256k1_rangeproof_view_save(secp256k1_rangeproof_view *view, const secp256k1_rangeproof_header *hdr) {
+    VERIFY_CHECK(4 + sizeof(*hdr) <= sizeof(view->data));
+    memcpy(view->data, secp256k1_rangeproof_view_magic, 4);
+    memcpy(&view->data[4], hdr, sizeof(*hdr));
+}
+
+static int secp256k1_rangeproof_view_load(const secp256k1_context* ctx, secp256k1_rangeproof_header *hdr, const secp256k1_rangeproof_view *view) {
+    ARG_CHECK(secp256k1_memcmp_var(view->data, secp256k1_rangeproof_view_magic, 4) == 0);
+    memcpy(hdr, &view->data[4], sizeof(*hdr));
+    return 1;
+}
+
+int secp256k1_rangeproof_view_parse(const secp256k1_context* ctx, secp256k1_rangeproof_view *view, const unsigned char *proof, size_t plen) {
+    secp256k1_rangeproof_header hdr;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(view != NULL);
+    memset(view, 0, sizeof(*view));
+    ARG_CHECK(proof != NULL);
+    if (!secp256k1_rangeproof_header_parse(&hdr, proof, plen)) {
+        return 0;
+    }
+    secp256k1_rangeproof_view_save(view, &hdr);
+    return 1;
+}
+
+int secp256k1_rangeproof_info_view(const secp256k1_context* ctx, int *exp, int *mantissa,
+ uint64_t *min_value, uint64_t *max_value, const secp256k1_rangeproof_view *view) {
+    secp256k1_rangeproof_header hdr;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(exp != NULL);
+    ARG_CHECK(mantissa != NULL);
+    ARG_CHECK(min_value != NULL);
+    ARG_CHECK(max_value != NULL);
+    ARG_CHECK(view != NULL);
+    if (!secp256k1_rangeproof_view_load(ctx, &hdr, view)) {
+        return 0;
+    }
+    *exp = hdr.exp;
+    *mantissa = hdr.mantissa;
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
+    return 1;
+}
+
+int secp256k1_rangeproof_verify_view(const secp256k1_context* ctx, uint64_t *min_value, uint64_t *max_value,
+ const secp256k1_pedersen_commitment *commit, const secp256k1_rangeproof_view *view, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_rangeproof_header hdr;
+    secp256k1_ge commitp;
+    secp256k1_ge genp;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(min_value != NULL);
+    ARG_CHECK(max_value != NULL);
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(view != NULL);
     ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
     ARG_CHECK(gen != NULL);
+    if (!secp256k1_rangeproof_view_load(ctx, &hdr, view)) {
+        return 0;
+    }
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
     secp256k1_pedersen_commitment_load(&commitp, commit);
     secp256k1_generator_load(&genp, gen);
     return secp256k1_rangeproof_verify_impl(NULL,
-     NULL, NULL, NULL, NULL, NULL, min_value, max_value, &commitp, proof, plen, extra_commit, extra_commit_len, &genp);
+     NULL, NULL, NULL, NULL, NULL, &commitp, &hdr, extra_commit, extra_commit_len, &genp, NULL);
+}
+
+int secp256k1_rangeproof_rewind_view(const secp256k1_context* ctx,
+ unsigned char *blind_out, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
+ uint64_t *min_value, uint64_t *max_value,
+ const secp256k1_pedersen_commitment *commit, const secp256k1_rangeproof_view *view, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_rangeproof_header hdr;
+    secp256k1_ge commitp;
+    secp256k1_ge genp;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(view != NULL);
+    ARG_CHECK(min_value != NULL);
+    ARG_CHECK(max_value != NULL);
+    ARG_CHECK(message_out != NULL || outlen == NULL);
+    ARG_CHECK(nonce != NULL);
+    ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
+    ARG_CHECK(gen != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    if (!secp256k1_rangeproof_view_load(ctx, &hdr, view)) {
+        return 0;
+    }
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
+    secp256k1_pedersen_commitment_load(&commitp, commit);
+    secp256k1_generator_load(&genp, gen);
+    return secp256k1_rangeproof_verify_impl(&ctx->ecmult_gen_ctx,
+     blind_out, value_out, message_out, outlen, nonce, &commitp, &hdr, extra_commit, extra_commit_len, &genp, NULL);
+}
+
+/* Loads the commitment of a proof. Exactly one of commits and ecommits is non-NULL. */
+static void secp256k1_rangeproof_commit_load(secp256k1_ge *commitp, const secp256k1_pedersen_commitment * const *commits, const secp256k1_pedersen_commitment_expanded * const *ecommits, size_t i) {
+    if (commits != NULL) {
+        secp256k1_pedersen_commitment_load(commitp, commits[i]);
+    } else {
+        secp256k1_pedersen_commitment_expanded_load(commitp, ecommits[i]);
+    }
+}
+
+static int secp256k1_rangeproof_verify_single(uint64_t *min_value, uint64_t *max_value, const secp256k1_ge *commitp,
+ const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_rangeproof_header hdr;
+    secp256k1_ge genp;
+    if (!secp256k1_rangeproof_header_parse(&hdr, proof, plen)) {
+        return 0;
+    }
+    *min_value = hdr.min_value;
+    *max_value = hdr.max_value;
+    secp256k1_generator_load(&genp, gen);
+    return secp256k1_rangeproof_verify_impl(NULL,
+     NULL, NULL, NULL, NULL, NULL, commitp, &hdr, extra_commit, extra_commit_len, &genp, NULL);
+}
+
+int secp256k1_rangeproof_verify(const secp256k1_context* ctx, uint64_t *min_value, uint64_t *max_value,
+ const secp256k1_pedersen_commitment *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_ge commitp;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(proof != NULL);
+    ARG_CHECK(min_value != NULL);
+    ARG_CHECK(max_value != NULL);
+    ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
+    ARG_CHECK(gen != NULL);
+    secp256k1_pedersen_commitment_load(&commitp, commit);
+    return secp256k1_rangeproof_verify_single(min_value, max_value, &commitp, proof, plen, extra_commit, extra_commit_len, gen);
+}
+
+int secp256k1_rangeproof_verify_expanded(const secp256k1_context* ctx, uint64_t *min_value, uint64_t *max_value,
+ const secp256k1_pedersen_commitment_expanded *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator* gen) {
+    secp256k1_ge commitp;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(proof != NULL);
+    ARG_CHECK(min_value != NULL);
+    ARG_CHECK(max_value != NULL);
+    ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
+    ARG_CHECK(gen != NULL);
+    secp256k1_pedersen_commitment_expanded_load(&commitp, commit);
+    return secp256k1_rangeproof_verify_single(min_value, max_value, &commitp, proof, plen, extra_commit, extra_commit_len, gen);
+}
+
+typedef struct {
+    uint64_t *min_values;
+    uint64_t *max_values;
+    const secp256k1_pedersen_commitment * const *commits;
+    const secp256k1_pedersen_commitment_expanded * const *ecommits;
+    const unsigned char * const *proofs;
+    const size_t *plens;
+    const unsigned char * const *extra_commits;
+    const size_t *extra_commit_lens;
+    const secp256k1_generator * const *gens;
+} secp256k1_rangeproof_verify_batch_data;
+
+static int secp256k1_rangeproof_verify_batch_load(secp256k1_borromean_sig *sig, unsigned char *m33, const secp256k1_callback *error_callback, secp256k1_scratch_space *scratch, size_t idx, void *data) {
+    const secp256k1_rangeproof_verify_batch_data *d = (const secp256k1_rangeproof_verify_batch_data *) data;
+    const unsigned char *extra_commit = d->extra_commits != NULL ? d->extra_commits[idx] : NULL;
+    const size_t extra_commit_len = d->extra_commit_lens != NULL ? d->extra_commit_lens[idx] : 0;
+    secp256k1_rangeproof_header hdr;
+    secp256k1_ge commitp;
+    secp256k1_ge genp;
+    secp256k1_gej *pubs;
+    secp256k1_scalar *s;
+    size_t *rsizes;
+
+    if (!secp256k1_rangeproof_header_parse(&hdr, d->proofs[idx], d->plens[idx])) {
+        return 0;
+    }
+    rsizes = (size_t *) secp256k1_scratch_alloc(error_callback, scratch, hdr.rings * sizeof(size_t));
+    pubs = (secp256k1_gej *) secp256k1_scratch_alloc(error_callback, scratch, hdr.npub * sizeof(secp256k1_gej));
+    s = (secp256k1_scalar *) secp256k1_scratch_alloc(error_callback, scratch, hdr.npub * sizeof(secp256k1_scalar));
+    if (rsizes == NULL || pubs == NULL || s == NULL) {
+        return -1;
+    }
+    secp256k1_rangeproof_header_rsizes(rsizes, &hdr);
+    secp256k1_rangeproof_commit_load(&commitp, d->commits, d->ecommits, idx);
+    secp256k1_generator_load(&genp, d->gens[idx]);
+    if (!secp256k1_rangeproof_verify_load(pubs, s, &sig->e0, m33, &hdr, rsizes, &commitp, extra_commit, extra_commit_len, &genp, NULL)) {
+        return 0;
+    }
+    sig->evalues = NULL;
+    sig->s = s;
+    sig->pubs = pubs;
+    sig->rsizes = rsizes;
+    sig->nrings = hdr.rings;
+    sig->m = m33;
+    sig->mlen = 32;
+    if (d->min_values != NULL) {
+        d->min_values[idx] = hdr.min_value;
+    }
+    if (d->max_values != NULL) {
+        d->max_values[idx] = hdr.max_value;
+    }
+    return 1;
+}
+
+static int secp256k1_rangeproof_verify_batch_single(size_t idx, void *data) {
+    const secp256k1_rangeproof_verify_batch_data *d = (const secp256k1_rangeproof_verify_batch_data *) data;
+    secp256k1_ge commitp;
+    uint64_t min_value;
+    uint64_t max_value;
+    int ret;
+    secp256k1_rangeproof_commit_load(&commitp, d->commits, d->ecommits, idx);
+    ret = secp256k1_rangeproof_verify_single(&min_value, &max_value, &commitp, d->proofs[idx], d->plens[idx],
+     d->extra_commits != NULL ? d->extra_commits[idx] : NULL, d->extra_commit_lens != NULL ? d->extra_commit_lens[idx] : 0, d->gens[idx]);
+    if (d->min_values != NULL) {
+        d->min_values[idx] = min_value;
+    }
+    if (d->max_values != NULL) {
+        d->max_values[idx] = max_value;
+    }
+    return ret;
+}
+
+/* Verifies the proofs for either commits or, if commits is NULL, ecommits. */
+static int secp256k1_rangeproof_verify_batch_internal(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index,
+ uint64_t *min_values, uint64_t *max_values, const secp256k1_pedersen_commitment * const *commits, const secp256k1_pedersen_commitment_expanded * const *ecommits,
+ const unsigned char * const *proofs, const size_t *plens, const unsigned char * const *extra_commits, const size_t *extra_commit_lens, const secp256k1_generator * const *gens, size_t n_proofs) {
+    secp256k1_rangeproof_verify_batch_data data;
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_proofs == 0 || commits != NULL || ecommits != NULL);
+    ARG_CHECK(n_proofs == 0 || proofs != NULL);
+    ARG_CHECK(n_proofs == 0 || plens != NULL);
+    ARG_CHECK(n_proofs == 0 || gens != NULL);
+    ARG_CHECK((extra_commits == NULL) == (extra_commit_lens == NULL));
+    for (i = 0; i < n_proofs; i++) {
+        ARG_CHECK(commits != NULL ? commits[i] != NULL : ecommits[i] != NULL);
+        ARG_CHECK(proofs[i] != NULL);
+        ARG_CHECK(gens[i] != NULL);
+        ARG_CHECK(extra_commits == NULL || extra_commits[i] != NULL || extra_commit_lens[i] == 0);
+    }
+
+    data.min_values = min_values;
+    data.max_values = max_values;
+    data.commits = commits;
+    data.ecommits = ecommits;
+    data.proofs = proofs;
+    data.plens = plens;
+    data.extra_commits = extra_commits;
+    data.extra_commit_lens = extra_commit_lens;
+    data.gens = gens;
+    return secp256k1_borromean_verify_batch(&ctx->error_callback, scratch, failed_index, secp256k1_rangeproof_verify_batch_load, secp256k1_rangeproof_verify_batch_single, &data, n_proofs);
+}
+
+int secp256k1_rangeproof_verify_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index,
+ uint64_t *min_values, uint64_t *max_values, const secp256k1_pedersen_commitment * const *commits, const unsigned char * const *proofs,
+ const size_t *plens, const unsigned char * const *extra_commits, const size_t *extra_commit_lens, const secp256k1_generator * const *gens, size_t n_proofs) {
+    return secp256k1_rangeproof_verify_batch_internal(ctx, scratch, failed_index, min_values, max_values, commits, NULL, proofs, plens, extra_commits, extra_commit_lens, gens, n_proofs);
+}
+
+int secp256k1_rangeproof_verify_batch_expanded(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index,
+ uint64_t *min_values, uint64_t *max_values, const secp256k1_pedersen_commitment_expanded * const *commits, const unsigned char * const *proofs,
+ const size_t *plens, const unsigned char * const *extra_commits, const size_t *extra_commit_lens, const secp256k1_generator * const *gens, size_t n_proofs) {
+    return secp256k1_rangeproof_verify_batch_internal(ctx, scratch, failed_index, min_values, max_values, NULL, commits, proofs, plens, extra_commits, extra_commit_lens, gens, n_proofs);
 }
 
 int secp256k1_rangeproof_sign(const secp256k1_context* ctx, unsigned char *proof, size_t *plen, uint64_t min_value,
@@ -301,7 +848,28 @@ int secp256k1_rangeproof_sign(const secp256k1_context* ctx, unsigned char *proof
     secp256k1_pedersen_commitment_load(&commitp, commit);
     secp256k1_generator_load(&genp, gen);
     return secp256k1_rangeproof_sign_impl(&ctx->ecmult_gen_ctx,
-     proof, plen, min_value, &commitp, blind, nonce, exp, min_bits, value, message, msg_len, extra_commit, extra_commit_len, &genp);
+     proof, plen, min_value, &commitp, blind, nonce, exp, min_bits, value, message, msg_len, extra_commit, extra_commit_len, &genp, NULL);
+}
+
+int secp256k1_rangeproof_sign_with_table(const secp256k1_context* ctx, unsigned char *proof, size_t *plen, uint64_t min_value,
+ const secp256k1_pedersen_commitment *commit, const unsigned char *blind, const unsigned char *nonce, int exp, int min_bits, uint64_t value,
+ const unsigned char *message, size_t msg_len, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_generator_table* table){
+    secp256k1_ge commitp;
+    secp256k1_ge genp;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(proof != NULL);
+    ARG_CHECK(plen != NULL);
+    ARG_CHECK(commit != NULL);
+    ARG_CHECK(blind != NULL);
+    ARG_CHECK(nonce != NULL);
+    ARG_CHECK(message != NULL || msg_len == 0);
+    ARG_CHECK(extra_commit != NULL || extra_commit_len == 0);
+    ARG_CHECK(table != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    secp256k1_pedersen_commitment_load(&commitp, commit);
+    secp256k1_generator_load(&genp, &table->gen);
+    return secp256k1_rangeproof_sign_impl(&ctx->ecmult_gen_ctx,
+     proof, plen, min_value, &commitp, blind, nonce, exp, min_bits, value, message, msg_len, extra_commit, extra_commit_len, &genp, table->prec);
 }
 
 #endif
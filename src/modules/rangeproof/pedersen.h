@@ -13,10 +13,23 @@
 
 #include <stdint.h>
 
-/** Multiply a small number with the generator: r = gn*G2 */
-static void secp256k1_pedersen_ecmult_small(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp);
+/** Multiply a small number with a generator using a comb table: r = gn*G2 */
+static void secp256k1_pedersen_ecmult_small_table(secp256k1_gej *r, uint64_t gn, const secp256k1_ge_storage *table);
+
+/** Build a comb table for secp256k1_pedersen_ecmult_small_table. */
+static int secp256k1_pedersen_table_build(secp256k1_ge_storage *table, const secp256k1_ge *genp, secp256k1_gej *precj, secp256k1_ge *prec);
+
+/** Multiply a small number with the generator: r = gn*G2. gen_table is a comb table for G2, or NULL. */
+static void secp256k1_pedersen_ecmult_small(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table);
+
+/** Prepare r = gn*G2 from secp256k1_pedersen_ecmult_small for secp256k1_pedersen_add_small: if gn is 0, set r
+ *  to G2 instead of infinity, so that the affine form of r can be computed with a constant-time inversion. */
+static void secp256k1_pedersen_small_fix_infinity(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp);
+
+/** Add gn*G2 to r in constant time, given its affine form v as prepared by secp256k1_pedersen_small_fix_infinity. */
+static void secp256k1_pedersen_add_small(secp256k1_gej *r, const secp256k1_ge *v, uint64_t gn);
 
 /* sec * G + value * G2. */
-static void secp256k1_pedersen_ecmult(const secp256k1_ecmult_gen_context *ecmult_gen_ctx, secp256k1_gej *rj, const secp256k1_scalar *sec, uint64_t value, const secp256k1_ge* genp);
+static void secp256k1_pedersen_ecmult(const secp256k1_ecmult_gen_context *ecmult_gen_ctx, secp256k1_gej *rj, const secp256k1_scalar *sec, uint64_t value, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table);
 
 #endif
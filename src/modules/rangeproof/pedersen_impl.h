@@ -14,6 +14,7 @@
 #include "ecmult_gen.h"
 #include "group.h"
 #include "field.h"
+#include "precomputed_pedersen_h.h"
 #include "scalar.h"
 #include "util.h"
 
@@ -31,21 +32,118 @@ static void secp256k1_pedersen_scalar_set_u64(secp256k1_scalar *sec, uint64_t va
     memset(data, 0, 32);
 }
 
-static void secp256k1_pedersen_ecmult_small(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp) {
+/* Multiply a generator by a 64-bit value using a comb table with
+ * PEDERSEN_H_PREC_N windows of PEDERSEN_H_PREC_G entries each, built like
+ * secp256k1_ecmult_gen_prec_table (see ecmult_gen_impl.h). The entries for a
+ * window are scanned with conditional moves, so the table access does not
+ * depend on gn. */
+static void secp256k1_pedersen_ecmult_small_table(secp256k1_gej *r, uint64_t gn, const secp256k1_ge_storage *table) {
+    secp256k1_ge add;
+    secp256k1_ge_storage adds;
+    int i, j, n_i;
+
+    memset(&adds, 0, sizeof(adds));
+    secp256k1_gej_set_infinity(r);
+    add.infinity = 0;
+    for (i = 0; i < PEDERSEN_H_PREC_N; i++) {
+        n_i = (gn >> (i * PEDERSEN_H_PREC_BITS)) & (PEDERSEN_H_PREC_G - 1);
+        for (j = 0; j < PEDERSEN_H_PREC_G; j++) {
+            secp256k1_ge_storage_cmov(&adds, &table[i * PEDERSEN_H_PREC_G + j], j == n_i);
+        }
+        secp256k1_ge_from_storage(&add, &adds);
+        secp256k1_gej_add_ge(r, r, &add);
+    }
+    n_i = 0;
+    secp256k1_ge_clear(&add);
+}
+
+/* Build a comb table for secp256k1_pedersen_ecmult_small_table for the
+ * generator genp at runtime. precj and prec must have room for
+ * PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G elements. Returns 0 if an entry is the
+ * point at infinity, which requires a generator that is a known multiple of
+ * the offset point, in which case the table must not be used. */
+static int secp256k1_pedersen_table_build(secp256k1_ge_storage *table, const secp256k1_ge *genp, secp256k1_gej *precj, secp256k1_ge *prec) {
+    static const unsigned char nums_b32[33] = "The scalar for this x is unknown";
+    secp256k1_gej gbase, nums, numsbase;
+    secp256k1_fe nums_x;
+    secp256k1_ge nums_ge;
+    int i, j;
+
+    /* The offset point is derived like in secp256k1_ecmult_gen_compute_table. */
+    if (!secp256k1_fe_set_b32(&nums_x, nums_b32) || !secp256k1_ge_set_xo_var(&nums_ge, &nums_x, 0)) {
+        return 0;
+    }
+    secp256k1_gej_set_ge(&nums, &nums_ge);
+    secp256k1_gej_set_ge(&gbase, genp);
+    numsbase = nums;
+    for (j = 0; j < PEDERSEN_H_PREC_N; j++) {
+        precj[j * PEDERSEN_H_PREC_G] = numsbase;
+        for (i = 1; i < PEDERSEN_H_PREC_G; i++) {
+            secp256k1_gej_add_var(&precj[j * PEDERSEN_H_PREC_G + i], &precj[j * PEDERSEN_H_PREC_G + i - 1], &gbase, NULL);
+        }
+        for (i = 0; i < PEDERSEN_H_PREC_BITS; i++) {
+            secp256k1_gej_double_var(&gbase, &gbase, NULL);
+        }
+        secp256k1_gej_double_var(&numsbase, &numsbase, NULL);
+        if (j == PEDERSEN_H_PREC_N - 2) {
+            /* The offsets sum to zero, see secp256k1_ecmult_gen_compute_table. */
+            secp256k1_gej_neg(&numsbase, &numsbase);
+            secp256k1_gej_add_var(&numsbase, &numsbase, &nums, NULL);
+        }
+    }
+    secp256k1_ge_set_all_gej_var(prec, precj, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G);
+    for (i = 0; i < PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G; i++) {
+        if (secp256k1_ge_is_infinity(&prec[i])) {
+            return 0;
+        }
+        secp256k1_ge_to_storage(&table[i], &prec[i]);
+    }
+    return 1;
+}
+
+static void secp256k1_pedersen_ecmult_small(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table) {
     secp256k1_scalar s;
+#ifndef EXHAUSTIVE_TEST_ORDER
+    static const secp256k1_ge h = SECP256K1_PEDERSEN_GE_CONST_H;
+    /* The generator is public, so comparing it in variable time is fine. */
+    if (gen_table == NULL && secp256k1_fe_equal_var(&genp->x, &h.x) && secp256k1_fe_equal_var(&genp->y, &h.y)) {
+        gen_table = &secp256k1_pedersen_h_prec_table[0][0];
+    }
+#endif
+    if (gen_table != NULL) {
+        secp256k1_pedersen_ecmult_small_table(r, gn, gen_table);
+        return;
+    }
     secp256k1_pedersen_scalar_set_u64(&s, gn);
     secp256k1_ecmult_const(r, genp, &s, 64);
     secp256k1_scalar_clear(&s);
 }
 
+static void secp256k1_pedersen_small_fix_infinity(secp256k1_gej *r, uint64_t gn, const secp256k1_ge* genp) {
+    secp256k1_gej g;
+    /* G2 has prime order, so gn*G2 is infinity exactly when gn is 0. */
+    secp256k1_gej_set_ge(&g, genp);
+    secp256k1_gej_cmov(r, &g, gn == 0);
+}
+
+static void secp256k1_pedersen_add_small(secp256k1_gej *r, const secp256k1_ge *v, uint64_t gn) {
+    secp256k1_gej sum;
+    secp256k1_gej_add_ge(&sum, r, v);
+    secp256k1_gej_cmov(r, &sum, gn != 0);
+    secp256k1_gej_clear(&sum);
+}
+
 /* sec * G + value * G2. */
-SECP256K1_INLINE static void secp256k1_pedersen_ecmult(const secp256k1_ecmult_gen_context *ecmult_gen_ctx, secp256k1_gej *rj, const secp256k1_scalar *sec, uint64_t value, const secp256k1_ge* genp) {
+SECP256K1_INLINE static void secp256k1_pedersen_ecmult(const secp256k1_ecmult_gen_context *ecmult_gen_ctx, secp256k1_gej *rj, const secp256k1_scalar *sec, uint64_t value, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table) {
     secp256k1_gej vj;
+    secp256k1_ge v;
     secp256k1_ecmult_gen(ecmult_gen_ctx, rj, sec);
-    secp256k1_pedersen_ecmult_small(&vj, value, genp);
-    /* FIXME: constant time. */
-    secp256k1_gej_add_var(rj, rj, &vj, NULL);
+    secp256k1_pedersen_ecmult_small(&vj, value, genp, gen_table);
+    secp256k1_pedersen_small_fix_infinity(&vj, value, genp);
+    secp256k1_ge_set_gej(&v, &vj);
+    secp256k1_pedersen_add_small(rj, &v, value);
     secp256k1_gej_clear(&vj);
+    secp256k1_ge_clear(&v);
 }
 
 #endif
@@ -12,9 +12,25 @@
 #include "ecmult.h"
 #include "ecmult_gen.h"
 
+/* The parsed header of a range proof, which points into the buffer holding the proof. */
+typedef struct {
+    const unsigned char *proof;
+    size_t plen;
+    size_t offset; /* Length of the header in bytes. */
+    int exp;
+    int mantissa;
+    uint64_t scale;
+    uint64_t min_value;
+    uint64_t max_value;
+    size_t rings;
+    size_t npub;
+} secp256k1_rangeproof_header;
+
+static int secp256k1_rangeproof_header_parse(secp256k1_rangeproof_header *hdr, const unsigned char *proof, size_t plen);
+
 static int secp256k1_rangeproof_verify_impl(const secp256k1_ecmult_gen_context* ecmult_gen_ctx,
  unsigned char *blindout, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
- uint64_t *min_value, uint64_t *max_value, const secp256k1_ge *commit, const unsigned char *proof, size_t plen,
- const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp);
+ const secp256k1_ge *commit, const secp256k1_rangeproof_header *hdr,
+ const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table);
 
 #endif
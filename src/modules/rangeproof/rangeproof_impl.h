@@ -19,7 +19,7 @@
 #include "modules/rangeproof/borromean.h"
 
 SECP256K1_INLINE static void secp256k1_rangeproof_pub_expand(secp256k1_gej *pubs,
- int exp, size_t *rsizes, size_t rings, const secp256k1_ge* genp) {
+ int exp, const size_t *rsizes, size_t rings, const secp256k1_ge* genp) {
     secp256k1_gej base;
     size_t i;
     size_t j;
@@ -192,7 +192,7 @@ SECP256K1_INLINE static int secp256k1_range_proveparams(uint64_t *v, size_t *rin
 SECP256K1_INLINE static int secp256k1_rangeproof_sign_impl(const secp256k1_ecmult_gen_context* ecmult_gen_ctx,
  unsigned char *proof, size_t *plen, uint64_t min_value,
  const secp256k1_ge *commit, const unsigned char *blind, const unsigned char *nonce, int exp, int min_bits, uint64_t value,
- const unsigned char *message, size_t msg_len, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp){
+ const unsigned char *message, size_t msg_len, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table){
     secp256k1_gej pubs[128];     /* Candidate digits for our proof, most inferred. */
     secp256k1_scalar s[128];     /* Signatures in our proof, most forged. */
     secp256k1_scalar sec[32];    /* Blinding factors for the correct digits. */
@@ -296,7 +296,7 @@ SECP256K1_INLINE static int secp256k1_rangeproof_sign_impl(const secp256k1_ecmul
     npub = 0;
     for (i = 0; i < rings; i++) {
         /*OPT: Use the precomputed gen2 basis?*/
-        secp256k1_pedersen_ecmult(ecmult_gen_ctx, &pubs[npub], &sec[i], ((uint64_t)secidx[i] * scale) << (i*2), genp);
+        secp256k1_pedersen_ecmult(ecmult_gen_ctx, &pubs[npub], &sec[i], ((uint64_t)secidx[i] * scale) << (i*2), genp, gen_table);
         if (secp256k1_gej_is_infinity(&pubs[npub])) {
             return 0;
         }
@@ -360,13 +360,26 @@ SECP256K1_INLINE static void secp256k1_rangeproof_ch32xor(unsigned char *x, cons
     }
 }
 
+/* Checks whether tmp, an s value of the last ring xored with the prover's random stream, holds the value encoding
+ * of a rewindable proof, and decodes the value into v if so. */
+SECP256K1_INLINE static int secp256k1_rangeproof_decode_value(uint64_t *v, const unsigned char *tmp) {
+    size_t i;
+    if (!((tmp[0] & 128) && (memcmp(&tmp[16], &tmp[24], 8) == 0) && (memcmp(&tmp[8], &tmp[16], 8) == 0))) {
+        return 0;
+    }
+    *v = 0;
+    for (i = 0; i < 8; i++) {
+        *v = (*v << 8) + tmp[24 + i];
+    }
+    return 1;
+}
+
+/* Rewinds a proof given the prover's random values sec, s_orig and prep as reconstructed by
+ * secp256k1_rangeproof_genrand, which are modified. */
 SECP256K1_INLINE static int secp256k1_rangeproof_rewind_inner(secp256k1_scalar *blind, uint64_t *v,
- unsigned char *m, size_t *mlen, secp256k1_scalar *ev, secp256k1_scalar *s,
- size_t *rsizes, size_t rings, const unsigned char *nonce, const secp256k1_ge *commit, const unsigned char *proof, size_t len, const secp256k1_ge *genp) {
-    secp256k1_scalar s_orig[128];
-    secp256k1_scalar sec[32];
+ unsigned char *m, size_t *mlen, secp256k1_scalar *ev, secp256k1_scalar *s, secp256k1_scalar *sec, const secp256k1_scalar *s_orig, unsigned char *prep,
+ size_t *rsizes, size_t rings) {
     secp256k1_scalar stmp;
-    unsigned char prep[4096];
     unsigned char tmp[32];
     uint64_t value = 0;
     size_t offset;
@@ -379,9 +392,6 @@ SECP256K1_INLINE static int secp256k1_rangeproof_rewind_inner(secp256k1_scalar *
     npub = ((rings - 1) << 2) + rsizes[rings-1];
     VERIFY_CHECK(npub <= 128);
     VERIFY_CHECK(npub >= 1);
-    memset(prep, 0, 4096);
-    /* Reconstruct the provers random values. */
-    secp256k1_rangeproof_genrand(sec, s_orig, prep, rsizes, rings, nonce, commit, proof, len, genp);
     *v = UINT64_MAX;
     secp256k1_scalar_clear(blind);
     if (rings == 1 && rsizes[0] == 1) {
@@ -402,11 +412,7 @@ SECP256K1_INLINE static int secp256k1_rangeproof_rewind_inner(secp256k1_scalar *
         idx = npub + rsizes[rings - 1] - 1 - j;
         secp256k1_scalar_get_b32(tmp, &s[idx]);
         secp256k1_rangeproof_ch32xor(tmp, &prep[idx * 32]);
-        if ((tmp[0] & 128) && (memcmp(&tmp[16], &tmp[24], 8) == 0) && (memcmp(&tmp[8], &tmp[16], 8) == 0)) {
-            value = 0;
-            for (i = 0; i < 8; i++) {
-                value = (value << 8) + tmp[24 + i];
-            }
+        if (secp256k1_rangeproof_decode_value(&value, tmp)) {
             if (v) {
                 *v = value;
             }
@@ -472,17 +478,42 @@ SECP256K1_INLINE static int secp256k1_rangeproof_rewind_inner(secp256k1_scalar *
         }
     }
     *mlen = offset;
-    memset(prep, 0, 4096);
-    for (i = 0; i < 128; i++) {
-        secp256k1_scalar_clear(&s_orig[i]);
-    }
-    for (i = 0; i < 32; i++) {
-        secp256k1_scalar_clear(&sec[i]);
-    }
     secp256k1_scalar_clear(&stmp);
     return 1;
 }
 
+/* Checks, using only the prover's random stream prep and no elliptic curve operations, whether rewinding the proof
+ * can succeed, i.e. whether the last ring carries a value encoding in the right position. Wallets rewind many proofs
+ * that were made with another nonce, and this rejects almost all of them before they are verified. */
+SECP256K1_INLINE static int secp256k1_rangeproof_rewind_precheck(const unsigned char *prep, const size_t *rsizes, const secp256k1_rangeproof_header *hdr) {
+    unsigned char tmp[32];
+    const unsigned char *s_last;
+    const size_t rings = hdr->rings;
+    const size_t npub = (rings - 1) << 2;
+    uint64_t value;
+    size_t j;
+    int ret = 0;
+    if (rings == 1 && rsizes[0] == 1) {
+        /* Nothing is encoded in proofs of an exact value. */
+        return 1;
+    }
+    /* The s values follow the sign bits, the rings - 1 blinded points and e0. */
+    s_last = &hdr->proof[hdr->offset + ((rings + 6) >> 3) + 32 * rings + 32 * npub];
+    /* secp256k1_rangeproof_header_parse checked plen against the full ring layout. */
+    VERIFY_CHECK(s_last + 32 * rsizes[rings - 1] <= hdr->proof + hdr->plen);
+    for (j = 0; j < 2; j++) {
+        size_t idx = rsizes[rings - 1] - 1 - j;
+        memcpy(tmp, &s_last[idx * 32], 32);
+        secp256k1_rangeproof_ch32xor(tmp, &prep[(npub + idx) * 32]);
+        if (secp256k1_rangeproof_decode_value(&value, tmp)) {
+            ret = idx != ((value >> ((rings - 1) << 1)) & 3);
+            break;
+        }
+    }
+    memset(tmp, 0, 32);
+    return ret;
+}
+
 SECP256K1_INLINE static int secp256k1_rangeproof_getheader_impl(size_t *offset, int *exp, int *mantissa, uint64_t *scale,
  uint64_t *min_value, uint64_t *max_value, const unsigned char *proof, size_t plen) {
     int i;
@@ -536,54 +567,58 @@ SECP256K1_INLINE static int secp256k1_rangeproof_getheader_impl(size_t *offset,
     return 1;
 }
 
-/* Verifies range proof (len plen) for commit, the min/max values proven are put in the min/max arguments; returns 0 on failure 1 on success.*/
-SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecmult_gen_context* ecmult_gen_ctx,
- unsigned char *blindout, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
- uint64_t *min_value, uint64_t *max_value, const secp256k1_ge *commit, const unsigned char *proof, size_t plen, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp) {
+/* Parses the header of a proof and derives its ring layout. Returns 0 if the proof is malformed or its length does
+ * not match that layout. On success hdr points into proof, which must not change while hdr is in use. */
+SECP256K1_INLINE static int secp256k1_rangeproof_header_parse(secp256k1_rangeproof_header *hdr, const unsigned char *proof, size_t plen) {
+    hdr->offset = 0;
+    if (!secp256k1_rangeproof_getheader_impl(&hdr->offset, &hdr->exp, &hdr->mantissa, &hdr->scale, &hdr->min_value, &hdr->max_value, proof, plen)) {
+        return 0;
+    }
+    hdr->rings = 1;
+    hdr->npub = 1;
+    if (hdr->mantissa != 0) {
+        hdr->rings = (hdr->mantissa >> 1) + (hdr->mantissa & 1);
+        hdr->npub = ((hdr->mantissa >> 1) << 2) + ((hdr->mantissa & 1) << 1);
+    }
+    VERIFY_CHECK(hdr->rings <= 32);
+    if (plen - hdr->offset != ((hdr->rings + 6) >> 3) + 32 * (hdr->rings - 1) + 32 + 32 * hdr->npub) {
+        return 0;
+    }
+    hdr->proof = proof;
+    hdr->plen = plen;
+    return 1;
+}
+
+/* Writes the sizes of the rings of a parsed proof to rsizes, which must have room for hdr->rings entries. */
+SECP256K1_INLINE static void secp256k1_rangeproof_header_rsizes(size_t *rsizes, const secp256k1_rangeproof_header *hdr) {
+    size_t i;
+    if (hdr->mantissa == 0) {
+        rsizes[0] = 1;
+        return;
+    }
+    for (i = 0; i < (size_t)(hdr->mantissa >> 1); i++) {
+        rsizes[i] = 4;
+    }
+    if (hdr->mantissa & 1) {
+        rsizes[i] = 2;
+    }
+}
+
+/* Loads the body of a proof whose header was parsed by secp256k1_rangeproof_header_parse: computes the ring
+ * public keys and s values, the message hash m and points e0 into the proof. Returns 0 if the proof is malformed. */
+SECP256K1_INLINE static int secp256k1_rangeproof_verify_load(secp256k1_gej *pubs, secp256k1_scalar *s, const unsigned char **e0, unsigned char *m,
+ const secp256k1_rangeproof_header *hdr, const size_t *rsizes, const secp256k1_ge *commit,
+ const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table) {
+    const unsigned char *proof = hdr->proof;
+    const size_t rings = hdr->rings;
+    size_t offset = hdr->offset;
     secp256k1_gej accj;
-    secp256k1_gej pubs[128];
     secp256k1_ge c;
-    secp256k1_scalar s[128];
-    secp256k1_scalar evalues[128]; /* Challenges, only used during proof rewind. */
     secp256k1_sha256 sha256_m;
-    size_t rsizes[32];
-    int ret;
     size_t i;
-    int exp;
-    int mantissa;
-    size_t offset;
-    size_t rings;
     int overflow;
     size_t npub;
-    int offset_post_header;
-    uint64_t scale;
     unsigned char signs[31];
-    unsigned char m[33];
-    const unsigned char *e0;
-    offset = 0;
-    if (!secp256k1_rangeproof_getheader_impl(&offset, &exp, &mantissa, &scale, min_value, max_value, proof, plen)) {
-        return 0;
-    }
-    offset_post_header = offset;
-    rings = 1;
-    rsizes[0] = 1;
-    npub = 1;
-    if (mantissa != 0) {
-        rings = (mantissa >> 1);
-        for (i = 0; i < rings; i++) {
-            rsizes[i] = 4;
-        }
-        npub = (mantissa >> 1) << 2;
-        if (mantissa & 1) {
-            rsizes[rings] = 2;
-            npub += rsizes[rings];
-            rings++;
-        }
-    }
-    VERIFY_CHECK(rings <= 32);
-    if (plen - offset < 32 * (npub + rings - 1) + 32 + ((rings+6) >> 3)) {
-        return 0;
-    }
     secp256k1_sha256_initialize(&sha256_m);
     secp256k1_rangeproof_serialize_point(m, commit);
     secp256k1_sha256_write(&sha256_m, m, 33);
@@ -602,8 +637,8 @@ SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecm
     }
     npub = 0;
     secp256k1_gej_set_infinity(&accj);
-    if (*min_value) {
-        secp256k1_pedersen_ecmult_small(&accj, *min_value, genp);
+    if (hdr->min_value) {
+        secp256k1_pedersen_ecmult_small(&accj, hdr->min_value, genp, gen_table);
     }
     for(i = 0; i < rings - 1; i++) {
         secp256k1_fe fe;
@@ -628,9 +663,9 @@ SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecm
     if (secp256k1_gej_is_infinity(&pubs[npub])) {
         return 0;
     }
-    secp256k1_rangeproof_pub_expand(pubs, exp, rsizes, rings, genp);
+    secp256k1_rangeproof_pub_expand(pubs, hdr->exp, rsizes, rings, genp);
     npub += rsizes[rings - 1];
-    e0 = &proof[offset];
+    *e0 = &proof[offset];
     offset += 32;
     for (i = 0; i < npub; i++) {
         secp256k1_scalar_set_b32(&s[i], &proof[offset], &overflow);
@@ -639,14 +674,31 @@ SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecm
         }
         offset += 32;
     }
-    if (offset != plen) {
-        /*Extra data found, reject.*/
-        return 0;
-    }
+    VERIFY_CHECK(offset == hdr->plen);
     if (extra_commit != NULL) {
         secp256k1_sha256_write(&sha256_m, extra_commit, extra_commit_len);
     }
     secp256k1_sha256_finalize(&sha256_m, m);
+    return 1;
+}
+
+/* Verifies the range proof parsed into hdr for commit and, if nonce is not NULL, rewinds it using the prover's random
+ * values sec, s_orig and prep; returns 0 on failure 1 on success.*/
+SECP256K1_INLINE static int secp256k1_rangeproof_verify_inner(const secp256k1_ecmult_gen_context* ecmult_gen_ctx,
+ unsigned char *blindout, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
+ secp256k1_scalar *sec, const secp256k1_scalar *s_orig, unsigned char *prep, size_t *rsizes,
+ const secp256k1_ge *commit, const secp256k1_rangeproof_header *hdr, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table) {
+    secp256k1_gej accj;
+    secp256k1_gej pubs[128];
+    secp256k1_scalar s[128];
+    secp256k1_scalar evalues[128]; /* Challenges, only used during proof rewind. */
+    const size_t rings = hdr->rings;
+    int ret;
+    unsigned char m[33];
+    const unsigned char *e0;
+    if (!secp256k1_rangeproof_verify_load(pubs, s, &e0, m, hdr, rsizes, commit, extra_commit, extra_commit_len, genp, gen_table)) {
+        return 0;
+    }
     ret = secp256k1_borromean_verify(nonce ? evalues : NULL, e0, s, pubs, rsizes, rings, m, 32);
     if (ret && nonce) {
         /* Given the nonce, try rewinding the witness to recover its initial state. */
@@ -655,13 +707,13 @@ SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecm
         if (!ecmult_gen_ctx) {
             return 0;
         }
-        if (!secp256k1_rangeproof_rewind_inner(&blind, &vv, message_out, outlen, evalues, s, rsizes, rings, nonce, commit, proof, offset_post_header, genp)) {
+        if (!secp256k1_rangeproof_rewind_inner(&blind, &vv, message_out, outlen, evalues, s, sec, s_orig, prep, rsizes, rings)) {
             return 0;
         }
         /* Unwind apparently successful, see if the commitment can be reconstructed. */
         /* FIXME: should check vv is in the mantissa's range. */
-        vv = (vv * scale) + *min_value;
-        secp256k1_pedersen_ecmult(ecmult_gen_ctx, &accj, &blind, vv, genp);
+        vv = (vv * hdr->scale) + hdr->min_value;
+        secp256k1_pedersen_ecmult(ecmult_gen_ctx, &accj, &blind, vv, genp, gen_table);
         if (secp256k1_gej_is_infinity(&accj)) {
             return 0;
         }
@@ -680,4 +732,40 @@ SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecm
     return ret;
 }
 
+/* Verifies the range proof parsed into hdr for commit and, if nonce is not NULL, rewinds it; returns 0 on failure 1 on success.*/
+SECP256K1_INLINE static int secp256k1_rangeproof_verify_impl(const secp256k1_ecmult_gen_context* ecmult_gen_ctx,
+ unsigned char *blindout, uint64_t *value_out, unsigned char *message_out, size_t *outlen, const unsigned char *nonce,
+ const secp256k1_ge *commit, const secp256k1_rangeproof_header *hdr, const unsigned char *extra_commit, size_t extra_commit_len, const secp256k1_ge* genp, const secp256k1_ge_storage *gen_table) {
+    secp256k1_scalar s_orig[128];
+    secp256k1_scalar sec[32];
+    unsigned char prep[4096];
+    size_t rsizes[32];
+    size_t i;
+    int ret = 1;
+    secp256k1_rangeproof_header_rsizes(rsizes, hdr);
+    if (nonce) {
+        /* Reconstruct the prover's random values once, for both the precheck and the rewind. */
+        memset(prep, 0, 4096);
+        secp256k1_rangeproof_genrand(sec, s_orig, prep, rsizes, hdr->rings, nonce, commit, hdr->proof, hdr->offset, genp);
+        ret = secp256k1_rangeproof_rewind_precheck(prep, rsizes, hdr);
+        if (!ret && outlen) {
+            *outlen = 0;
+        }
+    }
+    if (ret) {
+        ret = secp256k1_rangeproof_verify_inner(ecmult_gen_ctx, blindout, value_out, message_out, outlen, nonce, sec, s_orig, prep, rsizes,
+         commit, hdr, extra_commit, extra_commit_len, genp, gen_table);
+    }
+    if (nonce) {
+        memset(prep, 0, 4096);
+        for (i = 0; i < 128; i++) {
+            secp256k1_scalar_clear(&s_orig[i]);
+        }
+        for (i = 0; i < 32; i++) {
+            secp256k1_scalar_clear(&sec[i]);
+        }
+    }
+    return ret;
+}
+
 #endif
@@ -19,6 +19,8 @@
 static void test_pedersen_api(const secp256k1_context *none, const secp256k1_context *sign, const secp256k1_context *vrfy, const secp256k1_context *sttc, const int32_t *ecount) {
     secp256k1_pedersen_commitment commit;
     const secp256k1_pedersen_commitment *commit_ptr = &commit;
+    secp256k1_pedersen_commitment_expanded ecommit;
+    const secp256k1_pedersen_commitment_expanded *ecommit_ptr = &ecommit;
     unsigned char blind[32];
     unsigned char blind_out[32];
     const unsigned char *blind_ptr = blind;
@@ -61,19 +63,50 @@ static void test_pedersen_api(const secp256k1_context *none, const secp256k1_con
     CHECK(*ecount == 8);
     CHECK(secp256k1_pedersen_verify_tally(none, &commit_ptr, 1, NULL, 1) == 0);
     CHECK(*ecount == 9);
+    CHECK(secp256k1_pedersen_verify_tally_batch(none, NULL, &commit_ptr, 1, &commit_ptr, 1) != 0);
+    CHECK(secp256k1_pedersen_verify_tally_batch(none, NULL, NULL, 0, NULL, 0) != 0);
+    CHECK(secp256k1_pedersen_verify_tally_batch(none, NULL, NULL, 1, &commit_ptr, 1) == 0);
+    CHECK(*ecount == 10);
+    CHECK(secp256k1_pedersen_verify_tally_batch(none, NULL, &commit_ptr, 1, NULL, 1) == 0);
+    CHECK(*ecount == 11);
+    CHECK(secp256k1_pedersen_commitment_expand(none, &ecommit, &commit) != 0);
+    CHECK(secp256k1_pedersen_verify_tally_expanded(none, NULL, &ecommit_ptr, 1, &ecommit_ptr, 1) != 0);
+    CHECK(*ecount == 11);
+    CHECK(secp256k1_pedersen_commitment_expand(none, NULL, &commit) == 0);
+    CHECK(*ecount == 12);
+    CHECK(secp256k1_pedersen_commitment_expand(none, &ecommit, NULL) == 0);
+    CHECK(*ecount == 13);
+    CHECK(secp256k1_pedersen_verify_tally_expanded(none, NULL, NULL, 1, &ecommit_ptr, 1) == 0);
+    CHECK(*ecount == 14);
+    CHECK(secp256k1_pedersen_verify_tally_expanded(none, NULL, &ecommit_ptr, 1, NULL, 1) == 0);
+    CHECK(*ecount == 15);
 
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, &val, &blind_ptr, &blind_out_ptr, 1, 0) != 0);
-    CHECK(*ecount == 9);
+    CHECK(*ecount == 15);
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, &val, &blind_ptr, &blind_out_ptr, 1, 1) == 0);
-    CHECK(*ecount == 10);
+    CHECK(*ecount == 16);
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, &val, &blind_ptr, &blind_out_ptr, 0, 0) == 0);
-    CHECK(*ecount == 11);
+    CHECK(*ecount == 17);
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, NULL, &blind_ptr, &blind_out_ptr, 1, 0) == 0);
-    CHECK(*ecount == 12);
+    CHECK(*ecount == 18);
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, &val, NULL, &blind_out_ptr, 1, 0) == 0);
-    CHECK(*ecount == 13);
+    CHECK(*ecount == 19);
     CHECK(secp256k1_pedersen_blind_generator_blind_sum(none, &val, &blind_ptr, NULL, 1, 0) == 0);
-    CHECK(*ecount == 14);
+    CHECK(*ecount == 20);
+
+    CHECK(secp256k1_pedersen_commit_batch(sign, NULL, &commit, &blind_ptr, &val, &secp256k1_generator_h, 1) != 0);
+    CHECK(secp256k1_pedersen_commit_batch(none, NULL, NULL, NULL, NULL, NULL, 0) != 0);
+    CHECK(*ecount == 20);
+    CHECK(secp256k1_pedersen_commit_batch(sttc, NULL, &commit, &blind_ptr, &val, &secp256k1_generator_h, 1) == 0);
+    CHECK(*ecount == 21);
+    CHECK(secp256k1_pedersen_commit_batch(sign, NULL, NULL, &blind_ptr, &val, &secp256k1_generator_h, 1) == 0);
+    CHECK(*ecount == 22);
+    CHECK(secp256k1_pedersen_commit_batch(sign, NULL, &commit, NULL, &val, &secp256k1_generator_h, 1) == 0);
+    CHECK(*ecount == 23);
+    CHECK(secp256k1_pedersen_commit_batch(sign, NULL, &commit, &blind_ptr, NULL, &secp256k1_generator_h, 1) == 0);
+    CHECK(*ecount == 24);
+    CHECK(secp256k1_pedersen_commit_batch(sign, NULL, &commit, &blind_ptr, &val, NULL, 1) == 0);
+    CHECK(*ecount == 25);
 }
 
 static void test_rangeproof_api(const secp256k1_context *none, const secp256k1_context *sign, const secp256k1_context *vrfy, const secp256k1_context *both, const secp256k1_context *sttc, const int32_t *ecount) {
@@ -225,6 +258,140 @@ static void test_rangeproof_api(const secp256k1_context *none, const secp256k1_c
         CHECK(secp256k1_rangeproof_rewind(both, blind_out, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, proof, len, NULL, 0, NULL) == 0);
         CHECK(*ecount == 29);
     }
+    {
+        const secp256k1_pedersen_commitment *commit_ptr = &commit;
+        const unsigned char *proof_ptr = proof;
+        const unsigned char *ext_commit_ptr = ext_commit;
+        const secp256k1_generator *gen_ptr = secp256k1_generator_h;
+        secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(none, 1024 * 1024);
+        uint64_t min_value;
+        uint64_t max_value;
+        size_t failed_index;
+
+        CHECK(secp256k1_rangeproof_verify_batch(none, scratch, &failed_index, &min_value, &max_value, &commit_ptr, &proof_ptr, &len, &ext_commit_ptr, &ext_commit_len, &gen_ptr, 1) == 1);
+        CHECK(min_value == vmin);
+        CHECK(max_value >= val);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, NULL, NULL, NULL, NULL, &commit_ptr, &proof_ptr, &len, &ext_commit_ptr, &ext_commit_len, &gen_ptr, 1) == 1);
+        CHECK(*ecount == 29);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, NULL, &proof_ptr, &len, &ext_commit_ptr, &ext_commit_len, &gen_ptr, 1) == 0);
+        CHECK(*ecount == 30);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, &commit_ptr, NULL, &len, &ext_commit_ptr, &ext_commit_len, &gen_ptr, 1) == 0);
+        CHECK(*ecount == 31);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, &commit_ptr, &proof_ptr, NULL, &ext_commit_ptr, &ext_commit_len, &gen_ptr, 1) == 0);
+        CHECK(*ecount == 32);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, &commit_ptr, &proof_ptr, &len, &ext_commit_ptr, &ext_commit_len, NULL, 1) == 0);
+        CHECK(*ecount == 33);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, &commit_ptr, &proof_ptr, &len, NULL, &ext_commit_len, &gen_ptr, 1) == 0);
+        CHECK(*ecount == 34);
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0) == 1);
+        CHECK(*ecount == 34);
+        /* The proof commits to ext_commit, so verifying it without fails */
+        failed_index = 1;
+        CHECK(secp256k1_rangeproof_verify_batch(vrfy, scratch, &failed_index, NULL, NULL, &commit_ptr, &proof_ptr, &len, NULL, NULL, &gen_ptr, 1) == 0);
+        CHECK(*ecount == 34);
+        CHECK(failed_index == 0);
+        secp256k1_scratch_space_destroy(none, scratch);
+    }
+    {
+        unsigned char proof2[5134];
+        size_t len2 = sizeof(proof2);
+        secp256k1_pedersen_commitment commit2;
+        uint64_t value_out;
+        uint64_t min_value;
+        uint64_t max_value;
+        secp256k1_generator_table *table = secp256k1_generator_table_create(none, secp256k1_generator_h);
+
+        CHECK(table != NULL);
+        CHECK(*ecount == 34);
+        CHECK(secp256k1_generator_table_create(none, NULL) == NULL);
+        CHECK(*ecount == 35);
+
+        CHECK(secp256k1_pedersen_commit_with_table(sign, &commit2, blind, val, table) == 1);
+        CHECK(memcmp(commit2.data, commit.data, 33) == 0);
+        CHECK(*ecount == 35);
+        CHECK(secp256k1_pedersen_commit_with_table(sttc, &commit2, blind, val, table) == 0);
+        CHECK(*ecount == 36);
+        CHECK(secp256k1_pedersen_commit_with_table(sign, NULL, blind, val, table) == 0);
+        CHECK(*ecount == 37);
+        CHECK(secp256k1_pedersen_commit_with_table(sign, &commit2, NULL, val, table) == 0);
+        CHECK(*ecount == 38);
+        CHECK(secp256k1_pedersen_commit_with_table(sign, &commit2, blind, val, NULL) == 0);
+        CHECK(*ecount == 39);
+
+        CHECK(secp256k1_rangeproof_sign_with_table(both, proof2, &len2, vmin, &commit, blind, commit.data, 0, 0, val, message, mlen, ext_commit, ext_commit_len, table) == 1);
+        CHECK(*ecount == 39);
+        CHECK(secp256k1_rangeproof_sign_with_table(sttc, proof2, &len2, vmin, &commit, blind, commit.data, 0, 0, val, message, mlen, ext_commit, ext_commit_len, table) == 0);
+        CHECK(*ecount == 40);
+        CHECK(secp256k1_rangeproof_sign_with_table(both, proof2, &len2, vmin, &commit, blind, commit.data, 0, 0, val, message, mlen, ext_commit, ext_commit_len, NULL) == 0);
+        CHECK(*ecount == 41);
+
+        CHECK(secp256k1_rangeproof_rewind_with_table(both, NULL, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, proof2, len2, ext_commit, ext_commit_len, table) == 1);
+        CHECK(value_out == val);
+        CHECK(*ecount == 41);
+        CHECK(secp256k1_rangeproof_rewind_with_table(sttc, NULL, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, proof2, len2, ext_commit, ext_commit_len, table) == 0);
+        CHECK(*ecount == 42);
+        CHECK(secp256k1_rangeproof_rewind_with_table(both, NULL, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, proof2, len2, ext_commit, ext_commit_len, NULL) == 0);
+        CHECK(*ecount == 43);
+
+        secp256k1_generator_table_destroy(table);
+        secp256k1_generator_table_destroy(NULL);
+    }
+    {
+        secp256k1_rangeproof_view view;
+        secp256k1_rangeproof_view view2;
+        unsigned char blind_out[32];
+        uint64_t value_out;
+        uint64_t min_value;
+        uint64_t max_value;
+        int exp;
+        int mantissa;
+
+        CHECK(secp256k1_rangeproof_view_parse(none, &view, proof, len) == 1);
+        CHECK(*ecount == 43);
+        CHECK(secp256k1_rangeproof_view_parse(none, NULL, proof, len) == 0);
+        CHECK(*ecount == 44);
+        CHECK(secp256k1_rangeproof_view_parse(none, &view2, NULL, len) == 0);
+        CHECK(*ecount == 45);
+        CHECK(secp256k1_rangeproof_view_parse(none, &view2, proof, len - 1) == 0);
+        CHECK(*ecount == 45);
+
+        CHECK(secp256k1_rangeproof_info_view(none, &exp, &mantissa, &min_value, &max_value, &view) == 1);
+        CHECK(exp == 0);
+        CHECK(min_value == vmin);
+        CHECK(max_value >= val);
+        CHECK(*ecount == 45);
+        CHECK(secp256k1_rangeproof_info_view(none, NULL, &mantissa, &min_value, &max_value, &view) == 0);
+        CHECK(*ecount == 46);
+        CHECK(secp256k1_rangeproof_info_view(none, &exp, &mantissa, &min_value, &max_value, NULL) == 0);
+        CHECK(*ecount == 47);
+        /* view2 was cleared by the failed parse */
+        CHECK(secp256k1_rangeproof_info_view(none, &exp, &mantissa, &min_value, &max_value, &view2) == 0);
+        CHECK(*ecount == 48);
+
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, &commit, &view, ext_commit, ext_commit_len, secp256k1_generator_h) == 1);
+        CHECK(*ecount == 48);
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, NULL, &view, ext_commit, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 49);
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, &commit, NULL, ext_commit, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 50);
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, &commit, &view, NULL, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 51);
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, &commit, &view, NULL, 0, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 51);
+        CHECK(secp256k1_rangeproof_verify_view(none, &min_value, &max_value, &commit, &view, ext_commit, ext_commit_len, NULL) == 0);
+        CHECK(*ecount == 52);
+
+        CHECK(secp256k1_rangeproof_rewind_view(both, blind_out, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, &view, ext_commit, ext_commit_len, secp256k1_generator_h) == 1);
+        CHECK(value_out == val);
+        CHECK(memcmp(blind_out, blind, 32) == 0);
+        CHECK(*ecount == 52);
+        CHECK(secp256k1_rangeproof_rewind_view(sttc, blind_out, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, &view, ext_commit, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 53);
+        CHECK(secp256k1_rangeproof_rewind_view(both, blind_out, &value_out, NULL, 0, NULL, &min_value, &max_value, &commit, &view, ext_commit, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 54);
+        CHECK(secp256k1_rangeproof_rewind_view(both, blind_out, &value_out, NULL, 0, commit.data, &min_value, &max_value, &commit, NULL, ext_commit, ext_commit_len, secp256k1_generator_h) == 0);
+        CHECK(*ecount == 55);
+    }
 }
 
 static void test_api(void) {
@@ -318,6 +485,185 @@ static void test_pedersen(void) {
     CHECK(secp256k1_pedersen_verify_tally(ctx, &cptr[1], 1, &cptr[1], 1));
 }
 
+static void test_pedersen_verify_tally_batch(void) {
+    secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    secp256k1_scratch_space *small_scratch = secp256k1_scratch_space_create(ctx, 8 * 1024);
+    secp256k1_pedersen_commitment commits[201];
+    secp256k1_pedersen_commitment_expanded ecommits[201];
+    const secp256k1_pedersen_commitment *pos[204];
+    const secp256k1_pedersen_commitment *neg[5];
+    const secp256k1_pedersen_commitment_expanded *epos[204];
+    const secp256k1_pedersen_commitment_expanded *eneg[5];
+    unsigned char blinds[201 * 32];
+    const unsigned char *bptr[200];
+    uint64_t values[201];
+    secp256k1_scratch_space *scratches[3];
+    int i, j;
+
+    scratches[0] = NULL;
+    scratches[1] = scratch;
+    scratches[2] = small_scratch;
+    values[200] = 0;
+    for (i = 0; i < 200; i++) {
+        secp256k1_scalar s;
+        random_scalar_order(&s);
+        secp256k1_scalar_get_b32(&blinds[i * 32], &s);
+        bptr[i] = &blinds[i * 32];
+        values[i] = secp256k1_testrand32();
+        values[200] += values[i];
+        CHECK(secp256k1_pedersen_commit(ctx, &commits[i], &blinds[i * 32], values[i], secp256k1_generator_h));
+    }
+    CHECK(secp256k1_pedersen_blind_sum(ctx, &blinds[200 * 32], bptr, 200, 200));
+    CHECK(secp256k1_pedersen_commit(ctx, &commits[200], &blinds[200 * 32], values[200], secp256k1_generator_h));
+    for (i = 0; i < 201; i++) {
+        CHECK(secp256k1_pedersen_commitment_expand(ctx, &ecommits[i], &commits[i]));
+    }
+
+    /* c200 commits to the sum of c0, ..., c199. With pos = (c0, c0, c0, c0, ..., c199, c0)
+     * and neg = (c200, c0, c0, c0, c0), the first pairs of the combined list exercise
+     * doubling and cancellation in the affine additions. */
+    neg[0] = &commits[200];
+    for (i = 1; i < 5; i++) {
+        neg[i] = &commits[0];
+    }
+    for (i = 0; i < 3; i++) {
+        pos[i] = &commits[0];
+    }
+    for (i = 0; i < 200; i++) {
+        pos[i + 3] = &commits[i];
+    }
+    pos[203] = &commits[0];
+    for (i = 0; i < 204; i++) {
+        epos[i] = &ecommits[pos[i] - commits];
+    }
+    for (i = 0; i < 5; i++) {
+        eneg[i] = &ecommits[neg[i] - commits];
+    }
+    for (j = 0; j < 3; j++) {
+        CHECK(secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], pos, 204, neg, 5));
+        CHECK(secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], neg, 5, pos, 204));
+        CHECK(!secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], pos, 203, neg, 5));
+        CHECK(!secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], &pos[1], 203, neg, 5));
+        CHECK(secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], &pos[3], 200, neg, 1));
+        CHECK(!secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], &pos[3], 199, neg, 1));
+        CHECK(secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], pos, 3, pos, 3));
+        CHECK(secp256k1_pedersen_verify_tally_batch(ctx, scratches[j], NULL, 0, NULL, 0));
+        CHECK(secp256k1_pedersen_verify_tally_expanded(ctx, scratches[j], epos, 204, eneg, 5));
+        CHECK(secp256k1_pedersen_verify_tally_expanded(ctx, scratches[j], eneg, 5, epos, 204));
+        CHECK(!secp256k1_pedersen_verify_tally_expanded(ctx, scratches[j], epos, 203, eneg, 5));
+        CHECK(!secp256k1_pedersen_verify_tally_expanded(ctx, scratches[j], &epos[1], 203, eneg, 5));
+    }
+    CHECK(secp256k1_pedersen_verify_tally(ctx, pos, 204, neg, 5));
+    CHECK(!secp256k1_pedersen_verify_tally(ctx, pos, 203, neg, 5));
+
+    secp256k1_scratch_space_destroy(ctx, scratch);
+    secp256k1_scratch_space_destroy(ctx, small_scratch);
+}
+
+/* Check the fixed-base table for H against a generic multiplication. */
+static void test_pedersen_ecmult_small_h(void) {
+    static const secp256k1_ge h = SECP256K1_PEDERSEN_GE_CONST_H;
+    secp256k1_ge genp;
+    int i;
+
+    secp256k1_generator_load(&genp, secp256k1_generator_h);
+    ge_equals_ge(&genp, &h);
+    for (i = 0; i < 64 + 4; i++) {
+        secp256k1_gej rj, expj;
+        secp256k1_scalar s;
+        uint64_t value;
+        if (i < 64) {
+            value = (uint64_t)1 << i;
+        } else if (i == 64) {
+            value = 0;
+        } else if (i == 65) {
+            value = UINT64_MAX;
+        } else {
+            value = ((uint64_t)secp256k1_testrand32() << 32) | secp256k1_testrand32();
+        }
+        secp256k1_pedersen_ecmult_small(&rj, value, &genp, NULL);
+        secp256k1_pedersen_scalar_set_u64(&s, value);
+        secp256k1_ecmult_const(&expj, &genp, &s, 64);
+        if (value == 0) {
+            CHECK(secp256k1_gej_is_infinity(&rj));
+        } else {
+            secp256k1_ge r;
+            secp256k1_ge_set_gej(&r, &rj);
+            ge_equals_gej(&r, &expj);
+        }
+    }
+}
+
+static void test_pedersen_commit_batch(void) {
+    secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    secp256k1_scratch_space *small_scratch = secp256k1_scratch_space_create(ctx, 1024);
+    secp256k1_pedersen_commitment commits[150];
+    secp256k1_pedersen_commitment expected[150];
+    secp256k1_generator gen[3];
+    const secp256k1_generator *gens[150];
+    unsigned char blind[150][32];
+    const unsigned char *blinds[150];
+    uint64_t values[150];
+    unsigned char seed[32];
+    int i;
+
+    secp256k1_testrand256(seed);
+    CHECK(secp256k1_generator_generate(ctx, &gen[0], seed));
+    secp256k1_testrand256(seed);
+    CHECK(secp256k1_generator_generate(ctx, &gen[1], seed));
+    /* A copy of gen[0] at a different address, to test that runs are detected by value. */
+    gen[2] = gen[0];
+    for (i = 0; i < 150; i++) {
+        secp256k1_testrand256(blind[i]);
+        blinds[i] = blind[i];
+        values[i] = ((uint64_t)secp256k1_testrand32() << 32) | secp256k1_testrand32();
+        if (i < 20) {
+            gens[i] = &gen[0];
+        } else if (i < 30) {
+            gens[i] = secp256k1_generator_h;
+        } else if (i < 33) {
+            gens[i] = &gen[1];
+        } else if (i < 60) {
+            gens[i] = (i & 1) ? &gen[0] : &gen[2];
+        } else if (i < 140) {
+            gens[i] = &gen[1];
+        } else {
+            gens[i] = (i & 1) ? &gen[1] : secp256k1_generator_h;
+        }
+    }
+    values[0] = 0;
+    values[1] = UINT64_MAX;
+    values[100] = 0;
+    /* Commitments only use 33 bytes of their data, so clear the rest to allow comparing them. */
+    memset(expected, 0, sizeof(expected));
+    memset(commits, 0, sizeof(commits));
+    for (i = 0; i < 150; i++) {
+        CHECK(secp256k1_pedersen_commit(ctx, &expected[i], blinds[i], values[i], gens[i]));
+    }
+
+    CHECK(secp256k1_pedersen_commit_batch(ctx, NULL, commits, blinds, values, gens, 150));
+    CHECK(secp256k1_memcmp_var(commits, expected, sizeof(expected)) == 0);
+    memset(commits, 0, sizeof(commits));
+    CHECK(secp256k1_pedersen_commit_batch(ctx, scratch, commits, blinds, values, gens, 150));
+    CHECK(secp256k1_memcmp_var(commits, expected, sizeof(expected)) == 0);
+    memset(commits, 0, sizeof(commits));
+    CHECK(secp256k1_pedersen_commit_batch(ctx, small_scratch, commits, blinds, values, gens, 150));
+    CHECK(secp256k1_memcmp_var(commits, expected, sizeof(expected)) == 0);
+    for (i = 0; i < 150; i += 37) {
+        memset(commits, 0, sizeof(commits));
+        CHECK(secp256k1_pedersen_commit_batch(ctx, scratch, commits, &blinds[i], &values[i], &gens[i], 150 - i));
+        CHECK(secp256k1_memcmp_var(commits, &expected[i], (150 - i) * sizeof(expected[0])) == 0);
+    }
+
+    /* An overflowing blinding factor anywhere fails the whole batch. */
+    memset(blind[90], 0xff, 32);
+    CHECK(!secp256k1_pedersen_commit_batch(ctx, scratch, commits, blinds, values, gens, 150));
+    CHECK(!secp256k1_pedersen_commit_batch(ctx, NULL, commits, blinds, values, gens, 150));
+
+    secp256k1_scratch_space_destroy(ctx, scratch);
+    secp256k1_scratch_space_destroy(ctx, small_scratch);
+}
+
 static void test_borromean(void) {
     unsigned char e0[32];
     secp256k1_scalar s[64];
@@ -547,7 +893,276 @@ static void test_rangeproof(void) {
     }
 }
 
+static void test_rangeproof_view(void) {
+    secp256k1_pedersen_commitment commit;
+    secp256k1_rangeproof_view view;
+    unsigned char proof[5134 + 1];
+    unsigned char blind[32];
+    unsigned char blindout[32];
+    unsigned char message[4096];
+    unsigned char message_view[4096];
+    size_t mlen;
+    size_t mlen_view;
+    size_t len;
+    uint64_t v;
+    uint64_t vmin;
+    uint64_t vout;
+    uint64_t minv;
+    uint64_t maxv;
+    uint64_t minv_view;
+    uint64_t maxv_view;
+    int exp;
+    int mantissa;
+    int exp_view;
+    int mantissa_view;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        int min_bits = (int)secp256k1_testrandi64(0, 64);
+        v = secp256k1_testrandi64(0, UINT64_MAX >> (secp256k1_testrand32() & 63));
+        vmin = (secp256k1_testrand32() & 1) ? secp256k1_testrandi64(0, v) : 0;
+        exp = (int)secp256k1_testrandi64(0, 3) - 1;
+        secp256k1_testrand256(blind);
+        CHECK(secp256k1_pedersen_commit(ctx, &commit, blind, v, secp256k1_generator_h));
+        len = 5134;
+        CHECK(secp256k1_rangeproof_sign(ctx, proof, &len, vmin, &commit, blind, commit.data, exp, min_bits, v, NULL, 0, NULL, 0, secp256k1_generator_h));
+
+        /* The view gives the same results as the functions that take the proof */
+        CHECK(secp256k1_rangeproof_view_parse(ctx, &view, proof, len));
+        CHECK(secp256k1_rangeproof_info(ctx, &exp, &mantissa, &minv, &maxv, proof, len));
+        CHECK(secp256k1_rangeproof_info_view(ctx, &exp_view, &mantissa_view, &minv_view, &maxv_view, &view));
+        CHECK(exp == exp_view && mantissa == mantissa_view && minv == minv_view && maxv == maxv_view);
+        CHECK(secp256k1_rangeproof_verify_view(ctx, &minv_view, &maxv_view, &commit, &view, NULL, 0, secp256k1_generator_h));
+        CHECK(minv == minv_view && maxv == maxv_view);
+        mlen = sizeof(message);
+        mlen_view = sizeof(message_view);
+        CHECK(secp256k1_rangeproof_rewind(ctx, blindout, &vout, message, &mlen, commit.data, &minv, &maxv, &commit, proof, len, NULL, 0, secp256k1_generator_h));
+        CHECK(secp256k1_rangeproof_rewind_view(ctx, blindout, &vout, message_view, &mlen_view, commit.data, &minv_view, &maxv_view, &commit, &view, NULL, 0, secp256k1_generator_h));
+        CHECK(vout == v);
+        CHECK(memcmp(blindout, blind, 32) == 0);
+        CHECK(mlen == mlen_view);
+        CHECK(memcmp(message, message_view, mlen) == 0);
+        CHECK(!secp256k1_rangeproof_rewind_view(ctx, blindout, &vout, NULL, NULL, blind, &minv_view, &maxv_view, &commit, &view, NULL, 0, secp256k1_generator_h));
+
+        /* Changes to the body of the proof are seen through the view */
+        proof[len - 1] ^= 1;
+        CHECK(!secp256k1_rangeproof_verify_view(ctx, &minv_view, &maxv_view, &commit, &view, NULL, 0, secp256k1_generator_h));
+        proof[len - 1] ^= 1;
+        CHECK(secp256k1_rangeproof_verify_view(ctx, &minv_view, &maxv_view, &commit, &view, NULL, 0, secp256k1_generator_h));
+
+        /* Proofs with missing or trailing bytes cannot be parsed */
+        CHECK(!secp256k1_rangeproof_view_parse(ctx, &view, proof, len - 1));
+        CHECK(!secp256k1_rangeproof_view_parse(ctx, &view, proof, len + 1));
+    }
+}
+
+static void test_rangeproof_rewind_precheck(void) {
+    secp256k1_pedersen_commitment commit;
+    unsigned char proof[5134];
+    unsigned char blind[32];
+    unsigned char nonce[32];
+    unsigned char blindout[32];
+    unsigned char message[4096];
+    size_t msg_len;
+    size_t len;
+    size_t e0_offset;
+    uint64_t v;
+    uint64_t vout;
+    uint64_t minv;
+    uint64_t maxv;
+    int exp;
+    int mantissa;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        int min_bits = (int)secp256k1_testrandi64(1, 64);
+        v = secp256k1_testrandi64(0, UINT64_MAX >> (64 - min_bits));
+        secp256k1_testrand256(blind);
+        secp256k1_testrand256(nonce);
+        CHECK(secp256k1_pedersen_commit(ctx, &commit, blind, v, secp256k1_generator_h));
+        len = sizeof(proof);
+        CHECK(secp256k1_rangeproof_sign(ctx, proof, &len, 0, &commit, blind, nonce, 0, min_bits, v, NULL, 0, NULL, 0, secp256k1_generator_h));
+        CHECK(secp256k1_rangeproof_rewind(ctx, blindout, &vout, NULL, NULL, nonce, &minv, &maxv, &commit, proof, len, NULL, 0, secp256k1_generator_h));
+        CHECK(vout == v);
+        CHECK(memcmp(blindout, blind, 32) == 0);
+
+        /* A foreign nonce is rejected, the range is still reported and no message is recovered */
+        nonce[secp256k1_testrand_int(32)] ^= 1 << secp256k1_testrand_int(8);
+        minv = maxv = 1;
+        msg_len = sizeof(message);
+        CHECK(!secp256k1_rangeproof_rewind(ctx, blindout, &vout, message, &msg_len, nonce, &minv, &maxv, &commit, proof, len, NULL, 0, secp256k1_generator_h));
+        CHECK(minv == 0);
+        CHECK(maxv >= v);
+        CHECK(msg_len == 0);
+
+        /* An invalid proof which carries the value encoding of the right nonce is still rejected */
+        len = sizeof(proof);
+        CHECK(secp256k1_rangeproof_sign(ctx, proof, &len, 0, &commit, blind, nonce, 0, min_bits, v, NULL, 0, NULL, 0, secp256k1_generator_h));
+        CHECK(secp256k1_rangeproof_info(ctx, &exp, &mantissa, &minv, &maxv, proof, len));
+        CHECK(exp == 0 && mantissa == min_bits);
+        e0_offset = 2 + ((min_bits + 1) / 2 + 6) / 8 + 32 * ((min_bits + 1) / 2 - 1);
+        proof[e0_offset + secp256k1_testrand_int(32)] ^= 1 << secp256k1_testrand_int(8);
+        CHECK(!secp256k1_rangeproof_rewind(ctx, blindout, &vout, NULL, NULL, nonce, &minv, &maxv, &commit, proof, len, NULL, 0, secp256k1_generator_h));
+    }
+}
+
 #define MAX_N_GENS	30
+static void test_rangeproof_verify_batch(void) {
+    enum { N_PROOFS = 6 };
+    const unsigned char extra[19] = "Do not go gentle...";
+    secp256k1_pedersen_commitment commits[N_PROOFS];
+    secp256k1_generator gens[N_PROOFS];
+    unsigned char proofs[N_PROOFS][5134];
+    secp256k1_pedersen_commitment_expanded ecommits[N_PROOFS];
+    const secp256k1_pedersen_commitment *commit_ptrs[N_PROOFS];
+    const secp256k1_pedersen_commitment_expanded *ecommit_ptrs[N_PROOFS];
+    const secp256k1_generator *gen_ptrs[N_PROOFS];
+    const unsigned char *proof_ptrs[N_PROOFS];
+    const unsigned char *extra_ptrs[N_PROOFS];
+    size_t extra_lens[N_PROOFS];
+    size_t plens[N_PROOFS];
+    uint64_t min_values[N_PROOFS];
+    uint64_t max_values[N_PROOFS];
+    secp256k1_scratch_space *scratch_large = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    secp256k1_scratch_space *scratch_medium = secp256k1_scratch_space_create(ctx, 40000);
+    secp256k1_scratch_space *scratch_tiny = secp256k1_scratch_space_create(ctx, 100);
+    size_t failed_index;
+    size_t i;
+
+    for (i = 0; i < N_PROOFS; i++) {
+        unsigned char blind[32];
+        unsigned char seed[32];
+        uint64_t value = secp256k1_testrand32();
+        uint64_t min_value = secp256k1_testrand32() & 1 ? 0 : value >> (secp256k1_testrand32() & 31);
+        secp256k1_testrand256(blind);
+        secp256k1_testrand256(seed);
+        if (i & 1) {
+            CHECK(secp256k1_generator_generate(ctx, &gens[i], seed));
+        } else {
+            gens[i] = *secp256k1_generator_h;
+        }
+        extra_ptrs[i] = i % 3 == 0 ? extra : NULL;
+        extra_lens[i] = i % 3 == 0 ? sizeof(extra) : 0;
+        plens[i] = sizeof(proofs[i]);
+        CHECK(secp256k1_pedersen_commit(ctx, &commits[i], blind, value, &gens[i]));
+        CHECK(secp256k1_rangeproof_sign(ctx, proofs[i], &plens[i], min_value, &commits[i], blind, seed, secp256k1_testrand_int(3) - 1, secp256k1_testrand_int(65), value, NULL, 0, extra_ptrs[i], extra_lens[i], &gens[i]));
+        CHECK(secp256k1_pedersen_commitment_expand(ctx, &ecommits[i], &commits[i]));
+        commit_ptrs[i] = &commits[i];
+        ecommit_ptrs[i] = &ecommits[i];
+        gen_ptrs[i] = &gens[i];
+        proof_ptrs[i] = proofs[i];
+    }
+
+    CHECK(secp256k1_rangeproof_verify_batch(ctx, scratch_large, &failed_index, min_values, max_values, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+    for (i = 0; i < N_PROOFS; i++) {
+        uint64_t min_value;
+        uint64_t max_value;
+        CHECK(secp256k1_rangeproof_verify(ctx, &min_value, &max_value, &commits[i], proofs[i], plens[i], extra_ptrs[i], extra_lens[i], &gens[i]));
+        CHECK(min_value == min_values[i]);
+        CHECK(max_value == max_values[i]);
+    }
+    CHECK(secp256k1_rangeproof_verify_batch(ctx, scratch_medium, &failed_index, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+    CHECK(secp256k1_rangeproof_verify_batch(ctx, scratch_tiny, &failed_index, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+    CHECK(secp256k1_rangeproof_verify_batch(ctx, NULL, &failed_index, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+
+    /* Expanded commitments give the same results. */
+    CHECK(secp256k1_rangeproof_verify_batch_expanded(ctx, scratch_large, &failed_index, min_values, max_values, ecommit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+    for (i = 0; i < N_PROOFS; i++) {
+        uint64_t min_value;
+        uint64_t max_value;
+        CHECK(secp256k1_rangeproof_verify_expanded(ctx, &min_value, &max_value, &ecommits[i], proofs[i], plens[i], extra_ptrs[i], extra_lens[i], &gens[i]));
+        CHECK(min_value == min_values[i]);
+        CHECK(max_value == max_values[i]);
+    }
+    CHECK(secp256k1_rangeproof_verify_batch_expanded(ctx, NULL, &failed_index, NULL, NULL, ecommit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+
+    /* Corrupt one proof at a time and check that it is identified. */
+    for (i = 0; i < N_PROOFS; i++) {
+        size_t pos = secp256k1_testrand_int(plens[i]);
+        unsigned char bit = 1 << secp256k1_testrand_int(8);
+        proofs[i][pos] ^= bit;
+        failed_index = N_PROOFS;
+        CHECK(!secp256k1_rangeproof_verify_batch(ctx, scratch_large, &failed_index, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+        CHECK(failed_index == i);
+        CHECK(!secp256k1_rangeproof_verify_batch(ctx, scratch_medium, NULL, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+        failed_index = N_PROOFS;
+        CHECK(!secp256k1_rangeproof_verify_batch_expanded(ctx, scratch_large, &failed_index, NULL, NULL, ecommit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+        CHECK(failed_index == i);
+        proofs[i][pos] ^= bit;
+    }
+    /* Swapping two commitments breaks both proofs; the first one is reported. */
+    commit_ptrs[1] = &commits[4];
+    commit_ptrs[4] = &commits[1];
+    CHECK(!secp256k1_rangeproof_verify_batch(ctx, scratch_large, &failed_index, NULL, NULL, commit_ptrs, proof_ptrs, plens, extra_ptrs, extra_lens, gen_ptrs, N_PROOFS));
+    CHECK(failed_index == 1);
+    CHECK(!secp256k1_rangeproof_verify_expanded(ctx, &min_values[0], &max_values[0], &ecommits[4], proofs[1], plens[1], extra_ptrs[1], extra_lens[1], &gens[1]));
+
+    secp256k1_scratch_space_destroy(ctx, scratch_large);
+    secp256k1_scratch_space_destroy(ctx, scratch_medium);
+    secp256k1_scratch_space_destroy(ctx, scratch_tiny);
+}
+
+static void test_generator_table(void) {
+    /* Commitments and proofs made with a generator table are the same as without. */
+    secp256k1_generator gen;
+    secp256k1_generator_table *table;
+    secp256k1_pedersen_commitment commit;
+    secp256k1_pedersen_commitment commit_table;
+    unsigned char seed[32];
+    unsigned char blind[32];
+    unsigned char blind_out[32];
+    unsigned char nonce[32];
+    unsigned char proof[5134];
+    unsigned char proof_table[5134];
+    size_t len;
+    size_t len_table;
+    uint64_t value;
+    uint64_t value_out;
+    uint64_t min_value;
+    uint64_t max_value;
+    int i;
+
+    secp256k1_testrand256(seed);
+    secp256k1_testrand256(blind);
+    CHECK(secp256k1_generator_generate_blinded(ctx, &gen, seed, blind));
+    table = secp256k1_generator_table_create(ctx, &gen);
+    CHECK(table != NULL);
+
+    for (i = 0; i < 2 * count + 2; i++) {
+        switch (i) {
+        case 0: value = 0; break;
+        case 1: value = UINT64_MAX; break;
+        default: value = secp256k1_testrand64() >> secp256k1_testrand_int(64);
+        }
+        secp256k1_testrand256(blind);
+        memset(&commit, 0, sizeof(commit));
+        memset(&commit_table, 0, sizeof(commit_table));
+        CHECK(secp256k1_pedersen_commit(ctx, &commit, blind, value, &gen));
+        CHECK(secp256k1_pedersen_commit_with_table(ctx, &commit_table, blind, value, table));
+        CHECK(memcmp(&commit, &commit_table, sizeof(commit)) == 0);
+    }
+
+    value = secp256k1_testrand64() >> 1;
+    secp256k1_testrand256(blind);
+    secp256k1_testrand256(nonce);
+    CHECK(secp256k1_pedersen_commit(ctx, &commit, blind, value, &gen));
+    len = sizeof(proof);
+    len_table = sizeof(proof_table);
+    CHECK(secp256k1_rangeproof_sign(ctx, proof, &len, 0, &commit, blind, nonce, 0, 0, value, NULL, 0, NULL, 0, &gen));
+    CHECK(secp256k1_rangeproof_sign_with_table(ctx, proof_table, &len_table, 0, &commit, blind, nonce, 0, 0, value, NULL, 0, NULL, 0, table));
+    CHECK(len == len_table);
+    CHECK(memcmp(proof, proof_table, len) == 0);
+    CHECK(secp256k1_rangeproof_rewind_with_table(ctx, blind_out, &value_out, NULL, 0, nonce, &min_value, &max_value, &commit, proof, len, NULL, 0, table));
+    CHECK(value_out == value);
+    CHECK(memcmp(blind_out, blind, 32) == 0);
+    /* A table for another generator does not rewind the proof. */
+    secp256k1_generator_table_destroy(table);
+    table = secp256k1_generator_table_create(ctx, secp256k1_generator_h);
+    CHECK(table != NULL);
+    CHECK(!secp256k1_rangeproof_rewind_with_table(ctx, blind_out, &value_out, NULL, 0, nonce, &min_value, &max_value, &commit, proof, len, NULL, 0, table));
+    secp256k1_generator_table_destroy(table);
+}
+
 void test_multiple_generators(void) {
     const size_t n_inputs = (secp256k1_testrand32() % (MAX_N_GENS / 2)) + 1;
     const size_t n_outputs = (secp256k1_testrand32() % (MAX_N_GENS / 2)) + 1;
@@ -701,10 +1316,17 @@ void run_rangeproof_tests(void) {
     for (i = 0; i < count / 2 + 1; i++) {
         test_pedersen();
     }
+    test_pedersen_ecmult_small_h();
+    test_pedersen_commit_batch();
+    test_pedersen_verify_tally_batch();
+    test_generator_table();
     for (i = 0; i < count / 2 + 1; i++) {
         test_borromean();
     }
     test_rangeproof();
+    test_rangeproof_view();
+    test_rangeproof_rewind_precheck();
+    test_rangeproof_verify_batch();
     test_multiple_generators();
 }
 
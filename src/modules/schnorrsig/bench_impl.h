@@ -19,6 +19,9 @@ typedef struct {
     const unsigned char **pk;
     const unsigned char **sigs;
     const unsigned char **msgs;
+    const secp256k1_xonly_pubkey **pubkeys;
+    size_t *msglens;
+    secp256k1_scratch_space *scratch;
 } bench_schnorrsig_data;
 
 void bench_schnorrsig_sign(void* arg, int iters) {
@@ -45,6 +48,12 @@ void bench_schnorrsig_verify(void* arg, int iters) {
     }
 }
 
+void bench_schnorrsig_verify_batch(void* arg, int iters) {
+    bench_schnorrsig_data *data = (bench_schnorrsig_data *)arg;
+
+    CHECK(secp256k1_schnorrsig_verify_batch(data->ctx, data->scratch, NULL, data->sigs, data->msgs, data->msglens, data->pubkeys, iters));
+}
+
 void run_schnorrsig_bench(int iters, int argc, char** argv) {
     int i;
     bench_schnorrsig_data data;
@@ -55,6 +64,9 @@ void run_schnorrsig_bench(int iters, int argc, char** argv) {
     data.pk = (const unsigned char **)malloc(iters * sizeof(unsigned char *));
     data.msgs = (const unsigned char **)malloc(iters * sizeof(unsigned char *));
     data.sigs = (const unsigned char **)malloc(iters * sizeof(unsigned char *));
+    data.pubkeys = (const secp256k1_xonly_pubkey **)malloc(iters * sizeof(secp256k1_xonly_pubkey *));
+    data.msglens = (size_t *)malloc(iters * sizeof(size_t));
+    data.scratch = secp256k1_scratch_space_create(data.ctx, 8 * 1024 * 1024);
 
     CHECK(MSGLEN >= 4);
     for (i = 0; i < iters; i++) {
@@ -63,7 +75,7 @@ void run_schnorrsig_bench(int iters, int argc, char** argv) {
         unsigned char *sig = (unsigned char *)malloc(64);
         secp256k1_keypair *keypair = (secp256k1_keypair *)malloc(sizeof(*keypair));
         unsigned char *pk_char = (unsigned char *)malloc(32);
-        secp256k1_xonly_pubkey pk;
+        secp256k1_xonly_pubkey *pk = (secp256k1_xonly_pubkey *)malloc(sizeof(*pk));
         msg[0] = sk[0] = i;
         msg[1] = sk[1] = i >> 8;
         msg[2] = sk[2] = i >> 16;
@@ -75,26 +87,33 @@ void run_schnorrsig_bench(int iters, int argc, char** argv) {
         data.pk[i] = pk_char;
         data.msgs[i] = msg;
         data.sigs[i] = sig;
+        data.pubkeys[i] = pk;
+        data.msglens[i] = MSGLEN;
 
         CHECK(secp256k1_keypair_create(data.ctx, keypair, sk));
         CHECK(secp256k1_schnorrsig_sign_custom(data.ctx, sig, msg, MSGLEN, keypair, NULL));
-        CHECK(secp256k1_keypair_xonly_pub(data.ctx, &pk, NULL, keypair));
-        CHECK(secp256k1_xonly_pubkey_serialize(data.ctx, pk_char, &pk) == 1);
+        CHECK(secp256k1_keypair_xonly_pub(data.ctx, pk, NULL, keypair));
+        CHECK(secp256k1_xonly_pubkey_serialize(data.ctx, pk_char, pk) == 1);
     }
 
     if (d || have_flag(argc, argv, "schnorrsig") || have_flag(argc, argv, "sign") || have_flag(argc, argv, "schnorrsig_sign")) run_benchmark("schnorrsig_sign", bench_schnorrsig_sign, NULL, NULL, (void *) &data, 10, iters);
     if (d || have_flag(argc, argv, "schnorrsig") || have_flag(argc, argv, "verify") || have_flag(argc, argv, "schnorrsig_verify")) run_benchmark("schnorrsig_verify", bench_schnorrsig_verify, NULL, NULL, (void *) &data, 10, iters);
+    if (d || have_flag(argc, argv, "schnorrsig") || have_flag(argc, argv, "verify") || have_flag(argc, argv, "schnorrsig_verify_batch")) run_benchmark("schnorrsig_verify_batch", bench_schnorrsig_verify_batch, NULL, NULL, (void *) &data, 10, iters);
 
     for (i = 0; i < iters; i++) {
         free((void *)data.keypairs[i]);
         free((void *)data.pk[i]);
         free((void *)data.msgs[i]);
         free((void *)data.sigs[i]);
+        free((void *)data.pubkeys[i]);
     }
     free(data.keypairs);
     free(data.pk);
     free(data.msgs);
     free(data.sigs);
+    free(data.pubkeys);
+    free(data.msglens);
+    secp256k1_scratch_space_destroy(data.ctx, data.scratch);
 
     secp256k1_context_destroy(data.ctx);
 }
@@ -10,37 +10,18 @@
 #include "../../../include/secp256k1.h"
 #include "../../../include/secp256k1_schnorrsig.h"
 #include "../../hash.h"
+#include "../../precomputed_tagged_hash.h"
 
 /* Initializes SHA256 with fixed midstate. This midstate was computed by applying
  * SHA256 to SHA256("BIP0340/nonce")||SHA256("BIP0340/nonce"). */
 static void secp256k1_nonce_function_bip340_sha256_tagged(secp256k1_sha256 *sha) {
-    secp256k1_sha256_initialize(sha);
-    sha->s[0] = 0x46615b35ul;
-    sha->s[1] = 0xf4bfbff7ul;
-    sha->s[2] = 0x9f8dc671ul;
-    sha->s[3] = 0x83627ab3ul;
-    sha->s[4] = 0x60217180ul;
-    sha->s[5] = 0x57358661ul;
-    sha->s[6] = 0x21a29e54ul;
-    sha->s[7] = 0x68b07b4cul;
-
-    sha->bytes = 64;
+    secp256k1_sha256_initialize_tagged_bip340_nonce(sha);
 }
 
 /* Initializes SHA256 with fixed midstate. This midstate was computed by applying
  * SHA256 to SHA256("BIP0340/aux")||SHA256("BIP0340/aux"). */
 static void secp256k1_nonce_function_bip340_sha256_tagged_aux(secp256k1_sha256 *sha) {
-    secp256k1_sha256_initialize(sha);
-    sha->s[0] = 0x24dd3219ul;
-    sha->s[1] = 0x4eba7e70ul;
-    sha->s[2] = 0xca0fabb9ul;
-    sha->s[3] = 0x0fa3166dul;
-    sha->s[4] = 0x3afbe4b1ul;
-    sha->s[5] = 0x4c44df97ul;
-    sha->s[6] = 0x4aac2739ul;
-    sha->s[7] = 0x249e850aul;
-
-    sha->bytes = 64;
+    secp256k1_sha256_initialize_tagged_bip340_aux(sha);
 }
 
 /* algo argument for nonce_function_bip340 to derive the nonce exactly as stated in BIP-340
@@ -101,16 +82,7 @@ const secp256k1_nonce_function_hardened secp256k1_nonce_function_bip340 = nonce_
 /* Initializes SHA256 with fixed midstate. This midstate was computed by applying
  * SHA256 to SHA256("BIP0340/challenge")||SHA256("BIP0340/challenge"). */
 static void secp256k1_schnorrsig_sha256_tagged(secp256k1_sha256 *sha) {
-    secp256k1_sha256_initialize(sha);
-    sha->s[0] = 0x9cecba11ul;
-    sha->s[1] = 0x23925381ul;
-    sha->s[2] = 0x11679112ul;
-    sha->s[3] = 0xd1627e0ful;
-    sha->s[4] = 0x97c87550ul;
-    sha->s[5] = 0x003cc765ul;
-    sha->s[6] = 0x90f61164ul;
-    sha->s[7] = 0x33e9b66aul;
-    sha->bytes = 64;
+    secp256k1_sha256_initialize_tagged_bip340_challenge(sha);
 }
 
 static void secp256k1_schnorrsig_challenge(secp256k1_scalar* e, const unsigned char *r32, const unsigned char *msg, size_t msglen, const unsigned char *pubkey32)
@@ -260,4 +232,124 @@ int secp256k1_schnorrsig_verify(const secp256k1_context* ctx, const unsigned cha
            secp256k1_fe_equal_var(&rx, &r.x);
 }
 
+typedef struct {
+    const secp256k1_context *ctx;
+    unsigned char seed[32];
+    const unsigned char * const *sig64;
+    const unsigned char * const *msg;
+    const size_t *msglen;
+    const secp256k1_xonly_pubkey * const *pubkey;
+} secp256k1_schnorrsig_verify_batch_data;
+
+/* Callback for secp256k1_ecmult_multi_var. Point 2*i is R_i with scalar -a_i,
+ * point 2*i + 1 is P_i with scalar -a_i*e_i. The points are lifted lazily so
+ * that no storage proportional to the batch size is needed. */
+static int secp256k1_schnorrsig_verify_batch_ecmult_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *cbdata) {
+    const secp256k1_schnorrsig_verify_batch_data *data = (const secp256k1_schnorrsig_verify_batch_data *) cbdata;
+    size_t i = idx >> 1;
+
+    secp256k1_scalar_batch_randomizer(sc, data->seed, i);
+    secp256k1_scalar_negate(sc, sc);
+    if ((idx & 1) == 0) {
+        secp256k1_fe rx;
+        if (!secp256k1_fe_set_b32(&rx, &data->sig64[i][0])) {
+            return 0;
+        }
+        return secp256k1_ge_set_xo_var(pt, &rx, 0);
+    } else {
+        secp256k1_scalar e;
+        unsigned char buf[32];
+        if (!secp256k1_xonly_pubkey_load(data->ctx, pt, data->pubkey[i])) {
+            return 0;
+        }
+        secp256k1_fe_get_b32(buf, &pt->x);
+        secp256k1_schnorrsig_challenge(&e, &data->sig64[i][0], data->msg[i], data->msglen[i], buf);
+        secp256k1_scalar_mul(sc, sc, &e);
+        return 1;
+    }
+}
+
+/* Checks (sum a_i*s_i)*G - sum a_i*R_i - sum (a_i*e_i)*P_i = 0 for randomizers
+ * a_i derived from a hash of the whole batch. */
+static int secp256k1_schnorrsig_verify_batch_internal(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, const unsigned char * const *sig64, const unsigned char * const *msg, const size_t *msglen, const secp256k1_xonly_pubkey * const *pubkey, size_t n_sigs) {
+    secp256k1_schnorrsig_verify_batch_data data;
+    secp256k1_sha256 sha;
+    secp256k1_scalar sum;
+    secp256k1_gej rj;
+    size_t i;
+
+    /* Seed the randomizers with everything the batch commits to. */
+    secp256k1_sha256_initialize_tagged_bip340_batch(&sha);
+    for (i = 0; i < n_sigs; i++) {
+        unsigned char pk32[32];
+        unsigned char len[8];
+        int j;
+        if (!secp256k1_xonly_pubkey_serialize(ctx, pk32, pubkey[i])) {
+            return 0;
+        }
+        for (j = 0; j < 8; j++) {
+            len[j] = (unsigned char) ((uint64_t) msglen[i] >> (56 - 8 * j));
+        }
+        secp256k1_sha256_write(&sha, sig64[i], 64);
+        secp256k1_sha256_write(&sha, pk32, sizeof(pk32));
+        secp256k1_sha256_write(&sha, len, sizeof(len));
+        secp256k1_sha256_write(&sha, msg[i], msglen[i]);
+    }
+    secp256k1_sha256_finalize(&sha, data.seed);
+
+    secp256k1_scalar_clear(&sum);
+    for (i = 0; i < n_sigs; i++) {
+        secp256k1_scalar s;
+        secp256k1_scalar a;
+        int overflow;
+        secp256k1_scalar_set_b32(&s, &sig64[i][32], &overflow);
+        if (overflow) {
+            return 0;
+        }
+        secp256k1_scalar_batch_randomizer(&a, data.seed, i);
+        secp256k1_scalar_mul(&s, &s, &a);
+        secp256k1_scalar_add(&sum, &sum, &s);
+    }
+
+    data.ctx = ctx;
+    data.sig64 = sig64;
+    data.msg = msg;
+    data.msglen = msglen;
+    data.pubkey = pubkey;
+    if (!secp256k1_ecmult_multi_var(&ctx->error_callback, scratch, &rj, &sum, secp256k1_schnorrsig_verify_batch_ecmult_callback, (void *) &data, 2 * n_sigs)) {
+        return 0;
+    }
+    return secp256k1_gej_is_infinity(&rj);
+}
+
+int secp256k1_schnorrsig_verify_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index, const unsigned char * const *sig64, const unsigned char * const *msg, const size_t *msglen, const secp256k1_xonly_pubkey * const *pubkey, size_t n_sigs) {
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_sigs == 0 || sig64 != NULL);
+    ARG_CHECK(n_sigs == 0 || msg != NULL);
+    ARG_CHECK(n_sigs == 0 || msglen != NULL);
+    ARG_CHECK(n_sigs == 0 || pubkey != NULL);
+    ARG_CHECK(n_sigs <= SIZE_MAX / 2);
+    for (i = 0; i < n_sigs; i++) {
+        ARG_CHECK(sig64[i] != NULL);
+        ARG_CHECK(msg[i] != NULL || msglen[i] == 0);
+        ARG_CHECK(pubkey[i] != NULL);
+    }
+
+    if (secp256k1_schnorrsig_verify_batch_internal(ctx, scratch, sig64, msg, msglen, pubkey, n_sigs)) {
+        return 1;
+    }
+    if (failed_index != NULL) {
+        /* Only a failed batch pays for locating the first invalid signature. */
+        for (i = 0; i < n_sigs; i++) {
+            if (!secp256k1_schnorrsig_verify(ctx, sig64[i], msg[i], msglen[i], pubkey[i])) {
+                break;
+            }
+        }
+        *failed_index = i;
+    }
+    return 0;
+}
+
 #endif
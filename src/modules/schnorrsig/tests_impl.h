@@ -220,6 +220,34 @@ void test_schnorrsig_api(void) {
     CHECK(secp256k1_schnorrsig_verify(vrfy, sig, msg, sizeof(msg), &zero_pk) == 0);
     CHECK(ecount == 4);
 
+    ecount = 0;
+    {
+        const unsigned char *sig_ptr = sig;
+        const unsigned char *msg_ptr = msg;
+        const size_t msglen = sizeof(msg);
+        const secp256k1_xonly_pubkey *pk_ptr = &pk[0];
+        const secp256k1_xonly_pubkey *zero_pk_ptr = &zero_pk;
+        size_t failed_index;
+        CHECK(secp256k1_schnorrsig_verify_batch(none, NULL, NULL, &sig_ptr, &msg_ptr, &msglen, &pk_ptr, 1) == 1);
+        CHECK(ecount == 0);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, NULL, NULL, NULL, NULL, 0) == 1);
+        CHECK(ecount == 0);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, NULL, &msg_ptr, &msglen, &pk_ptr, 1) == 0);
+        CHECK(ecount == 1);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, &sig_ptr, NULL, &msglen, &pk_ptr, 1) == 0);
+        CHECK(ecount == 2);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, &sig_ptr, &msg_ptr, NULL, &pk_ptr, 1) == 0);
+        CHECK(ecount == 3);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, &sig_ptr, &msg_ptr, &msglen, NULL, 1) == 0);
+        CHECK(ecount == 4);
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, NULL, &sig_ptr, &msg_ptr, &msglen, &zero_pk_ptr, 1) == 0);
+        CHECK(ecount == 5);
+        failed_index = 1;
+        CHECK(secp256k1_schnorrsig_verify_batch(vrfy, NULL, &failed_index, &sig_ptr, &msg_ptr, &msglen, &zero_pk_ptr, 1) == 0);
+        CHECK(ecount == 7);
+        CHECK(failed_index == 0);
+    }
+
     secp256k1_context_destroy(none);
     secp256k1_context_destroy(sign);
     secp256k1_context_destroy(vrfy);
@@ -849,6 +877,70 @@ void test_schnorrsig_sign_verify(void) {
 }
 #undef N_SIGS
 
+void test_schnorrsig_verify_batch(void) {
+    enum { N_SIGS = 64 };
+    secp256k1_xonly_pubkey pk[N_SIGS];
+    const secp256k1_xonly_pubkey *pk_ptr[N_SIGS];
+    unsigned char msg[N_SIGS][32];
+    const unsigned char *msg_ptr[N_SIGS];
+    size_t msglen[N_SIGS];
+    unsigned char sig[N_SIGS][64];
+    const unsigned char *sig_ptr[N_SIGS];
+    secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    secp256k1_scratch_space *scratch_small = secp256k1_scratch_space_create(ctx, 4096);
+    unsigned char tmp[64];
+    size_t failed_index;
+    size_t n;
+    size_t i;
+
+    for (i = 0; i < N_SIGS; i++) {
+        unsigned char sk[32];
+        secp256k1_keypair keypair;
+        secp256k1_testrand256(sk);
+        CHECK(secp256k1_keypair_create(ctx, &keypair, sk));
+        CHECK(secp256k1_keypair_xonly_pub(ctx, &pk[i], NULL, &keypair));
+        secp256k1_testrand256(msg[i]);
+        msglen[i] = secp256k1_testrand_int(sizeof(msg[i]) + 1);
+        CHECK(secp256k1_schnorrsig_sign_custom(ctx, sig[i], msg[i], msglen[i], &keypair, NULL));
+        pk_ptr[i] = &pk[i];
+        msg_ptr[i] = msg[i];
+        sig_ptr[i] = sig[i];
+    }
+
+    CHECK(secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(secp256k1_schnorrsig_verify_batch(ctx, scratch_small, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(secp256k1_schnorrsig_verify_batch(ctx, NULL, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    n = 1 + secp256k1_testrand_int(N_SIGS);
+    CHECK(secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, n));
+
+    /* Invalid s value */
+    i = secp256k1_testrand_int(N_SIGS);
+    memcpy(tmp, sig[i], 64);
+    sig[i][32 + secp256k1_testrand_int(32)] ^= 1 << secp256k1_testrand_int(8);
+    CHECK(!secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(failed_index == i);
+    CHECK(!secp256k1_schnorrsig_verify_batch(ctx, scratch_small, NULL, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, i));
+    memcpy(sig[i], tmp, 64);
+
+    /* R is not a valid x coordinate */
+    i = secp256k1_testrand_int(N_SIGS);
+    memcpy(tmp, sig[i], 64);
+    memset(sig[i], 0xFF, 32);
+    CHECK(!secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(failed_index == i);
+    memcpy(sig[i], tmp, 64);
+
+    /* Two signatures with swapped public keys */
+    pk_ptr[3] = &pk[17];
+    pk_ptr[17] = &pk[3];
+    CHECK(!secp256k1_schnorrsig_verify_batch(ctx, scratch, &failed_index, sig_ptr, msg_ptr, msglen, pk_ptr, N_SIGS));
+    CHECK(failed_index == 3);
+
+    secp256k1_scratch_space_destroy(ctx, scratch);
+    secp256k1_scratch_space_destroy(ctx, scratch_small);
+}
+
 void test_schnorrsig_taproot(void) {
     unsigned char sk[32];
     secp256k1_keypair keypair;
@@ -896,6 +988,7 @@ void run_schnorrsig_tests(void) {
         test_schnorrsig_sign();
         test_schnorrsig_sign_verify();
     }
+    test_schnorrsig_verify_batch();
     test_schnorrsig_taproot();
 }
 
@@ -19,6 +19,8 @@
 #include "modules/surjection/surjection_impl.h"
 #include "hash.h"
 
+/* In reduced mode only proof generation, which keeps the ring on the stack, is
+ * limited. Verification walks the ring without storing it and is not limited. */
 #ifdef USE_REDUCED_SURJECTION_PROOF_SIZE
 #undef SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS
 #define SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS 16
@@ -44,9 +46,6 @@ static size_t secp256k1_count_bits_set(const unsigned char* data, size_t count)
     return ret;
 }
 
-#ifdef USE_REDUCED_SURJECTION_PROOF_SIZE
-static
-#endif
 int secp256k1_surjectionproof_parse(const secp256k1_context* ctx, secp256k1_surjectionproof *proof, const unsigned char *input, size_t inputlen) {
     size_t n_inputs;
     size_t signature_len;
@@ -214,8 +213,47 @@ void secp256k1_surjectionproof_destroy(secp256k1_surjectionproof* proof) {
     }
 }
 
+/* Marks in is_output_tag (a bitvector like proof->used_inputs) the inputs whose tag equals the output tag. */
+static void secp256k1_surjectionproof_mark_output_tag(unsigned char *is_output_tag, const secp256k1_fixed_asset_tag* fixed_input_tags, size_t n_input_tags, const secp256k1_fixed_asset_tag* fixed_output_tag) {
+    size_t i;
+    memset(is_output_tag, 0, SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS / 8);
+    for (i = 0; i < n_input_tags; i++) {
+        if (memcmp(&fixed_input_tags[i], fixed_output_tag, sizeof(*fixed_output_tag)) == 0) {
+            is_output_tag[i / 8] |= (1 << (i % 8));
+        }
+    }
+}
+
+/* One iteration of random selection: draws n_input_tags_to_use distinct inputs into
+ * proof->used_inputs. Returns 1 and sets *input_index if one of the draws was an input
+ * with the output tag. */
+static int secp256k1_surjectionproof_select_inputs(secp256k1_surjectionproof* proof, size_t *input_index, secp256k1_surjectionproof_csprng *csprng, const unsigned char *is_output_tag, size_t n_input_tags, size_t n_input_tags_to_use) {
+    int has_output_tag = 0;
+    size_t i;
+
+    /* obtain a random set of indices */
+    memset(proof->used_inputs, 0, sizeof(proof->used_inputs));
+    for (i = 0; i < n_input_tags_to_use; i++) {
+        while (1) {
+            size_t next_input_index;
+            next_input_index = secp256k1_surjectionproof_csprng_next(csprng, n_input_tags);
+            if (is_output_tag[next_input_index / 8] & (1 << (next_input_index % 8))) {
+                *input_index = next_input_index;
+                has_output_tag = 1;
+            }
+
+            if (!(proof->used_inputs[next_input_index / 8] & (1 << (next_input_index  % 8)))) {
+                proof->used_inputs[next_input_index / 8] |= (1 << (next_input_index % 8));
+                break;
+            }
+        }
+    }
+    return has_output_tag;
+}
+
 int secp256k1_surjectionproof_initialize(const secp256k1_context* ctx, secp256k1_surjectionproof* proof, size_t *input_index, const secp256k1_fixed_asset_tag* fixed_input_tags, const size_t n_input_tags, const size_t n_input_tags_to_use, const secp256k1_fixed_asset_tag* fixed_output_tag, const size_t n_max_iterations, const unsigned char *random_seed32) {
     secp256k1_surjectionproof_csprng csprng;
+    unsigned char is_output_tag[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS / 8];
     size_t n_iterations = 0;
 
     VERIFY_CHECK(ctx != NULL);
@@ -230,30 +268,12 @@ int secp256k1_surjectionproof_initialize(const secp256k1_context* ctx, secp256k1
     (void) ctx;
 
     secp256k1_surjectionproof_csprng_init(&csprng, random_seed32);
+    secp256k1_surjectionproof_mark_output_tag(is_output_tag, fixed_input_tags, n_input_tags, fixed_output_tag);
     memset(proof->data, 0, sizeof(proof->data));
     proof->n_inputs = n_input_tags;
 
     while (1) {
-        int has_output_tag = 0;
-        size_t i;
-
-        /* obtain a random set of indices */
-        memset(proof->used_inputs, 0, sizeof(proof->used_inputs));
-        for (i = 0; i < n_input_tags_to_use; i++) {
-            while (1) {
-                size_t next_input_index;
-                next_input_index = secp256k1_surjectionproof_csprng_next(&csprng, n_input_tags);
-                if (memcmp(&fixed_input_tags[next_input_index], fixed_output_tag, sizeof(*fixed_output_tag)) == 0) {
-                    *input_index = next_input_index;
-                    has_output_tag = 1;
-                }
-
-                if (!(proof->used_inputs[next_input_index / 8] & (1 << (next_input_index  % 8)))) {
-                    proof->used_inputs[next_input_index / 8] |= (1 << (next_input_index % 8));
-                    break;
-                }
-            }
-        }
+        int has_output_tag = secp256k1_surjectionproof_select_inputs(proof, input_index, &csprng, is_output_tag, n_input_tags, n_input_tags_to_use);
 
         /* Check if we succeeded */
         n_iterations++;
@@ -272,7 +292,58 @@ int secp256k1_surjectionproof_initialize(const secp256k1_context* ctx, secp256k1
     }
 }
 
-int secp256k1_surjectionproof_generate(const secp256k1_context* ctx, secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator* ephemeral_output_tag, size_t input_index, const unsigned char *input_blinding_key, const unsigned char *output_blinding_key) {
+int secp256k1_surjectionproof_initialize_range(const secp256k1_context* ctx, secp256k1_surjectionproof* proof, size_t *input_index, const secp256k1_fixed_asset_tag* fixed_input_tags, const size_t n_input_tags, const size_t n_input_tags_to_use, const secp256k1_fixed_asset_tag* fixed_output_tag, const size_t iteration_start, const size_t n_iterations, const unsigned char *random_seed32) {
+    unsigned char is_output_tag[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS / 8];
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(proof != NULL);
+    ARG_CHECK(input_index != NULL);
+    ARG_CHECK(fixed_input_tags != NULL);
+    ARG_CHECK(fixed_output_tag != NULL);
+    ARG_CHECK(random_seed32 != NULL);
+    ARG_CHECK(n_input_tags <= SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
+    ARG_CHECK(n_input_tags_to_use <= SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS);
+    ARG_CHECK(n_input_tags_to_use <= n_input_tags);
+    ARG_CHECK(n_iterations <= SIZE_MAX - iteration_start);
+    (void) ctx;
+
+    secp256k1_surjectionproof_mark_output_tag(is_output_tag, fixed_input_tags, n_input_tags, fixed_output_tag);
+    memset(proof->data, 0, sizeof(proof->data));
+    proof->n_inputs = n_input_tags;
+#ifdef VERIFY
+    proof->initialized = 0;
+#endif
+
+    for (i = iteration_start; i < iteration_start + n_iterations; i++) {
+        /* The random stream of iteration i is seeded with SHA256(random_seed32 || i), with i as
+         * a 64-bit big endian integer. */
+        secp256k1_surjectionproof_csprng csprng;
+        secp256k1_sha256 sha;
+        unsigned char iteration[8];
+        int j;
+        for (j = 0; j < 8; j++) {
+            iteration[j] = (uint64_t) i >> (56 - 8 * j);
+        }
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, random_seed32, 32);
+        secp256k1_sha256_write(&sha, iteration, sizeof(iteration));
+        secp256k1_sha256_finalize(&sha, csprng.state);
+        csprng.state_i = 0;
+
+        if (secp256k1_surjectionproof_select_inputs(proof, input_index, &csprng, is_output_tag, n_input_tags, n_input_tags_to_use)) {
+#ifdef VERIFY
+            proof->initialized = 1;
+#endif
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/* Generates a surjection proof using caller-provided buffers for the ring of up to max_used_pubkeys
+ * members. The public function keeps them on the stack, which is what reduced mode limits. */
+static int secp256k1_surjectionproof_generate_impl(const secp256k1_context* ctx, secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator* ephemeral_output_tag, size_t input_index, const unsigned char *input_blinding_key, const unsigned char *output_blinding_key, secp256k1_gej *ring_pubkeys, secp256k1_scalar *borromean_s, size_t max_used_pubkeys) {
     secp256k1_scalar blinding_key;
     secp256k1_scalar tmps;
     secp256k1_scalar nonce;
@@ -283,21 +354,8 @@ int secp256k1_surjectionproof_generate(const secp256k1_context* ctx, secp256k1_s
     size_t n_total_pubkeys;
     size_t n_used_pubkeys;
     size_t ring_input_index = 0;
-    secp256k1_gej ring_pubkeys[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
-    secp256k1_scalar borromean_s[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
     unsigned char msg32[32];
 
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
-    ARG_CHECK(proof != NULL);
-    ARG_CHECK(ephemeral_input_tags != NULL);
-    ARG_CHECK(ephemeral_output_tag != NULL);
-    ARG_CHECK(input_blinding_key != NULL);
-    ARG_CHECK(output_blinding_key != NULL);
-#ifdef VERIFY
-    CHECK(proof->initialized == 1);
-#endif
-
     /* Compute secret key */
     secp256k1_scalar_set_b32(&tmps, input_blinding_key, &overflow);
     if (overflow) {
@@ -321,6 +379,10 @@ int secp256k1_surjectionproof_generate(const secp256k1_context* ctx, secp256k1_s
     if (n_used_pubkeys > n_total_pubkeys || n_total_pubkeys != n_ephemeral_input_tags) {
         return 0;
     }
+    /* A parsed proof may use more inputs than the ring buffers can hold */
+    if (n_used_pubkeys > max_used_pubkeys) {
+        return 0;
+    }
 
     if (secp256k1_surjection_compute_public_keys(ring_pubkeys, n_used_pubkeys, ephemeral_input_tags, n_total_pubkeys, proof->used_inputs, ephemeral_output_tag, input_index, &ring_input_index) == 0) {
         return 0;
@@ -347,16 +409,88 @@ int secp256k1_surjectionproof_generate(const secp256k1_context* ctx, secp256k1_s
     return 1;
 }
 
-#ifdef USE_REDUCED_SURJECTION_PROOF_SIZE
-static
+int secp256k1_surjectionproof_generate(const secp256k1_context* ctx, secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator* ephemeral_output_tag, size_t input_index, const unsigned char *input_blinding_key, const unsigned char *output_blinding_key) {
+    secp256k1_gej ring_pubkeys[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
+    secp256k1_scalar borromean_s[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(proof != NULL);
+    ARG_CHECK(ephemeral_input_tags != NULL);
+    ARG_CHECK(ephemeral_output_tag != NULL);
+    ARG_CHECK(input_blinding_key != NULL);
+    ARG_CHECK(output_blinding_key != NULL);
+#ifdef VERIFY
+    CHECK(proof->initialized == 1);
 #endif
-int secp256k1_surjectionproof_verify(const secp256k1_context* ctx, const secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator* ephemeral_output_tag) {
-    size_t rsizes[1];    /* array needed for borromean sig API */
+
+    return secp256k1_surjectionproof_generate_impl(ctx, proof, ephemeral_input_tags, n_ephemeral_input_tags, ephemeral_output_tag, input_index, input_blinding_key, output_blinding_key, ring_pubkeys, borromean_s, SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS);
+}
+
+/* Verifies the single-ring Borromean signature of a surjection proof like secp256k1_borromean_verify
+ * would, but computes each ring member and parses each s value only when it is needed. The memory use
+ * does not depend on the number of inputs used by the proof. */
+static int secp256k1_surjectionproof_verify_ring(const secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_total_pubkeys, size_t n_used_pubkeys, const secp256k1_generator* ephemeral_output_tag, const unsigned char *msg32) {
+    secp256k1_sha256 sha256_e0;
+    secp256k1_ge output_tag;
+    secp256k1_ge tmpge;
+    secp256k1_gej pubkey;
+    secp256k1_gej rgej;
+    secp256k1_scalar en;
+    secp256k1_scalar s;
+    unsigned char tmp[33];
+    size_t size;
     size_t i;
+    size_t j;
+    int overflow;
+
+    secp256k1_borromean_hash(tmp, msg32, 32, &proof->data[0], 32, 0, 0);
+    secp256k1_scalar_set_b32(&en, tmp, &overflow);
+    if (overflow) {
+        return 0;
+    }
+    secp256k1_generator_load(&output_tag, ephemeral_output_tag);
+    j = 0;
+    for (i = 0; i < n_total_pubkeys; i++) {
+        if (!(proof->used_inputs[i / 8] & (1 << (i % 8)))) {
+            continue;
+        }
+        secp256k1_generator_load(&tmpge, &ephemeral_input_tags[i]);
+        secp256k1_ge_neg(&tmpge, &tmpge);
+        secp256k1_gej_set_ge(&pubkey, &tmpge);
+        secp256k1_gej_add_ge_var(&pubkey, &pubkey, &output_tag, NULL);
+
+        secp256k1_scalar_set_b32(&s, &proof->data[32 + 32 * j], &overflow);
+        if (overflow || secp256k1_scalar_is_zero(&s) || secp256k1_scalar_is_zero(&en) || secp256k1_gej_is_infinity(&pubkey)) {
+            return 0;
+        }
+        secp256k1_ecmult(&rgej, &pubkey, &en, &s);
+        if (secp256k1_gej_is_infinity(&rgej)) {
+            return 0;
+        }
+        secp256k1_ge_set_gej_var(&tmpge, &rgej);
+        secp256k1_eckey_pubkey_serialize(&tmpge, tmp, &size, 1);
+        j++;
+        if (j < n_used_pubkeys) {
+            secp256k1_borromean_hash(tmp, msg32, 32, tmp, 33, 0, j);
+            secp256k1_scalar_set_b32(&en, tmp, &overflow);
+            if (overflow) {
+                return 0;
+            }
+        }
+    }
+    VERIFY_CHECK(j == n_used_pubkeys);
+
+    secp256k1_sha256_initialize(&sha256_e0);
+    secp256k1_sha256_write(&sha256_e0, tmp, 33);
+    secp256k1_sha256_write(&sha256_e0, msg32, 32);
+    secp256k1_sha256_finalize(&sha256_e0, tmp);
+    return secp256k1_memcmp_var(&proof->data[0], tmp, 32) == 0;
+}
+
+int secp256k1_surjectionproof_verify(const secp256k1_context* ctx, const secp256k1_surjectionproof* proof, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator* ephemeral_output_tag) {
     size_t n_total_pubkeys;
     size_t n_used_pubkeys;
-    secp256k1_gej ring_pubkeys[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
-    secp256k1_scalar borromean_s[SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS];
     unsigned char msg32[32];
 
     VERIFY_CHECK(ctx != NULL);
@@ -364,33 +498,140 @@ int secp256k1_surjectionproof_verify(const secp256k1_context* ctx, const secp256
     ARG_CHECK(ephemeral_input_tags != NULL);
     ARG_CHECK(ephemeral_output_tag != NULL);
 
-    /* Compute public keys */
     n_total_pubkeys = secp256k1_surjectionproof_n_total_inputs(ctx, proof);
     n_used_pubkeys = secp256k1_surjectionproof_n_used_inputs(ctx, proof);
     if (n_used_pubkeys == 0 || n_used_pubkeys > n_total_pubkeys || n_total_pubkeys != n_ephemeral_input_tags) {
         return 0;
     }
 
-    /* Reject proofs with too many used inputs in USE_REDUCED_SURJECTION_PROOF_SIZE mode */
-    if (n_used_pubkeys > SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS) {
-        return 0;
-    }
+    secp256k1_surjection_genmessage(msg32, ephemeral_input_tags, n_total_pubkeys, ephemeral_output_tag);
+    return secp256k1_surjectionproof_verify_ring(proof, ephemeral_input_tags, n_total_pubkeys, n_used_pubkeys, ephemeral_output_tag, msg32);
+}
+
+typedef struct {
+    const secp256k1_context *ctx;
+    const secp256k1_surjectionproof * const *proofs;
+    const secp256k1_generator *ephemeral_input_tags;
+    size_t n_ephemeral_input_tags;
+    const secp256k1_generator * const *ephemeral_output_tags;
+    /* The negated input tags, or NULL if they did not fit into the scratch space. */
+    const secp256k1_ge *neg_input_tags;
+    /* The message hash state after writing all input tags. */
+    secp256k1_sha256 sha256_inputs;
+} secp256k1_surjectionproof_verify_batch_data;
+
+static int secp256k1_surjectionproof_verify_batch_load(secp256k1_borromean_sig *sig, unsigned char *m33, const secp256k1_callback *error_callback, secp256k1_scratch_space *scratch, size_t idx, void *data) {
+    const secp256k1_surjectionproof_verify_batch_data *d = (const secp256k1_surjectionproof_verify_batch_data *) data;
+    const secp256k1_surjectionproof *proof = d->proofs[idx];
+    secp256k1_sha256 sha256_en;
+    secp256k1_gej *pubs;
+    secp256k1_scalar *s;
+    size_t *rsizes;
+    secp256k1_ge output_tag;
+    size_t n_total_pubkeys;
+    size_t n_used_pubkeys;
+    size_t i;
+    size_t j;
 
-    if (secp256k1_surjection_compute_public_keys(ring_pubkeys, n_used_pubkeys, ephemeral_input_tags, n_total_pubkeys, proof->used_inputs, ephemeral_output_tag, 0, NULL) == 0) {
+    if (d->neg_input_tags == NULL) {
+        return -1;
+    }
+    n_total_pubkeys = secp256k1_surjectionproof_n_total_inputs(d->ctx, proof);
+    n_used_pubkeys = secp256k1_surjectionproof_n_used_inputs(d->ctx, proof);
+    if (n_used_pubkeys == 0 || n_used_pubkeys > n_total_pubkeys || n_total_pubkeys != d->n_ephemeral_input_tags) {
         return 0;
     }
-
-    /* Verify signature */
-    rsizes[0] = (int) n_used_pubkeys;
+    rsizes = (size_t *) secp256k1_scratch_alloc(error_callback, scratch, sizeof(size_t));
+    pubs = (secp256k1_gej *) secp256k1_scratch_alloc(error_callback, scratch, n_used_pubkeys * sizeof(secp256k1_gej));
+    s = (secp256k1_scalar *) secp256k1_scratch_alloc(error_callback, scratch, n_used_pubkeys * sizeof(secp256k1_scalar));
+    if (rsizes == NULL || pubs == NULL || s == NULL) {
+        return -1;
+    }
     for (i = 0; i < n_used_pubkeys; i++) {
         int overflow = 0;
-        secp256k1_scalar_set_b32(&borromean_s[i], &proof->data[32 + 32 * i], &overflow);
+        secp256k1_scalar_set_b32(&s[i], &proof->data[32 + 32 * i], &overflow);
         if (overflow == 1) {
             return 0;
         }
     }
-    secp256k1_surjection_genmessage(msg32, ephemeral_input_tags, n_total_pubkeys, ephemeral_output_tag);
-    return secp256k1_borromean_verify(NULL, &proof->data[0], borromean_s, ring_pubkeys, rsizes, 1, msg32, 32);
+    /* Same as secp256k1_surjection_compute_public_keys, with the input tags preloaded. */
+    secp256k1_generator_load(&output_tag, d->ephemeral_output_tags[idx]);
+    j = 0;
+    for (i = 0; i < n_total_pubkeys; i++) {
+        if (proof->used_inputs[i / 8] & (1 << (i % 8))) {
+            secp256k1_gej_set_ge(&pubs[j], &d->neg_input_tags[i]);
+            secp256k1_gej_add_ge_var(&pubs[j], &pubs[j], &output_tag, NULL);
+            j++;
+        }
+    }
+    VERIFY_CHECK(j == n_used_pubkeys);
+
+    sha256_en = d->sha256_inputs;
+    secp256k1_surjection_genmessage_write_tag(&sha256_en, d->ephemeral_output_tags[idx]);
+    secp256k1_sha256_finalize(&sha256_en, m33);
+
+    *rsizes = n_used_pubkeys;
+    sig->evalues = NULL;
+    sig->e0 = &proof->data[0];
+    sig->s = s;
+    sig->pubs = pubs;
+    sig->rsizes = rsizes;
+    sig->nrings = 1;
+    sig->m = m33;
+    sig->mlen = 32;
+    return 1;
+}
+
+static int secp256k1_surjectionproof_verify_batch_single(size_t idx, void *data) {
+    const secp256k1_surjectionproof_verify_batch_data *d = (const secp256k1_surjectionproof_verify_batch_data *) data;
+    return secp256k1_surjectionproof_verify(d->ctx, d->proofs[idx], d->ephemeral_input_tags, d->n_ephemeral_input_tags, d->ephemeral_output_tags[idx]);
+}
+
+int secp256k1_surjectionproof_verify_batch(const secp256k1_context* ctx, secp256k1_scratch_space *scratch, size_t *failed_index, const secp256k1_surjectionproof * const *proofs, const secp256k1_generator* ephemeral_input_tags, size_t n_ephemeral_input_tags, const secp256k1_generator * const *ephemeral_output_tags, size_t n_proofs) {
+    secp256k1_surjectionproof_verify_batch_data data;
+    secp256k1_ge *neg_input_tags = NULL;
+    size_t checkpoint = 0;
+    size_t i;
+    int ret;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_proofs == 0 || proofs != NULL);
+    ARG_CHECK(n_proofs == 0 || ephemeral_input_tags != NULL);
+    ARG_CHECK(n_proofs == 0 || ephemeral_output_tags != NULL);
+    for (i = 0; i < n_proofs; i++) {
+        ARG_CHECK(proofs[i] != NULL);
+        ARG_CHECK(ephemeral_output_tags[i] != NULL);
+    }
+    if (n_proofs == 0) {
+        return 1;
+    }
+
+    /* All proofs share the input tags. Load and negate them once, and hash
+     * them once for all messages. */
+    if (scratch != NULL && n_ephemeral_input_tags <= SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS) {
+        checkpoint = secp256k1_scratch_checkpoint(&ctx->error_callback, scratch);
+        neg_input_tags = (secp256k1_ge *) secp256k1_scratch_alloc(&ctx->error_callback, scratch, n_ephemeral_input_tags * sizeof(secp256k1_ge));
+        for (i = 0; neg_input_tags != NULL && i < n_ephemeral_input_tags; i++) {
+            secp256k1_generator_load(&neg_input_tags[i], &ephemeral_input_tags[i]);
+            secp256k1_ge_neg(&neg_input_tags[i], &neg_input_tags[i]);
+        }
+        secp256k1_sha256_initialize(&data.sha256_inputs);
+        for (i = 0; i < n_ephemeral_input_tags; i++) {
+            secp256k1_surjection_genmessage_write_tag(&data.sha256_inputs, &ephemeral_input_tags[i]);
+        }
+    }
+
+    data.ctx = ctx;
+    data.proofs = proofs;
+    data.ephemeral_input_tags = ephemeral_input_tags;
+    data.n_ephemeral_input_tags = n_ephemeral_input_tags;
+    data.ephemeral_output_tags = ephemeral_output_tags;
+    data.neg_input_tags = neg_input_tags;
+    ret = secp256k1_borromean_verify_batch(&ctx->error_callback, scratch, failed_index, secp256k1_surjectionproof_verify_batch_load, secp256k1_surjectionproof_verify_batch_single, &data, n_proofs);
+    if (neg_input_tags != NULL) {
+        secp256k1_scratch_apply_checkpoint(&ctx->error_callback, scratch, checkpoint);
+    }
+    return ret;
 }
 
 #endif
@@ -15,22 +15,23 @@
 #include "scalar.h"
 #include "hash.h"
 
+SECP256K1_INLINE static void secp256k1_surjection_genmessage_write_tag(secp256k1_sha256 *sha256_en, const secp256k1_generator *tag) {
+    unsigned char pk_ser[33];
+    pk_ser[0] = 2 + (tag->data[63] & 1);
+    memcpy(&pk_ser[1], &tag->data[0], 32);
+    secp256k1_sha256_write(sha256_en, pk_ser, sizeof(pk_ser));
+}
+
 SECP256K1_INLINE static void secp256k1_surjection_genmessage(unsigned char *msg32, const secp256k1_generator *ephemeral_input_tags, size_t n_input_tags, const secp256k1_generator *ephemeral_output_tag) {
     /* compute message */
     size_t i;
-    unsigned char pk_ser[33];
-    size_t pk_len = sizeof(pk_ser);
     secp256k1_sha256 sha256_en;
 
     secp256k1_sha256_initialize(&sha256_en);
     for (i = 0; i < n_input_tags; i++) {
-        pk_ser[0] = 2 + (ephemeral_input_tags[i].data[63] & 1);
-        memcpy(&pk_ser[1], &ephemeral_input_tags[i].data[0], 32);
-        secp256k1_sha256_write(&sha256_en, pk_ser, pk_len);
+        secp256k1_surjection_genmessage_write_tag(&sha256_en, &ephemeral_input_tags[i]);
     }
-    pk_ser[0] = 2 + (ephemeral_output_tag->data[63] & 1);
-    memcpy(&pk_ser[1], &ephemeral_output_tag->data[0], 32);
-    secp256k1_sha256_write(&sha256_en, pk_ser, pk_len);
+    secp256k1_surjection_genmessage_write_tag(&sha256_en, ephemeral_output_tag);
     secp256k1_sha256_finalize(&sha256_en, msg32);
 }
 
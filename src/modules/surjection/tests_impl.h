@@ -121,83 +121,95 @@ static void test_surjectionproof_api(void) {
     CHECK(secp256k1_surjectionproof_initialize(none, &proof, &input_index, fixed_input_tags, n_inputs, 0, &fixed_input_tags[0], 100, NULL) == 0);
     CHECK(ecount == 7);
 
+    /* check initialize_range */
+    CHECK(secp256k1_surjectionproof_initialize_range(none, &proof, &input_index, fixed_input_tags, n_inputs, 3, &fixed_input_tags[0], 0, 100, seed) != 0);
+    CHECK(ecount == 7);
+    CHECK(secp256k1_surjectionproof_initialize_range(none, NULL, &input_index, fixed_input_tags, n_inputs, 3, &fixed_input_tags[0], 0, 100, seed) == 0);
+    CHECK(ecount == 8);
+    CHECK(secp256k1_surjectionproof_initialize_range(none, &proof, &input_index, fixed_input_tags, n_inputs, 3, &fixed_input_tags[0], 0, 100, NULL) == 0);
+    CHECK(ecount == 9);
+    CHECK(secp256k1_surjectionproof_initialize_range(none, &proof, &input_index, fixed_input_tags, n_inputs, n_inputs + 1, &fixed_input_tags[0], 0, 100, seed) == 0);
+    CHECK(ecount == 10);
+    CHECK(secp256k1_surjectionproof_initialize_range(none, &proof, &input_index, fixed_input_tags, n_inputs, 3, &fixed_input_tags[0], SIZE_MAX, 2, seed) == 0);
+    CHECK(ecount == 11);
+
     CHECK(secp256k1_surjectionproof_initialize(none, &proof, &input_index, fixed_input_tags, n_inputs, 3, &fixed_input_tags[0], 100, seed) != 0);
     /* check generate */
     CHECK(secp256k1_surjectionproof_generate(none, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) != 0);
-    CHECK(ecount == 7);
+    CHECK(ecount == 11);
     CHECK(secp256k1_surjectionproof_generate(vrfy, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) != 0);
-    CHECK(ecount == 7);
+    CHECK(ecount == 11);
 
     CHECK(secp256k1_surjectionproof_generate(sign, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 1);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) != 0);
-    CHECK(ecount == 7);
+    CHECK(ecount == 11);
     CHECK(secp256k1_surjectionproof_generate(sttc, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 8);
+    CHECK(ecount == 12);
 
     CHECK(secp256k1_surjectionproof_generate(both, NULL, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 9);
+    CHECK(ecount == 13);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, NULL, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 10);
+    CHECK(ecount == 14);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs + 1, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 10);
+    CHECK(ecount == 14);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs - 1, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 10);
+    CHECK(ecount == 14);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, 0, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 10);
+    CHECK(ecount == 14);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, NULL, 0, input_blinding_key[0], output_blinding_key) == 0);
-    CHECK(ecount == 11);
+    CHECK(ecount == 15);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 1, input_blinding_key[0], output_blinding_key) != 0);
-    CHECK(ecount == 11);  /* the above line "succeeds" but generates an invalid proof as the input_index is wrong. it is fairly expensive to detect this. should we? */
+    CHECK(ecount == 15);  /* the above line "succeeds" but generates an invalid proof as the input_index is wrong. it is fairly expensive to detect this. should we? */
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, n_inputs + 1, input_blinding_key[0], output_blinding_key) != 0);
-    CHECK(ecount == 11);
+    CHECK(ecount == 15);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, NULL, output_blinding_key) == 0);
-    CHECK(ecount == 12);
+    CHECK(ecount == 16);
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], NULL) == 0);
-    CHECK(ecount == 13);
+    CHECK(ecount == 17);
 
     CHECK(secp256k1_surjectionproof_generate(both, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, 0, input_blinding_key[0], output_blinding_key) != 0);
     /* check verify */
     CHECK(secp256k1_surjectionproof_verify(none, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag) == 1);
     CHECK(secp256k1_surjectionproof_verify(sign, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag) == 1);
     CHECK(secp256k1_surjectionproof_verify(vrfy, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag) == 1);
-    CHECK(ecount == 13);
+    CHECK(ecount == 17);
 
     CHECK(secp256k1_surjectionproof_verify(vrfy, NULL, ephemeral_input_tags, n_inputs, &ephemeral_output_tag) == 0);
-    CHECK(ecount == 14);
+    CHECK(ecount == 18);
     CHECK(secp256k1_surjectionproof_verify(vrfy, &proof, NULL, n_inputs, &ephemeral_output_tag) == 0);
-    CHECK(ecount == 15);
+    CHECK(ecount == 19);
     CHECK(secp256k1_surjectionproof_verify(vrfy, &proof, ephemeral_input_tags, n_inputs - 1, &ephemeral_output_tag) == 0);
-    CHECK(ecount == 15);
+    CHECK(ecount == 19);
     CHECK(secp256k1_surjectionproof_verify(vrfy, &proof, ephemeral_input_tags, n_inputs + 1, &ephemeral_output_tag) == 0);
-    CHECK(ecount == 15);
+    CHECK(ecount == 19);
     CHECK(secp256k1_surjectionproof_verify(vrfy, &proof, ephemeral_input_tags, n_inputs, NULL) == 0);
-    CHECK(ecount == 16);
+    CHECK(ecount == 20);
 
     /* Check serialize */
     serialized_len = sizeof(serialized_proof);
     CHECK(secp256k1_surjectionproof_serialize(none, serialized_proof, &serialized_len, &proof) != 0);
-    CHECK(ecount == 16);
+    CHECK(ecount == 20);
     serialized_len = sizeof(serialized_proof);
     CHECK(secp256k1_surjectionproof_serialize(none, NULL, &serialized_len, &proof) == 0);
-    CHECK(ecount == 17);
+    CHECK(ecount == 21);
     serialized_len = sizeof(serialized_proof);
     CHECK(secp256k1_surjectionproof_serialize(none, serialized_proof, NULL, &proof) == 0);
-    CHECK(ecount == 18);
+    CHECK(ecount == 22);
     serialized_len = sizeof(serialized_proof);
     CHECK(secp256k1_surjectionproof_serialize(none, serialized_proof, &serialized_len, NULL) == 0);
-    CHECK(ecount == 19);
+    CHECK(ecount == 23);
 
     serialized_len = sizeof(serialized_proof);
     CHECK(secp256k1_surjectionproof_serialize(none, serialized_proof, &serialized_len, &proof) != 0);
     /* Check parse */
     CHECK(secp256k1_surjectionproof_parse(none, &proof, serialized_proof, serialized_len) != 0);
-    CHECK(ecount == 19);
+    CHECK(ecount == 23);
     CHECK(secp256k1_surjectionproof_parse(none, NULL, serialized_proof, serialized_len) == 0);
-    CHECK(ecount == 20);
+    CHECK(ecount == 24);
     CHECK(secp256k1_surjectionproof_parse(none, &proof, NULL, serialized_len) == 0);
-    CHECK(ecount == 21);
+    CHECK(ecount == 25);
     CHECK(secp256k1_surjectionproof_parse(none, &proof, serialized_proof, 0) == 0);
-    CHECK(ecount == 21);
+    CHECK(ecount == 25);
 
     secp256k1_context_destroy(none);
     secp256k1_context_destroy(sign);
@@ -372,6 +384,62 @@ static void test_input_selection_distribution(void) {
     CHECK(used_inputs[3] > 6918 && used_inputs[3] < 8053);
 }
 
+static void test_initialize_range(size_t n_inputs, size_t n_used) {
+    secp256k1_fixed_asset_tag fixed_input_tags[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS];
+    secp256k1_surjectionproof proof;
+    secp256k1_surjectionproof range_proof;
+    secp256k1_surjectionproof best_proof;
+    unsigned char seed[32];
+    size_t input_index;
+    size_t range_input_index;
+    size_t best_input_index = 0;
+    size_t key_index;
+    size_t start;
+    size_t i;
+    int result;
+    int best;
+
+    CHECK(n_inputs <= SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
+    for (i = 0; i < n_inputs; i++) {
+        secp256k1_testrand256(fixed_input_tags[i].data);
+    }
+    key_index = secp256k1_testrand_int(n_inputs);
+    secp256k1_testrand256(seed);
+
+    /* Search serially. */
+    result = secp256k1_surjectionproof_initialize_range(ctx, &proof, &input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], 0, 1000 * n_inputs, seed);
+    CHECK(result > 0);
+    CHECK(input_index == key_index);
+    CHECK(secp256k1_surjectionproof_n_total_inputs(ctx, &proof) == n_inputs);
+    CHECK(secp256k1_surjectionproof_n_used_inputs(ctx, &proof) == n_used);
+    CHECK(proof.used_inputs[key_index / 8] & (1 << (key_index % 8)));
+
+    /* Split the same iterations into ranges of random length, as if searched by several
+     * threads, and check that the lowest successful range gives the same proof. */
+    best = 0;
+    for (start = 0; start < 1000 * n_inputs; ) {
+        size_t len = 1 + secp256k1_testrand_int(7);
+        int range_result = secp256k1_surjectionproof_initialize_range(ctx, &range_proof, &range_input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], start, len, seed);
+        CHECK(range_result == 0 || (size_t) range_result > start);
+        CHECK(range_result == 0 || (size_t) range_result <= start + len);
+        if (range_result > 0 && (best == 0 || range_result < best)) {
+            best = range_result;
+            best_proof = range_proof;
+            best_input_index = range_input_index;
+        }
+        start += len;
+    }
+    CHECK(best == result);
+    CHECK(best_input_index == input_index);
+    CHECK(secp256k1_memcmp_var(best_proof.used_inputs, proof.used_inputs, sizeof(proof.used_inputs)) == 0);
+
+    /* The successful iteration on its own, and the iterations before it */
+    CHECK(secp256k1_surjectionproof_initialize_range(ctx, &range_proof, &range_input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], result - 1, 1, seed) == result);
+    CHECK(secp256k1_memcmp_var(range_proof.used_inputs, proof.used_inputs, sizeof(proof.used_inputs)) == 0);
+    CHECK(secp256k1_surjectionproof_initialize_range(ctx, &range_proof, &range_input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], 0, result - 1, seed) == 0);
+    CHECK(secp256k1_surjectionproof_initialize_range(ctx, &range_proof, &range_input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], 0, 0, seed) == 0);
+}
+
 static void test_gen_verify(size_t n_inputs, size_t n_used) {
     unsigned char seed[32];
     secp256k1_surjectionproof proof;
@@ -461,6 +529,161 @@ static void test_gen_verify(size_t n_inputs, size_t n_used) {
     }
 }
 
+/* Generates a surjection proof for an output tag of the same asset as input key_index, using n_used of the
+ * n_inputs input tags. */
+static void test_verify_batch_gen(secp256k1_surjectionproof *proof, secp256k1_generator *ephemeral_output_tag, const secp256k1_fixed_asset_tag *fixed_input_tags,
+ const secp256k1_generator *ephemeral_input_tags, unsigned char input_blinding_key[][32], size_t n_inputs, size_t n_used, size_t key_index) {
+    unsigned char seed[32];
+    unsigned char output_blinding_key[32];
+    size_t input_index;
+    secp256k1_testrand256(seed);
+    secp256k1_testrand256(output_blinding_key);
+    CHECK(secp256k1_generator_generate_blinded(ctx, ephemeral_output_tag, fixed_input_tags[key_index].data, output_blinding_key));
+    CHECK(secp256k1_surjectionproof_initialize(ctx, proof, &input_index, fixed_input_tags, n_inputs, n_used, &fixed_input_tags[key_index], n_inputs * 100, seed) > 0);
+    CHECK(input_index == key_index);
+    CHECK(secp256k1_surjectionproof_generate(ctx, proof, ephemeral_input_tags, n_inputs, ephemeral_output_tag, input_index, input_blinding_key[input_index], output_blinding_key));
+}
+
+/* Batch verifies proofs that each use a different set of inputs, and checks that a proof over a
+ * different number of inputs or with an output tag outside its used inputs is identified. */
+static void test_verify_batch_mixed(size_t n_inputs) {
+    enum { N_OUTPUTS = 6 };
+    secp256k1_fixed_asset_tag fixed_input_tags[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS];
+    secp256k1_generator ephemeral_input_tags[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS];
+    unsigned char input_blinding_key[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS][32];
+    secp256k1_generator ephemeral_output_tags[N_OUTPUTS];
+    const secp256k1_generator *output_tag_ptrs[N_OUTPUTS];
+    secp256k1_surjectionproof proofs[N_OUTPUTS];
+    const secp256k1_surjectionproof *proof_ptrs[N_OUTPUTS];
+    secp256k1_surjectionproof short_proof;
+    secp256k1_generator short_output_tag;
+    secp256k1_generator reblinded_output_tag;
+    size_t key_index[N_OUTPUTS];
+    unsigned char blinding_key[32];
+    secp256k1_scratch_space *scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+    const size_t max_used = n_inputs < SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS ? n_inputs : SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS;
+    size_t failed_index;
+    size_t unused;
+    size_t i;
+
+    CHECK(n_inputs > 2 && n_inputs <= SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
+    for (i = 0; i < n_inputs; i++) {
+        secp256k1_testrand256(input_blinding_key[i]);
+        secp256k1_testrand256(fixed_input_tags[i].data);
+        CHECK(secp256k1_generator_generate_blinded(ctx, &ephemeral_input_tags[i], fixed_input_tags[i].data, input_blinding_key[i]));
+    }
+    /* The proofs use from one up to max_used inputs, each around its own input. */
+    for (i = 0; i < N_OUTPUTS; i++) {
+        size_t n_used = 1 + i * (max_used - 1) / (N_OUTPUTS - 1);
+        key_index[i] = secp256k1_testrand_int(n_inputs);
+        test_verify_batch_gen(&proofs[i], &ephemeral_output_tags[i], fixed_input_tags, ephemeral_input_tags, input_blinding_key, n_inputs, n_used, key_index[i]);
+        CHECK(secp256k1_surjectionproof_n_used_inputs(ctx, &proofs[i]) == n_used);
+        proof_ptrs[i] = &proofs[i];
+        output_tag_ptrs[i] = &ephemeral_output_tags[i];
+    }
+    CHECK(secp256k1_surjectionproof_verify_batch(ctx, scratch, &failed_index, proof_ptrs, ephemeral_input_tags, n_inputs, output_tag_ptrs, N_OUTPUTS));
+    CHECK(secp256k1_surjectionproof_verify_batch(ctx, NULL, &failed_index, proof_ptrs, ephemeral_input_tags, n_inputs, output_tag_ptrs, N_OUTPUTS));
+
+    /* A valid proof over all but the last input does not verify against all of them. */
+    test_verify_batch_gen(&short_proof, &short_output_tag, fixed_input_tags, ephemeral_input_tags, input_blinding_key, n_inputs - 1, 2, 0);
+    CHECK(secp256k1_surjectionproof_verify(ctx, &short_proof, ephemeral_input_tags, n_inputs - 1, &short_output_tag));
+    proof_ptrs[2] = &short_proof;
+    output_tag_ptrs[2] = &short_output_tag;
+    failed_index = N_OUTPUTS;
+    CHECK(!secp256k1_surjectionproof_verify_batch(ctx, scratch, &failed_index, proof_ptrs, ephemeral_input_tags, n_inputs, output_tag_ptrs, N_OUTPUTS));
+    CHECK(failed_index == 2);
+    CHECK(secp256k1_surjectionproof_verify_batch(ctx, scratch, &failed_index, &proof_ptrs[2], ephemeral_input_tags, n_inputs - 1, &output_tag_ptrs[2], 1));
+    proof_ptrs[2] = &proofs[2];
+    output_tag_ptrs[2] = &ephemeral_output_tags[2];
+
+    /* An output tag of an asset outside the used inputs, here one of the unused input tags itself,
+     * has no ring member whose discrete log the prover knows. */
+    unused = 0;
+    while (proofs[3].used_inputs[unused / 8] & (1 << (unused % 8))) {
+        unused++;
+    }
+    CHECK(unused < n_inputs);
+    CHECK(!secp256k1_surjectionproof_verify(ctx, &proofs[3], ephemeral_input_tags, n_inputs, &ephemeral_input_tags[unused]));
+    output_tag_ptrs[3] = &ephemeral_input_tags[unused];
+    failed_index = N_OUTPUTS;
+    CHECK(!secp256k1_surjectionproof_verify_batch(ctx, scratch, &failed_index, proof_ptrs, ephemeral_input_tags, n_inputs, output_tag_ptrs, N_OUTPUTS));
+    CHECK(failed_index == 3);
+    output_tag_ptrs[3] = &ephemeral_output_tags[3];
+
+    /* The right asset with a different blinding factor does not match either. */
+    secp256k1_testrand256(blinding_key);
+    CHECK(secp256k1_generator_generate_blinded(ctx, &reblinded_output_tag, fixed_input_tags[key_index[5]].data, blinding_key));
+    output_tag_ptrs[5] = &reblinded_output_tag;
+    failed_index = N_OUTPUTS;
+    CHECK(!secp256k1_surjectionproof_verify_batch(ctx, NULL, &failed_index, proof_ptrs, ephemeral_input_tags, n_inputs, output_tag_ptrs, N_OUTPUTS));
+    CHECK(failed_index == 5);
+
+    secp256k1_scratch_space_destroy(ctx, scratch);
+}
+
+/* Generates a proof that uses all n_inputs inputs, with the ring on the heap so that it may exceed the
+ * generation limit of reduced builds, and checks that parsing and verification accept it. */
+static void test_verify_all_used(size_t n_inputs) {
+    secp256k1_surjectionproof proof;
+    const secp256k1_surjectionproof *proof_ptr = &proof;
+    /* Not SERIALIZATION_BYTES_MAX, which reduced builds size for their generation limit */
+    unsigned char serialized_proof[SECP256K1_SURJECTIONPROOF_SERIALIZATION_BYTES(SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS, SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS)];
+    size_t serialized_len = sizeof(serialized_proof);
+    secp256k1_fixed_asset_tag fixed_input_tags[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS];
+    secp256k1_generator ephemeral_input_tags[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS];
+    const secp256k1_generator *ephemeral_output_tag_ptr;
+    secp256k1_generator ephemeral_output_tag;
+    unsigned char input_blinding_key[SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS][32];
+    unsigned char output_blinding_key[32];
+    secp256k1_gej *ring_pubkeys;
+    secp256k1_scalar *borromean_s;
+    size_t input_index;
+    size_t i;
+
+    CHECK(n_inputs > 0 && n_inputs <= SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
+    for (i = 0; i < n_inputs; i++) {
+        secp256k1_testrand256(fixed_input_tags[i].data);
+        secp256k1_testrand256(input_blinding_key[i]);
+        CHECK(secp256k1_generator_generate_blinded(ctx, &ephemeral_input_tags[i], fixed_input_tags[i].data, input_blinding_key[i]));
+    }
+    input_index = secp256k1_testrand_int(n_inputs);
+    secp256k1_testrand256(output_blinding_key);
+    CHECK(secp256k1_generator_generate_blinded(ctx, &ephemeral_output_tag, fixed_input_tags[input_index].data, output_blinding_key));
+
+    memset(&proof, 0, sizeof(proof));
+    proof.n_inputs = n_inputs;
+    for (i = 0; i < n_inputs; i++) {
+        proof.used_inputs[i / 8] |= 1 << (i % 8);
+    }
+#ifdef VERIFY
+    proof.initialized = 1;
+#endif
+    CHECK(secp256k1_surjectionproof_n_used_inputs(ctx, &proof) == n_inputs);
+    /* The public function refuses rings larger than its stack buffers */
+    CHECK(secp256k1_surjectionproof_generate(ctx, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, input_index, input_blinding_key[input_index], output_blinding_key) == (n_inputs <= SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS));
+
+    ring_pubkeys = (secp256k1_gej *)malloc(n_inputs * sizeof(*ring_pubkeys));
+    borromean_s = (secp256k1_scalar *)malloc(n_inputs * sizeof(*borromean_s));
+    CHECK(ring_pubkeys != NULL && borromean_s != NULL);
+    CHECK(secp256k1_surjectionproof_generate_impl(ctx, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, input_index, input_blinding_key[input_index], output_blinding_key, ring_pubkeys, borromean_s, n_inputs - 1) == 0);
+    CHECK(secp256k1_surjectionproof_generate_impl(ctx, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag, input_index, input_blinding_key[input_index], output_blinding_key, ring_pubkeys, borromean_s, n_inputs) == 1);
+    free(ring_pubkeys);
+    free(borromean_s);
+
+    CHECK(secp256k1_surjectionproof_serialize(ctx, serialized_proof, &serialized_len, &proof));
+    CHECK(serialized_len == SECP256K1_SURJECTIONPROOF_SERIALIZATION_BYTES(n_inputs, n_inputs));
+    CHECK(secp256k1_surjectionproof_parse(ctx, &proof, serialized_proof, serialized_len));
+    CHECK(secp256k1_surjectionproof_verify(ctx, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag));
+    ephemeral_output_tag_ptr = &ephemeral_output_tag;
+    CHECK(secp256k1_surjectionproof_verify_batch(ctx, NULL, NULL, &proof_ptr, ephemeral_input_tags, n_inputs, &ephemeral_output_tag_ptr, 1));
+
+    /* Break the proof by changing its last s value */
+    serialized_proof[serialized_len - 1] ^= 1;
+    CHECK(secp256k1_surjectionproof_parse(ctx, &proof, serialized_proof, serialized_len));
+    CHECK(!secp256k1_surjectionproof_verify(ctx, &proof, ephemeral_input_tags, n_inputs, &ephemeral_output_tag));
+    CHECK(!secp256k1_surjectionproof_verify_batch(ctx, NULL, NULL, &proof_ptr, ephemeral_input_tags, n_inputs, &ephemeral_output_tag_ptr, 1));
+}
+
 /* check that a proof with empty n_used_inputs is invalid */
 static void test_no_used_inputs_verify(void) {
     secp256k1_surjectionproof proof;
@@ -682,6 +905,13 @@ void run_surjection_tests(void) {
     test_input_selection_distribution();
     test_gen_verify(10, 3);
     test_gen_verify(SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS, SECP256K1_SURJECTIONPROOF_MAX_USED_INPUTS);
+    test_verify_batch_mixed(10);
+    test_initialize_range(10, 3);
+    test_initialize_range(SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS, 3);
+    test_verify_batch_mixed(SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
+    test_verify_all_used(1);
+    test_verify_all_used(17);
+    test_verify_all_used(SECP256K1_SURJECTIONPROOF_MAX_N_INPUTS);
     test_no_used_inputs_verify();
     test_bad_serialize();
     test_bad_parse();
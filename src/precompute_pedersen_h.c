@@ -0,0 +1,72 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "../include/secp256k1.h"
+#include "assumptions.h"
+#include "util.h"
+#include "group.h"
+#include "ecmult_gen.h"
+#include "ecmult_gen_compute_table_impl.h"
+#include "precomputed_pedersen_h.h"
+
+int main(int argc, char **argv) {
+    const char outfile[] = "src/precomputed_pedersen_h.c";
+    const secp256k1_ge h = SECP256K1_PEDERSEN_GE_CONST_H;
+    secp256k1_ge_storage* table;
+    FILE* fp;
+    int inner, outer;
+
+    (void)argc;
+    (void)argv;
+
+    fp = fopen(outfile, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open %s for writing!\n", outfile);
+        return -1;
+    }
+
+    fprintf(fp, "/* This file was automatically generated by precompute_pedersen_h. */\n");
+    fprintf(fp, "/* See secp256k1_pedersen_ecmult_small in modules/rangeproof/pedersen_impl.h for details about the contents of this file. */\n");
+    fprintf(fp, "#if defined HAVE_CONFIG_H\n");
+    fprintf(fp, "#    include \"libsecp256k1-config.h\"\n");
+    fprintf(fp, "#endif\n");
+    fprintf(fp, "#include \"../include/secp256k1.h\"\n");
+    fprintf(fp, "#include \"group.h\"\n");
+    fprintf(fp, "#include \"precomputed_pedersen_h.h\"\n");
+    fprintf(fp, "#ifdef EXHAUSTIVE_TEST_ORDER\n");
+    fprintf(fp, "#    error Cannot compile precomputed_pedersen_h.c in exhaustive test mode\n");
+    fprintf(fp, "#endif /* EXHAUSTIVE_TEST_ORDER */\n");
+    fprintf(fp, "#define S(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) SECP256K1_GE_STORAGE_CONST(0x##a##u,0x##b##u,0x##c##u,0x##d##u,0x##e##u,0x##f##u,0x##g##u,0x##h##u,0x##i##u,0x##j##u,0x##k##u,0x##l##u,0x##m##u,0x##n##u,0x##o##u,0x##p##u)\n");
+    fprintf(fp, "const secp256k1_ge_storage secp256k1_pedersen_h_prec_table[PEDERSEN_H_PREC_N][PEDERSEN_H_PREC_G] = {\n");
+
+    table = checked_malloc(&default_error_callback, PEDERSEN_H_PREC_N * PEDERSEN_H_PREC_G * sizeof(secp256k1_ge_storage));
+    secp256k1_ecmult_gen_compute_table_n(table, &h, PEDERSEN_H_PREC_BITS, PEDERSEN_H_PREC_N);
+    for(outer = 0; outer != PEDERSEN_H_PREC_N; outer++) {
+        fprintf(fp,"{");
+        for(inner = 0; inner != PEDERSEN_H_PREC_G; inner++) {
+            fprintf(fp, "S(%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32
+                        ",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32",%"PRIx32")",
+                    SECP256K1_GE_STORAGE_CONST_GET(table[outer * PEDERSEN_H_PREC_G + inner]));
+            if (inner != PEDERSEN_H_PREC_G - 1) {
+                fprintf(fp,",\n");
+            }
+        }
+        if (outer != PEDERSEN_H_PREC_N - 1) {
+            fprintf(fp,"},\n");
+        } else {
+            fprintf(fp,"}\n");
+        }
+    }
+    free(table);
+
+    fprintf(fp, "};\n");
+    fprintf(fp, "#undef S\n");
+    fclose(fp);
+
+    return 0;
+}
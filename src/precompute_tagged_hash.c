@@ -0,0 +1,79 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../include/secp256k1.h"
+#include "assumptions.h"
+#include "util.h"
+#include "hash_impl.h"
+
+/* The tags of all tagged hashes with a fixed tag used by the library. The
+ * name is appended to secp256k1_sha256_initialize_tagged_ to form the name of
+ * the generated function. */
+static const struct {
+    const char *name;
+    const char *tag;
+} tags[] = {
+    {"bip340_nonce", "BIP0340/nonce"},
+    {"bip340_aux", "BIP0340/aux"},
+    {"bip340_challenge", "BIP0340/challenge"},
+    {"bip340_batch", "BIP0340/batch"},
+    {"s2c_ecdsa_point", "s2c/ecdsa/point"},
+    {"s2c_ecdsa_data", "s2c/ecdsa/data"},
+    {"ecdsa_adaptor_nonce", "ECDSAadaptor/non"},
+    {"ecdsa_adaptor_aux", "ECDSAadaptor/aux"},
+    {"dleq", "DLEQ"},
+    {"musig_keyagg_list", "KeyAgg list"},
+    {"musig_keyagg_coef", "KeyAgg coefficient"},
+    {"musig_nonce", "MuSig/nonce"},
+    {"musig_noncecoef", "MuSig/noncecoef"},
+    {"musig_batch_session_id", "MuSig/batchsessionid"},
+    {"musig_partial_sig_batch", "MuSig/partialsigbatch"}
+};
+
+int main(int argc, char **argv) {
+    const char outfile[] = "src/precomputed_tagged_hash.h";
+    FILE* fp;
+    size_t i;
+    int j;
+
+    (void)argc;
+    (void)argv;
+
+    fp = fopen(outfile, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open %s for writing!\n", outfile);
+        return -1;
+    }
+
+    fprintf(fp, "/* This file was automatically generated by precompute_tagged_hash. */\n");
+    fprintf(fp, "/* Each function initializes SHA256 with the midstate that secp256k1_sha256_initialize_tagged computes for its tag. */\n");
+    fprintf(fp, "#ifndef SECP256K1_PRECOMPUTED_TAGGED_HASH_H\n");
+    fprintf(fp, "#define SECP256K1_PRECOMPUTED_TAGGED_HASH_H\n");
+    fprintf(fp, "#include \"hash.h\"\n");
+    fprintf(fp, "#include \"util.h\"\n");
+    fprintf(fp, "#define SECP256K1_PRECOMPUTED_TAGS(X) \\\n");
+    for (i = 0; i < sizeof(tags) / sizeof(tags[0]); i++) {
+        fprintf(fp, "    X(%s, \"%s\")%s\n", tags[i].name, tags[i].tag, i + 1 < sizeof(tags) / sizeof(tags[0]) ? " \\" : "");
+    }
+    for (i = 0; i < sizeof(tags) / sizeof(tags[0]); i++) {
+        secp256k1_sha256 sha;
+        secp256k1_sha256_initialize_tagged(&sha, (const unsigned char *)tags[i].tag, strlen(tags[i].tag));
+        fprintf(fp, "/* SHA256(\"%s\")||SHA256(\"%s\") */\n", tags[i].tag, tags[i].tag);
+        fprintf(fp, "static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_%s(secp256k1_sha256 *sha) {\n", tags[i].name);
+        for (j = 0; j < 8; j++) {
+            fprintf(fp, "    sha->s[%d] = 0x%08"PRIx32"ul;\n", j, sha.s[j]);
+        }
+        fprintf(fp, "    sha->bytes = 64;\n");
+        fprintf(fp, "}\n");
+    }
+    fprintf(fp, "#endif /* SECP256K1_PRECOMPUTED_TAGGED_HASH_H */\n");
+    fclose(fp);
+
+    return 0;
+}
@@ -0,0 +1,271 @@
+/* This file was automatically generated by precompute_pedersen_h. */
+/* See secp256k1_pedersen_ecmult_small in modules/rangeproof/pedersen_impl.h for details about the contents of this file. */
+#if defined HAVE_CONFIG_H
+#    include "libsecp256k1-config.h"
+#endif
+#include "../include/secp256k1.h"
+#include "group.h"
+#include "precomputed_pedersen_h.h"
+#ifdef EXHAUSTIVE_TEST_ORDER
+#    error Cannot compile precomputed_pedersen_h.c in exhaustive test mode
+#endif /* EXHAUSTIVE_TEST_ORDER */
+#define S(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) SECP256K1_GE_STORAGE_CONST(0x##a##u,0x##b##u,0x##c##u,0x##d##u,0x##e##u,0x##f##u,0x##g##u,0x##h##u,0x##i##u,0x##j##u,0x##k##u,0x##l##u,0x##m##u,0x##n##u,0x##o##u,0x##p##u)
+const secp256k1_ge_storage secp256k1_pedersen_h_prec_table[PEDERSEN_H_PREC_N][PEDERSEN_H_PREC_G] = {
+{S(ff03144a,d2434a0d,b421a090,adbf2391,2f3aaa94,c16e937a,3311fbc4,949ef1b0,1eefb8b0,7e47e27a,1d9a2949,2a3507ae,6064e7cc,16f153d5,9ee402c7,95eef6fa),
+S(bc25c0c2,9002736a,73ba328e,e1cc1882,7b931d07,e1c5514d,b84fe137,2052c7,492a549a,b9ee4944,3e4f72d8,1dc56d51,a5608da7,1336af1e,fc7605b5,8932956c),
+S(22dbac24,90011f3f,c7e5387c,6ca9af1c,7736ee30,1c07ef00,90b0dfa8,40206d5e,e8df29c4,7c594122,9487086a,e74872ab,34d1a80c,5ef33c56,38dc36ff,1a655f82),
+S(5961bf84,61408bdf,e123925e,febc343,344bd61b,6b7deca7,fcbaee16,90662b34,4a76a541,d1d96e10,645555f9,3e57d0de,e40aa578,81c1ace3,6fc66421,74e5a818),
+S(6fee796,12cbdd12,e1b88492,edf353bf,6d6b6ee1,3f8bf52,8b31bac0,e2fe4fd0,c05e8cff,79036f19,ccc4eac3,b47d1647,4ae5b827,d1524d44,50182075,a5707b40),
+S(968ab049,bf400f04,afd43aab,67a45076,a9cf5519,d2b274f3,beef3b2a,64a8077d,b1f1a101,2436e98c,a58c546,c091b902,b76d3308,d11594ef,53883665,1ef49f36),
+S(aa011e45,e788f535,7e0eb6bb,b74974b8,63a4640c,7334021b,a54a557d,498b499,6cb1fff7,b8621734,6d351dc9,881f942a,6d61bc05,823d2a48,48ef8890,22d08c0e),
+S(dbcd4b1d,4a81acd2,6e2d1011,3f184a72,10d9792f,40aebdbd,dcbd5ebd,862b01ee,1fa9c324,a164eb37,b8c0f916,4410819b,e2181e4,29c0c4a3,5d613074,67722b27),
+S(1ab77d08,decb5f17,3ab6ece8,ead9fc57,ec0334b0,f7ec9540,54db9c50,ebd65c7f,81ff3f81,ee54dcb7,60314346,8852f5d3,4841afa7,ffc1307f,2a0f3ce4,768611ee),
+S(306505b4,4ea58557,39ff90d3,e81d2bab,b8873eb5,5d574a41,88f4a4fe,dc7da207,396a5dd3,3c237410,dc0edbb3,88ab238,2bd78a28,a3f2f0d3,533f6475,b911377),
+S(754c27e1,33529eea,5bb7290e,13441e24,f452ebe0,d2f1eea2,8bbfd7aa,aeb0f1c4,e3bcec2f,c82c057d,724aa8f,e41c7d2d,8a7f866d,6d676712,6e61428c,66683ae),
+S(67e9fb1e,8c7bd1f4,2a0771ea,d72bae27,725022e6,71ab636a,90b3dca5,9c392a2e,4e2f117d,481e722e,4e9ae6ff,29334fa5,234a8484,a1895047,d350ede1,fee60238),
+S(28fd3b45,50686a60,4deee32e,ae89e6f2,e5e21870,c81fee49,90dae5dc,7b7ac98d,ded9374e,f85f2faa,b80c5f2,41d7e02d,151cd7a2,cf14a7a8,1e586e9e,3fe99157),
+S(f26aacf1,7c02fc39,564c7a30,c50adbc8,c9073e73,32a5c04d,bb610d93,f0268ccf,f1d74e08,33e90793,521b968b,471dca51,8359bd8c,3edf283b,81a86e0d,d6c39447),
+S(13d0bc26,47ed0338,4cd6ce46,bfab77ed,c39fea3,26683868,2c7687af,f97e8cc3,a32527d7,d177bb8b,7f20514a,b7049c64,8b80ad17,1e366d46,40ad6e48,c378791b),
+S(98898bf1,16807a3b,c291f1a0,5df3df71,7068470c,1791599c,1a6a3fc7,c334a378,c232467a,a9f78d97,5ecec519,6ab407c,65f6ffbc,d7162123,e57388ea,34f386a4)},
+{S(5c96f19e,2bccf608,87f7fba2,5b922f0e,769c4b91,3bc43c62,e200a33c,68d1a696,d9573bcf,dbe6727b,426667fa,7867843e,75f7a0d5,441e0bc9,4aeb8d11,2fa8bf21),
+S(b0e8f091,9aef94ba,483a1f7f,7c1b9ef9,3837394,11068dc0,f7c34136,4dc36a46,719e6600,39b0d15b,9bc5813,12f65546,82aeae59,71167554,89f40714,5c748c73),
+S(fdbd5e05,d7943dc,63d6418a,f67482fa,bfd3d7ca,d7f9346e,476d23be,e1cec469,9d795cbd,1c10a417,3f62208e,d3f1624b,a519732c,373bdc29,87ac8635,cbf2a44b),
+S(141d733,1a3e6824,a2f97133,107f21f9,8b8a662,84523729,219b7e27,6b4ed412,9d854b5c,425c5120,5151a17,5c195ea,d2f453c,ce600414,be620da9,ce3d9e33),
+S(cc5a5896,2dd00fd0,68e4ba47,cae4d522,31bee0a5,28a8d4b5,902265cf,d6ec36ec,47aa3deb,36daaadd,baa68c3a,c4d68cc7,6fe3a845,20bf4b65,4c14459a,534d770d),
+S(1468edd5,affb3241,da727afa,af6c36bd,9cc9a643,2c9ee4f1,5044a1f9,cff55192,466752e6,5b0abb4b,e589cb02,dc5b7ff6,8f6e07e5,843bb312,b003565b,abb091e0),
+S(2f8057ed,2e57c5d5,a1506719,2b4fd73c,a377393a,e34b13c8,57e33c6d,2ad3144a,60c42d51,9ed69f88,3f746c3f,cbbb8f3b,1c7dfdb0,a3acaef8,4088b22,f0c36f3),
+S(17a0a84a,9fb60261,dfb571d9,1021148e,27082efc,2aaa731a,efc5b307,dd57bff8,72a7c0db,2335ae9c,d2b946cf,190936,252821e0,764c89fa,3c002755,bdce82a8),
+S(6dcf7de3,5f988bee,4150ac61,1cfd8bbe,714c9496,ad8cde29,850f0f74,28d793d2,66a735b0,aa3caf8d,e08ac15c,3e17abe0,9efcd96d,6646dfd,5c79773a,77f40a91),
+S(829f3a9e,46c4f6c,d0b170ec,8eb52cd6,2a248e55,64f0e074,8caa11a6,43ad0db4,4983f658,f5a6122f,8eb19e61,4ce75bd6,445ecd2,1bbdd666,fd4009d0,d217b668),
+S(ee4a41b9,1f544820,5a62b00d,711d093e,abff407,79be3cba,79fbacb0,91791b52,d356d70f,eb10b652,20ec5d1b,c65f2427,894bcbf2,11b38678,d9abf5f0,b3074a10),
+S(2aa80d7b,565e3bf1,113eef74,b69050a8,ce631857,d3a4946f,c63abe26,4ad14ed6,475337b5,b99233e9,644ac4aa,37e796e9,654038ea,66e486a8,a54a25af,49528f95),
+S(e728bbb1,d86a6867,78fdd326,f6912935,6a52ef00,dd841a10,2296bd6a,93f36339,845ab0b3,13a208a5,a6ac4a5f,20dafc71,c134520c,c7cf43a1,30fb1962,136600c7),
+S(3f667223,dada10f4,aed6d990,c6ac74d6,a8e27120,9532cea6,6102f556,b3a77311,c7fd9ce7,cbf23853,b85af8a0,d1199aa0,332e231c,33b2a78a,2168312d,9bb69046),
+S(c64639db,3f5552a3,da2abe3c,3e442ac8,fd3e0ecc,bebb996a,60c97569,61fcb591,fba0da6a,af4727ad,98f43264,8839bb55,1b431254,315a3c27,407e3a4,66693860),
+S(c4620985,49e084f3,4758b303,662b1263,51fcf8e2,227c5abc,ea16e59c,6098b352,93abaf90,6db67efb,54028ccb,fd0d0f8d,9b7d9151,3c52431b,9a30a759,b78c6420)},
+{S(6887be16,ed4cada,3f536e9,edfdc385,4e0c0250,fc122615,8555c202,4c69217d,e472f5d1,db585d5c,4533e26f,583eeed,dfc40364,507b3072,8e01f3c2,7552c87e),
+S(16a629a6,997e309b,59c39e26,32e75731,e2dd01e9,5133cbcc,61a852c9,1ba584e0,20c2488,e47eecbb,9709fd9a,a945fb7b,8146a08c,b7818319,90713bf9,6d5cb400),
+S(ca29ecef,a0292483,84a1acd0,1cdb21a0,e1f20ca3,19d36cdf,de872543,1ba8b637,b2e9f562,2ce51826,40119b8e,b7b1106e,6bf10f69,80be1213,3b615061,98a0617c),
+S(f3f8c933,c63cf503,155795b6,fd6c5171,98c81560,d4943536,c05c7e2a,adfb13d6,dec23f6f,9c988eb9,bcc00f31,807e29fe,fe0124fd,e44cc31a,e02d7b7d,32cd6148),
+S(923a3ade,5a59a6f6,867bd830,8d315950,6d5e0708,25c5f0ce,f951db94,4cb5cbb9,30491ff7,fda5ba9e,fd2f066c,3e2f65df,dc88d700,93d55bdf,31bc3384,66face8),
+S(faae834d,afcbe92e,2dd62975,418239ba,82a9f8da,84d1cf51,214ae589,bb419444,199a7f3c,7de4486c,738baade,5b2b460,801d5f3,82102a4f,27cbe469,67c71056),
+S(a609aa6f,8759d119,efee9e03,1d08774,aceae11,8754f6d8,32614d42,26614b14,31c0fea4,e813c6f4,d6bdcbb2,b3c51ccc,2e09839b,3483ec2c,a8eef76a,fde5bc2e),
+S(8d8ed05e,95d66694,dbc7c62e,3fb8dc21,7ccec33e,2b4603b,f68e4f41,5fdaa60c,4b4dd7f5,ce18124,fff05282,e0f29e9f,afcae5ff,e5e5c3f5,89ce704b,ba05bc93),
+S(5126dbfc,b0805ebf,884ac0c7,8f588e8,b580814,afb006cd,f026b574,6cbefd75,20d5db0f,aa552e9d,6006c66e,4f4b35c0,8951753c,cd55e1cc,78d2f16c,39400174),
+S(3d2b289d,5ef813e6,c0490cc5,a89f0516,dfda417d,c96be0bf,cf99ff98,11e02974,4a702035,4bcc72e3,f622771f,bf2a0b67,d01c1249,dd860fb,71d1011f,e9845fe6),
+S(beb7ca9f,bf057560,15b7b38e,9c9d5ed5,7a8b58b3,ebb9a1fe,f9482c9,dcfad6df,96b2b632,4c8e4911,9da0f684,2377842a,2df891d4,fec3200a,8c978f58,5fbb41f),
+S(5a0e41aa,c2106ab2,c510774e,2822bfb1,488e5749,5df908a2,d7febb17,932e1e5e,7f88cc3f,1220abba,f5709a49,2ba39a6a,94b91a67,10ab07fc,f4a77280,cbd37ec1),
+S(ba35baf4,1c498d7a,3a10f12f,94784141,b616cb3c,f43869bb,73d32229,33c98e3a,2c646fb4,dd551ba7,1a10eed4,72d20cb0,6db3a00b,27b2dca3,a172766b,485be44c),
+S(b9c6bc67,b38f3d5f,a3c30253,23026365,f10b7bcf,e4d29d9f,3bfeae18,b8a6cf2,c49db506,4010475f,a560e976,dd328e42,ac7bdcc8,fc1841c2,c725ec7,e1962a01),
+S(bac7868d,28b800bd,814bc10b,2abb0681,b4994e9b,aea9f518,964e8d05,5d2c348e,f608cb69,275677ff,9df397bb,34ed36,97d76c62,fcb54565,ba4e73f6,a36f2991),
+S(ec5801df,63c5b26c,e61eea06,c02b0dbc,aceef404,62868a3f,a6be5a52,9cc5f2a5,ae2e1b46,49f05665,8f94058a,b836d345,552d726c,7548d5e6,9e0fca1,bf179c19)},
+{S(b0564881,d9d3778,754e851,16713b6e,8d3b07eb,6b995dd1,b920175e,d5466056,ed0c5198,5ad1634a,fb55c96,e66e5dc6,5f880b08,3d93a2c7,46c7eb4e,4140f838),
+S(a78a146,f3e829d9,3670ae5c,600d6966,9c4847e0,80dc92fe,2d4f57f3,b5f05306,27d8065c,99e7b3e7,7cb08008,8d3b9ce2,6e905c84,397e2710,52b131d,687b6c69),
+S(29fe7b37,e2e9e539,f7b7096e,b61a69c5,2537529,327503e8,7241625b,3f1be10d,ffa40da5,60bc6f4,9215d5f2,2fbd09dd,17b6ff32,cb3cadbe,15bef81a,9dd74874),
+S(69e83808,f3b948a8,29ba6216,837fddbf,d4847449,1359d40b,2171b1f5,e57e6d6f,1bf8db37,a00be7d3,9001d5e2,2895aeaa,c8ad5179,8b1fc902,bef60eb4,4922052c),
+S(6a616e57,ec3056af,30a2d280,e0062300,fcf974f5,e4d0f06c,7c6df003,6578efdf,85fe8a5d,d2f75d89,b6f9c516,1044775,8df61a5b,a00d4c3d,49fbc498,9f02c404),
+S(fea78230,672872de,79e49c06,aa400ca5,354178ee,2969045b,ece6e242,32b790a7,e9d08cf4,6aff66fe,cbc8882e,436c49c,43b32160,1569a1db,18901c74,45f5cd3e),
+S(4211ddb8,c3e17d3c,76f19ad1,d0d322b9,d9e501be,9c476359,b7fd742b,a3d070cb,9e1b08be,88cff061,d2d87f65,6f17677d,e9929746,3855555d,169f9aae,eef36d1a),
+S(8ef35d8f,96724073,bede4c2f,c989be40,97d56685,ac23ac64,9379c1d6,b0731a4,668fd043,e156245d,c328abad,7971331a,8e79e04d,f9dce7e7,6a407502,139a7d),
+S(830b96a4,4f16a209,a76b5649,d860e7ab,4cde7345,d677caa8,82894742,ebf0b31c,cb3c5e13,7a9c817a,5283e5b0,99bf32cb,7f46109c,9ebf3727,14d2689c,69b3169a),
+S(22ccbd3c,6b1014ce,9b0b278a,9097761,662bb580,82f943b4,a0713aad,131d9281,f04c04e,d93ad8c4,5feecbca,505fd39c,c3992945,7aeab6f,c4f200cd,43a9a482),
+S(448eedca,65413b13,51dbe764,5fe1b0b5,e02c549d,e1ab980,ebb94cb6,ccee3b7a,266eb605,f9d43bca,d04f22d1,4113ec04,385499d7,90fd291f,829f91e3,7effc091),
+S(1539143a,31bc2cd6,602ad19f,84ac17ea,692a3812,29c8465,1bdd9135,51704a73,fa07533f,42476d41,d2a33b41,b95bafaf,a35d4dca,7ef610e0,b2fc1754,6816df36),
+S(f356f917,7b8600dc,a81498d8,bc559ad5,ca6a2f16,71a24175,b6bb400b,68a8700b,b1cbb11b,95f22814,ae877096,d2dc5547,c78ec93e,2c31e5b8,a1ade214,f657ed00),
+S(274433d,cfe4ca16,840397f3,7d4f2df3,697482af,126699bc,70035679,f0754afc,2df85561,ec0ae18c,7d753ec7,9c6738b4,62b8371b,abf90391,1498321d,6c27f99a),
+S(ce584c96,2ced89d2,5395b249,82a4098a,5ba73d53,14c987,6c49eee4,fc0b4bd7,8d2981db,7f6a817d,23c42916,3005f454,f431ecaa,98df26,9f6b67d1,8ac73560),
+S(e5ceffe7,388a6e2,b6c13620,f66c0fe8,e8aee1f1,63b6f252,bbc3ea4c,e13b23ec,25d8ad63,f733a7f,41d1e061,412e7b6a,f6716cd5,8f53a392,eea6488a,4ccb58eb)},
+{S(5a1fb014,c573fc24,6e662618,46bb2c13,873b6db3,69954263,5d1a0a7e,79469585,19318979,7e9d92a3,dafa1c29,86c55498,bd4fe8e4,1120dee8,3e57c661,7d75d546),
+S(ee4f8a75,ce164eed,a337a96c,6e09ea11,3549c7a2,b2ddfda7,ebb83fca,157d3f19,76b036dc,cb7ab30d,b3710fd0,5f02773d,41b98cfe,1a5bd42b,ae55f701,62573829),
+S(b49dde4a,b33ce17a,4012b29a,16c876d5,825ce85a,194567bb,75b5ee44,3469de3d,a0c5ec21,9f92a1bd,af36d732,973e1c55,43cc269e,3a281942,bbe9992f,bcc8bab7),
+S(70cfcceb,a3e2d548,45568662,7c841fc2,15ed55bb,e727e124,94484771,3b0f5273,5c1e01b,49c3f5ac,fd31a557,c95c2ae2,cc2bb90b,6bc5847e,7177e0b2,9251c927),
+S(1923176f,c6aac8c0,e4477104,c12edc16,d8d58d9c,5d01b7ee,7a4bdfda,5d1de7e8,7e7b8267,a7d09366,92e36e01,2e029a90,ffe03375,b61d158,186d6f6a,d24de264),
+S(c6085429,5f44577,84f9975f,b0b51989,8c0e7797,8340cef5,4b800bbd,d1eb8bfc,9d890c4d,a90faf1f,af726dfa,795ac29e,7fc1caf7,db6a9c21,39b4744b,7025d420),
+S(1a8b79f8,557d0413,35aa8371,f0eaae35,96fc0d1d,871a58ef,a6011f9a,a3373aea,7eb5bebe,ee974054,cb9bcf93,ef39da2e,3b109cae,529bf9a4,ea548d9,b442469e),
+S(a89c6bff,9798ab2d,d5fe86d,ceea3ce,cfb5d210,bc4aea5a,7bacc492,5431535e,c4b80a16,547f5ea,ce7299b3,aeee7a1f,f33956ab,2572a665,d818895a,7a588576),
+S(ac1c2c86,288cd9ea,f3b85c24,914f04da,c4cdcf99,9e87a491,ee95b1b6,3f4ee5a,162243eb,a9968420,c0006324,96e6f763,e66082a9,9bdd93f5,607afd44,7666fd1e),
+S(116297aa,867d3464,dd623e2b,6ce08fba,39b918f9,64e9b5b4,867c6bd9,a0988721,bf6fc494,7f7d4257,d20953f4,29007b22,9652edbc,1c81d771,74c58083,136fe4db),
+S(f681118f,d9a55e5c,3f4b5de9,dbf79fa2,62a32df5,754b12b5,da26b3e1,4e888946,fd3c5738,c32f5d86,f3875343,4f4c8948,dcf560b1,d693cd79,43c1e3e3,1779a249),
+S(52b69088,8ebb5dfd,9530a5c3,ca144c1b,2e573c8,21b90cfe,2c85107f,58085dd9,a581791f,8c0abdef,c41341b9,ad9fb62e,c3686134,88990785,135523f,22b9820f),
+S(6c47f2ec,db68160,fa35a78f,5ae80a19,c1aa1277,60aec4b2,b415cb4a,54549e12,d264f696,3a6a7318,38656fb,ed2c1884,b8b2ce12,b3feeab2,6cf56de1,545a7412),
+S(6ad08f66,44c188ce,c1d3b632,d20e7ff4,f3515ab,ef532f00,88327376,337a9c66,bf195f9e,46b5dab9,a2dced4b,de4021d5,7f49f1e7,d7507a6a,37f322b3,46722fbd),
+S(76fc7750,c278df24,cb5897e4,c7d3610,ba4a79df,5dbda63b,6a5fcc5f,36464be,415ac11a,b318570f,414cc98b,2403fd7a,ca831cdb,e67c6f23,17ffdc85,a289f58c),
+S(991815ee,777c2729,88f3bed1,4872247,8b9e6d43,7fb1786d,56a81573,d590ed87,6cc2688b,70d382f1,43b4857e,6ed522cc,e9a0ec65,c42c9940,c6319057,e64584cb)},
+{S(569ef337,d90c53ef,8466096b,93c6565b,3f79b115,ee715365,ffb23e42,9ebd0bb9,cc4d16cd,8cebc0f1,9d6470ec,eda0717c,6d6e00cc,2542b13,7bdba4ba,1cbf3b86),
+S(2c291e6,d79826e3,2513401c,41afd614,6684a460,e8595a4f,86509840,a5b70f5d,c3a00b5c,8efea980,eed66faf,af35d598,3e952450,3bd56b80,9f6e3484,f5cd2da5),
+S(16c406f1,ebd3c1d1,b9207c72,acfdd69d,43dda36b,22e6d0a1,3ce16318,5084c2e8,b996d870,58a7688c,918f35a1,74f92692,7b72fda1,72a99346,35a12bb8,11ad0769),
+S(c8ffafeb,e7ec558d,6db3e089,6d52534e,19f64335,5db42e0c,5b0c774f,ac5d3024,a6e28adc,13ff0c04,7abf7595,fd56df5,e1e64a9c,b33dc160,48f3544f,3dab0f39),
+S(60cbd03b,f485f519,615656b0,87273c86,55b73374,7fe44a20,9ba14edc,ff71e284,cee74c23,debff911,3b66f38d,353efe79,493f71f4,88457dfa,e63d740c,11ae797),
+S(f044e56a,12e9ff73,3b966c9c,e5a2b7af,3009cfd3,c4bc0814,fefbb52d,7d640c63,c9a4f402,ac9fd009,2f58415c,d068303a,9fd3d8c9,dbbf3c8f,e1876d76,ac7203d1),
+S(a030b8b4,dd2adbd5,d21d0d80,b455482d,181a9e01,29bf4f84,7c1f5547,a6cfd8d4,95d75732,ae567c1,d2565b52,e7b75634,207793c6,5465ce8b,5a9f89c4,e640860d),
+S(22da6f51,9f6e8ab1,5dcf5bcb,f77ddc4b,ca0e17b5,95e0d961,8f84982f,14bc47ec,20650faf,d3670727,6dbc8c67,ef266c9c,47e3e5f3,7112a8c9,a47cfbcf,5f5c3240),
+S(c8fa9ce1,bce3591b,36ca8b52,31f4d40c,84dfa54d,180bb05a,40185a9f,fed9a0b6,5288b5c9,5b9d9b29,14cbd0df,93751a1d,9e6acdec,aa3040fc,8da3aa64,4c41ad2c),
+S(139ada46,eeb0e5ab,90c06a4b,231d6fd2,e9e7eafb,2517b927,dd3f6dfa,5c6d70ab,f2273473,a6dbed81,63b2244a,af16030,351e70a5,c771d2ad,4e1d7d69,2ed538a2),
+S(9abdeddb,6edfaa0e,ec2883a0,979f4e22,31fc7855,3872ef20,7ad1f354,e2da605d,4a25df78,8ccc915d,734eea56,25a69ce5,7a8cee1,511dc9fe,935af432,364b1b73),
+S(a0fbda35,2d17bba4,599d1ea1,e66c568e,df93ff5d,3969a709,849ac5ef,3f286bb2,6a436995,49bf119a,290723a6,94d17cf2,dd819aba,dadbbd0,767a7a51,85e5e1b6),
+S(a0b553de,2bbbc376,2bb43a13,4bc5d6ea,7526a6ca,3e086db5,9e5661b8,ca2bb736,75f98520,d540908f,57e1cc0b,f4acf47a,6465871d,7140166e,c0ae8003,24ca1e39),
+S(835a3650,1721c4c0,856e12b8,18417112,f3b5188,5a538e90,e93fc83e,b6d54ae0,88c3e0f7,bcad6453,a910cfe0,3179781a,9d75a21d,1fb8ea86,17fecb01,76122ba9),
+S(4c5f1425,4f2b4fda,a36ace87,bf5f4841,82a8dbfc,9d666620,b84741b2,7bc49f2b,5b01c1f8,859cfe15,305b640b,62c36b94,560ebc96,acb0a568,35524e7f,f2a0bd80),
+S(eb8cad1b,cf4edcf6,daacfbaf,434eaa0a,e2f45296,86a36b32,74b2e741,2b74b68,3e7755b1,77c628db,b05893c,18b7270d,7b7dce84,a43edde2,5bf79df,a1e55781)},
+{S(cd88370a,43601dc6,b189eaab,8a507772,ea75605b,5f5bfcc8,949463a3,bfe4058,b760da4c,19c4185e,88a6bf43,e823e70,ba83d660,55370f87,67f452c7,a2c0da30),
+S(e8b083dc,72f00178,58c47a8d,98fbce0a,951661fc,8e91966f,1b8159f,e021cdaf,11623eff,52aeaca8,37d8b8ad,15789ab5,4360ff1a,59e9a555,8b5b4ba3,a43bbad),
+S(9f6ee3e5,3e1c9da5,88dc1e74,55185f78,fd2f8c1d,82f573c9,78b50107,2aa8aad9,fce45b3c,ee947275,19f738d3,9c30b2f,a4207708,1a908a5b,6ed90a6c,a86cb9ab),
+S(5f1e09c,fa160184,d6b71e42,28e4897,5f4641fc,419c459e,20c36ddc,baac662a,8f2b6f8c,a894e6d3,58c05d6,523b8b5e,fe5a9432,41139850,ec162621,ebf928b1),
+S(87c0a6e8,6fe110a7,297e36c,5858adb3,6396d169,fa0280aa,20294277,2b69d521,881d5284,bb5404bf,c572e183,6c309a8f,edf31ead,afcfcb3e,d489da4f,28f4a4f9),
+S(50801706,51feedc5,4513732,ab1ed88a,c5ffc4db,a6959c01,94bf20dd,4c72553f,f1bfe55b,6e569685,643722b1,45ca9f3a,b5d18e74,a5937dd8,be2db4e2,fa0b5dda),
+S(736b2e3c,bcb29ef4,607bc446,988fc2a4,9e7fe88d,e9d81277,318219b6,9f7924b0,89ed2c62,88800270,ed8e6479,4041d9e6,9570200b,eb7d81aa,da3ce3b7,b6bb8322),
+S(5150fbc3,ca83a0c3,a6ca68ca,2ec27cc8,69806476,96680be0,8aeac8fa,68e919b9,7ba99448,c9c3e288,c685f343,66244baf,29733fa8,8e3b39f,fef0ccef,f6b36c8b),
+S(124f2af4,8b8be52a,a117b333,702af327,b2e697e7,9443837e,e59b52b0,ce5ab27,d5527f94,ab213926,d6dcff8f,d975264,e966120a,f3c6ecc4,ff383ba1,8dff7a8c),
+S(efcefd89,e0e5dc25,fc9318b4,d0d1d200,f762a4b3,843d80cb,4b4d2bdc,828b6093,1916215,4dcfcbe0,d9fa46ca,c010300d,91cb601b,5c387a1,6ccd9a73,81216c94),
+S(cc77cef1,3abbfdce,8b948646,e13023,37314ae3,dbdf173,ad28b36a,a2230cd2,c9fcea4f,1497668a,af9cb601,b36e39,1ac7d7f0,f346bc8,179d0340,9dfabc6b),
+S(ed90bd51,b928a9d9,8dccfef1,93733f27,cdff69ab,4cdd643e,381a9d4e,5aa60bf2,68e4e793,409cb079,38431457,13e83a9,bac6b316,f933383,a74b3eab,502d294),
+S(a18813a8,ead55cb0,b3023386,f238907f,24c89ef5,e72274b5,50a0df0d,e380836,d9fa5342,d484255e,22a51a58,4027e7c2,49518d7c,68ab905a,bf68a67b,e289e691),
+S(bb15b6b6,cf6cf494,5624a88b,5eb40bee,f18cdfde,8799d3dc,196265d1,4675f40b,cbda4989,f06b8168,a67903aa,b2f2202d,3a557579,95c4cb2c,2c8fd24,3b1c084d),
+S(8f546b7d,4a1bad51,e44cfcd7,dead1ddb,cff29159,f760f3e3,1b216706,732abb10,40961d95,5f1fbbec,db8c8cfa,f4c55ff9,7fb80517,7ebc3d10,b9724a3,8ab67c8),
+S(3f88e3a0,158c2ae9,5e33d7cd,84c4608,6ae207b1,7057affe,4f921995,aa72792e,85006fcb,81c2a227,4cc66ed,d5444067,88ca300d,6c034757,182fd99,7d902f86)},
+{S(8a67321c,484e2b24,3413697b,b150cc54,63d3e98b,25f7e1a4,e73a8bc1,16e4e83d,f3c546a6,b054f50f,89369069,a1885839,5f9ddd46,180be404,8c4fa06f,23a51e66),
+S(3e2004a0,97abe5e6,6fb760c9,d93039fb,8b19d120,945a6686,d06c282e,1c225a4e,35815451,58143bbd,844c60ab,1eb7d272,3a9dd634,9f2dd05a,d6773795,25613c7),
+S(6cb1d49d,7f17cb92,e7dd71b5,f1dc165,226b9b38,3387952e,5fc510fa,3b76be2b,77ff35e9,a4101f96,6f1d7a9b,ca8bfbd2,e49a83c1,ca0a274a,9e16165e,192e8562),
+S(99c1a7a1,be8a0fd1,2c285de2,a5c1ac5e,cadb410f,5a065c98,d23cc993,aa73bd8e,8bb4caa2,3d041b8b,6e847fea,87499e00,7123e15e,adac0122,1a3bd26d,6af08c9f),
+S(bf0ba5b0,21229f62,cd1c452e,443da477,bc945263,12e5f225,7676420a,1279b83c,dad92208,d4d61945,e777ba7,90bf964d,cb09ff90,81521a4a,e122f99a,b088c74),
+S(764139b2,e6e390bd,9c87c102,59f72254,e35b5cdd,9aaf6bc6,e39ee30d,b04657f8,21664f21,dae87619,e187632,1104253e,59d97728,4db1eae9,a51f8908,d48f4d40),
+S(3561ef7c,5c882470,a794c02e,69d692ca,51aede7a,8810f01b,874a0b24,3a4cff09,49bd2e10,8c649878,8ee5b4ac,abf0796d,a06445b7,d17a5c1b,9ffbe617,abb2dbf5),
+S(a34c4ba7,63bf0c2a,6a7fd94,d2f58a7b,a9103c15,842ed6ab,be1fc241,32d673fe,52f24b64,1bf61470,801a3360,2910feb6,f1f4fb29,36df57e6,734444bf,d81351f),
+S(92bceb3d,66621fd6,60fced37,2423784b,1e61c86a,1db4282b,e9d1c3f7,ce6df2ec,fd4e8fd8,21e9aa48,8edf5746,1a4c3541,88891acd,547f8e6a,8290b2f9,edef9c41),
+S(487095e,f8008538,59e22e88,5012dbc1,36556dd7,a4d1ce24,f825836a,d4b892d3,2aeb2b6c,97f2c2c1,f66a5f53,ce654e20,c2af52b0,abebe5d6,f727690d,914313eb),
+S(edc401e1,f26c549f,65a1530d,9441d340,fef89c0c,a89a41a9,4281d35c,5029ab86,e4362e5a,52273bdc,e5059c65,26188d56,9cfb7908,f79296ed,dc888443,a3e346d8),
+S(b4c5ae98,6700357e,b8e78184,3a41015c,cc73d18e,a9300de1,dbde9a7d,d72c7944,c8530eb5,fd6cb69,1d67acc9,96493be,6083b50b,cbb31856,13de76b2,44f4d22b),
+S(bca59e32,b216cbd1,2d2ab879,b64cfccb,85c91511,e426a653,35d23d3f,210f8d72,8bc18f11,6e9ba35c,874889,a49f09a,e1550511,e61cc47b,c8d2dbc7,ce4b5a4b),
+S(246d2640,32a2e479,724dbfe0,acefc675,6d79fb,6b2ba577,7e36d5d4,20f55109,3ce33aa2,d6bd3e2b,4c42284f,d51586ba,5974157,1bead70c,6129e9a0,9deab611),
+S(3a240bd9,e9c44260,9db284e2,2378d34,9999d340,2aea6b9b,3bbd8442,37dc4784,31f7090e,e6b9b0c4,7272f7b,eed60ea,9a469fd4,30036e54,f8f432df,622f435),
+S(35143e89,c148c479,cead0b1,9e3a218b,2e5c07d3,afe8e887,1ae5727,e00a908a,74e126d,72aaf348,fa030c1b,caa9a6b8,6e75f1d0,35532335,caa887ac,440c44a8)},
+{S(86ae06d6,84ae2177,f6d2d37d,2499b84a,1fc22e44,af892908,8d0eb22f,4c94409f,963a8eb4,df76c800,3f0f08c1,23b009cc,c2fa413e,9eed5bfc,99c8b002,a563515d),
+S(bbcf7a86,811a8ee7,2070af6c,497e508e,64954459,c25d945a,8b1cfbbb,b1f42580,629746a,3cb32163,68032a3e,4c3b4fd9,1e9d9b5b,f5f0cf5,8f85661e,426a3377),
+S(86a57746,e8191627,7d4dcc71,18034eb3,537c183b,44870ed1,d7d31c18,5cca86c0,bb2f168b,803bfe43,46a6bca5,7fbf4c72,64a66acb,90fa82e5,b692b18a,f93d1a97),
+S(859a8cec,300ca3a5,70bd4677,115eb3af,84d17e57,dd1e2b6b,3901ef97,c91b0195,c073703e,95bd4142,8d67f820,c5974a40,40fc278a,2c788587,73df7ef,2218a758),
+S(75022dc8,d203a346,1e84046f,88c822f5,5f75e3e2,4e7efc1e,18aae284,a630e6eb,edff690e,b2e774c4,4679bedb,888b8780,f4c699f7,ed029855,7ef6eb4c,5a889bb4),
+S(b9863815,c1e47f50,889ee81,a037cf41,56fec992,94dedc68,1ff8af7f,d5911bea,c934adef,56595dab,a043aa7c,52bfb91d,5e03693e,3c512f00,137fa30,8a3dea29),
+S(ddebc7cc,84260b78,223f34ed,d3b88e69,624928d,36c502ef,1091de10,c434bc17,9c9b9132,464e879d,8dc6050e,74302ab6,b32a9bca,f21765bc,e9f0f9bf,a28f8a15),
+S(c8eeeb23,8c516e4e,ed78918b,cb981892,1a232e72,6359af57,648223c9,2f899f62,33431b3f,ba23d7a3,e1ad370f,3d720408,70d7cd86,f048b049,ecf62ddb,11e17e46),
+S(6281fcb1,1b5393a1,beb15b18,7e730d2b,edd768a6,f93de41,c0418eed,cb5243d3,23520158,336613ec,a5cae239,cb7b09e1,701e6920,bfa466ac,bba02296,f70d21e3),
+S(ec43e823,dbbb0482,885b0547,bf93dff8,7ddaf486,94f135ac,6ffb0bf9,c8e47b08,6a889fa,9773f198,bbfb2b0b,3f498420,9a25e442,f13d3904,f095190b,3d1a672c),
+S(9638850b,d59a3127,58e7b7e7,e1193ac1,e6d6fa31,dd8f561a,6837c18b,eb93b5fc,993cbfe3,cc0d9881,1f57618c,1e8bc044,11ad8119,a93df61e,5bb37603,718193c7),
+S(af5cd34e,16a32316,e5f3244d,c1d301d,9a06d57f,a53bed4a,eddc6ab,48ece909,26695a77,70da545d,bf9c137b,31ca6c58,28551d92,50046efd,64a652a7,332f11dc),
+S(8058dde1,b1049609,b773f498,7271def,cc7d959e,1133f1b4,18784c1,6c619236,e8edcee0,e291292a,4cb55a56,e573a89a,5031d58f,7576f970,be9a61d4,e2d20f1b),
+S(4bf428a6,90c769f0,97377a0c,7a2b7339,5c3e2684,9467f9c2,b49b4305,3ee187bc,99497aa5,1bea9f50,2fa0aab4,1d00ef1,8889bac,8ca1720,326661f0,7cafac2a),
+S(b0f434e9,3acd17ab,3a27d9c6,e92d8473,9976e9aa,b6ef8bc6,bd5d980a,b7555953,cfdeb43,a2a24377,9bc1112e,2cbfdda2,1a5de157,81da6ac1,2ee3baaa,5edc4ddd),
+S(4bd2c6b9,1f367eb7,97296385,5268fabb,5881b059,413b35ff,f3e7556e,6372e2fd,4773db98,a0ac9b67,66ba4f4f,8107c1a4,313d0905,8f40ed22,ce3f124,69b64dfc)},
+{S(d73ca55e,47718d18,f86d9e8,5e2f575d,9be6d03e,ecf82f87,804e5398,e58a4ba5,dd4f3d62,251504d9,93a936d3,72737da7,461a1afb,c5716825,757a3f7e,f7e763d9),
+S(8e92a3dd,32b7e10b,5878f6fc,638aeda4,82364c71,399bf8e8,836ce629,956104be,e92703cf,7c4301d3,94e7cfaa,e14eef2,146ccf17,e3143f9e,2361814c,f570f9f),
+S(cc9d3381,def61633,7c1090a1,c804a524,a9708bf,4439676e,cf01ccd,12a165d8,27d0a867,d13532bb,ad24a78f,ceebaedb,36650214,6eefbce0,7c237ffc,28d187b2),
+S(832d1475,3979bfd6,41b90a7c,681efe7,6245e3cd,88448824,282bf660,28a23e6d,7a74b994,574ed497,c09b131,94da148e,108a9922,d4cc5a9d,93aa1937,5e65def2),
+S(9af4f4cd,5bec159f,16d84a24,968f4c4f,de362e6c,2ede31f5,965effd4,912c2cca,d5c0c46d,8c4d6169,1a76fc3f,a409ab44,aec46900,82c338b2,179fb7ce,17bac372),
+S(6869543a,bf635c7d,ccf5c4bb,69d98135,2f077e2,cfef1149,e6b1148c,e498516f,95cb288,4be70cff,fcc3c7b9,ffc0c0db,f8fafd6a,54907205,2af2d43c,9c4338aa),
+S(878c59c,e4d033e3,c056953,1b4678b7,b412a85f,221466c5,2b86fbb6,1f7dbc15,82072f40,aa76d2e5,deba72d3,32595898,4e1d9737,1ac28a10,f2271b7c,a03195f2),
+S(c27bfb93,d7c7f6ad,e5e27195,5647a18c,949ccda3,63c2cb5d,706d7589,1097db38,2ae07119,f5d930ac,43c3e78a,ad7363f6,daad3e52,45ba110,efa2744d,977fa09d),
+S(65ffa05e,d0171c00,a7602cdf,8089576,403ca5c2,1a5164fc,2773d266,d053e2bd,f4a777a2,9977e92c,aa0352dd,cf3f0e07,a9d24427,d4235b8f,d539dc4,5dad4841),
+S(f7690519,bd9a6fcf,658700b0,ef555340,66374d6b,ad359a35,354cafb1,25b99ca7,6ac0c2f7,92fc3353,d8765e4,99b27e2,cb6fc453,74ad65f2,46e4ce1a,62250411),
+S(b552fd02,6ca48c6b,4dbe9582,b461d484,ca9b915b,67fca67a,27cdc024,39996062,87671aca,45deaf76,3bf13f89,7664fa65,4b2b9632,3e9ed61e,c4404f8c,8c2c57f3),
+S(c6b132a6,2d2dab8e,f8b8e43e,e564a594,390cffbf,24154f52,6d5b0964,758922d7,f7ac7bf1,9f8fc908,5ad10616,bb25f1ba,f82787ff,328d365b,84857879,54b40b26),
+S(38efc62a,143f34,4f559d2e,a759363a,ea2d7d78,df687b70,4fb154e1,7ce8e738,4bff9410,1e453517,65698c40,c52039f4,ef7807ca,ebfacc18,5541d311,4d06e701),
+S(ed7f3b3d,994cce9,e5695a2c,2c6386f4,238c7228,9f636977,2fa2dbb5,14a13d00,90d652a0,4fcab799,3c2f28f1,eeca844c,6e105a3d,a808644e,21812f72,12c44737),
+S(4a28c862,879ae2ff,2b98d908,86af03bf,fd97a645,cfedfd77,4a36bc46,f44d3ca0,7c8ca18c,8c02e187,142970e8,bbafabb9,f0d0054d,f347076a,31d98536,f54a766),
+S(7311af9e,54bb4509,347e04c2,6cdcbe1,9a82b8c8,426b8e0c,a8ffb883,9609029f,9467e488,a62f54a6,6e354163,c9d1415a,137c0e24,f162352,70b07f87,2c3eed34)},
+{S(f0f1e39e,77577412,7293b485,10d60449,7780bc4f,d4ce2424,e2022f02,9c359e54,9b315878,11c34305,5108dd,cdf82926,df4db023,88727c5,fc5b2a79,2d7df424),
+S(b0924a74,88405705,4ae3dc4a,52f52144,91062eaa,9af4bbd2,3050e4dd,fc438b36,9a15cf5a,4661d30c,ff28d7f5,77c24502,e310c8f5,8fef4a8d,f55913c5,60ee1f37),
+S(5f5a5906,d319ae38,1ca3ae7e,26b40f73,dbc89c4a,a2f2e162,e2568eab,9ee71f29,506f5b80,483217d8,b25a27a7,d1fdc479,e0c18c05,9eddaa95,5d732a6e,baa8ab45),
+S(76b65704,f3dc5b3,3a8cf384,e31bb138,461b2b4a,33b965ce,e9ec489c,e618f1cb,b00cf801,2052430,c272a665,ff4e0ef6,d3625f0e,6e377247,2ae807f0,169ffc51),
+S(bdf12925,ad4f21db,d4be52ef,864b73e8,7e1a5501,66dedf77,68019414,ae63f0d1,86bf7536,3dd745a2,9df0de5c,3fd375d3,b620ac61,1e16d40d,e16fff3c,e14a4b8b),
+S(148e819a,789c3c44,3ae435fe,d3967cc3,b46feb23,70417b3b,cfa4e1b6,c87e20a8,d0830c0d,17ea7f4e,4f3ab797,dd6fe22d,be535de,7c805472,6b042937,643f22dc),
+S(32b481c1,88116c2a,7d128f12,a4dbbd4c,a0240dfe,8d11f48f,8af8ef31,4de67652,1fbdc9eb,e43583fe,d579837d,33c879c9,6fda24c9,97cb5277,64560c77,4d43fd73),
+S(af362677,b4aa7360,cd064898,7bc4f3fc,c9d84104,12c16f02,43bdc4e2,1e21cf3f,504e28ec,31f20396,f2694737,47d0e040,74436b4a,a99466ba,db77b042,94697bf5),
+S(332e28fc,3a9d4809,10b5747a,ced6b3ab,c63fa254,12191d82,a396d9bd,ed672d40,2fe5e265,4ea4f6d6,9f1cc1cd,a501ad42,df5f1149,3a2ae8b0,495a4316,484bd49a),
+S(c1e3f821,3afb1596,c0d3b809,6b84b14e,e09f15a8,2bcc4951,b7169fd7,8ebf4c47,3978f47f,542c13d7,73863c45,a2ca3e3c,a46dc9ac,cd88ddb5,f0878bdf,b47db296),
+S(fa490141,d9185098,e4570d8d,740d5fbb,433972f2,507c2398,41aee8d9,ead8e76b,d5015ee2,a9d2a519,dffd26b0,7fef91cb,f31723a4,22ffa4bd,ba04cc4b,ccc51f23),
+S(f482d6c4,7dd8a92d,d5d78a2c,1e3973ae,9975c164,774840c6,6d3409a5,2c835225,4901f21a,ef9a20a9,a8fc19e4,86194222,5eae0cf2,18d12177,95db7eaa,c4c3d7c9),
+S(6b207e30,e461258b,9fddfb68,8865973b,a7a8d0c8,ee34814b,82cfe190,c48fe83c,939a41b5,7e6f16dc,2807bc07,bbb829a4,f5d336ce,5fe6cf47,6124b4c4,a2e0770),
+S(15cf1308,d7d99816,362f84ee,5d8f61cd,7903b3e2,694101c9,dfa3bd30,b4d2d7d1,7550d888,53726b0b,deb10947,e38bc3c1,9af353b6,dc9ee91,ea2d08d,b6a3fa2d),
+S(100172f2,d08bad22,1c07ec7b,1a1b63e8,8a72999d,7d3a9803,779d7eef,f62c4fac,c5a9e085,736878cc,23bdd8d4,abdfa0f3,95e05a3c,f7b01351,c13284b7,725c4582),
+S(14fd0a2e,1fcf93c0,8dc055a5,1f285ff,ed79021f,55ade8eb,759f6a68,4c740d02,4d3a9762,2b761e30,11a7b74e,485e0716,9b5ca683,30c2d955,acad98df,f4719a3f)},
+{S(ef48e630,7ebc31f,3e4e82d,6daf5432,a88a94de,be2df431,feb942a7,4b7020d3,a90c3f45,fe628a01,b33b26da,ba582bf2,5ecc7954,4fc011b4,41ef2545,b038bdd4),
+S(6bd6af1c,b7cc4937,680629a0,52c846ab,ec1743cc,35bc70bd,84315ba,a92a755e,b362503b,779e6b39,922e82e0,9aeccb9,83fd84dc,cf277917,485ee4da,8e4e2552),
+S(c391e9d4,43a887fc,fc8e8,42e9e1f5,67b96967,56c20d84,5bc31bee,cb992073,52df1999,db2ad3d,ad801cc3,552a020e,483af404,12fc2f3a,6719aaf2,81f54b3e),
+S(6ae5d88d,6bdc6c2b,da8df628,15677ccb,2da46a3e,6e572e8,cab2a558,b8d5e32e,d265ca54,62c019a9,a4d43926,bb79f0b0,353129f9,18ae9f7b,1d7d666d,5631779),
+S(dd1d7fb9,bec4a556,d06c5b35,eb0558f4,b8576fb6,40c98d62,ac8e2e7e,8035380e,7f52be1,93566f2,21eb8958,f9a4e6ec,19757972,7080cde,b3a83d67,79bb96d3),
+S(3941dbb5,a95a0b8c,f70f045b,24e95117,bd7f1d63,f6b43a84,7680a6dc,7ae8a163,bc8effe2,b5eb6407,74131252,3ea0524b,5734c37c,31a788bc,c6de5a99,af9b55a7),
+S(3f32d41e,23f56c05,88d0cbf2,cda0ad2a,b463def0,5e5556a3,a274610a,76c65feb,e3db7869,7c15dd05,ed3109f1,bb0cbea8,ee7e7ea9,49134565,3611a161,8db85be8),
+S(f0e151ee,291cab32,bdb08911,c4ddb1e7,f769bc42,13119254,5fcf5046,18f07b2,34471284,1c56d0a5,d55b8af3,14606c0c,da7a7143,5761174b,f27f7511,faaef480),
+S(109965e6,74d9e243,27742522,8055b8b8,a10ebe22,d6ec0da3,84f39071,b13b8a5f,d9a6da78,9c408372,de90eacf,89a6b9d6,b812e7cf,40a38b67,27ed9261,bcd5c4d8),
+S(89b97ce3,cffc8988,8bfff50c,47cb2498,28912685,51fa3dd5,9e25fea1,10428e5e,38af7291,1b5ccd04,6b1f0253,9515487a,8539aeb0,b82bfa60,a555a3a4,5ab16d3a),
+S(e0833662,ae78faff,2a7e6357,a78fbd6,d8ef773b,ec90253b,b31c1f39,606c53d0,3c81c48c,cd750903,57f79980,a53fa573,6741e189,19f52ee,afa1cfd7,ef39b0bb),
+S(2b2a2d7b,baace7e1,5204ee85,cdcd521d,40a3b05e,dede7b7f,421456bd,92a1a7f1,6e9995e8,71bf6320,288c2eec,d01cdb94,93e78f88,ae6c2fe9,9f1fe6d0,9a58dbcb),
+S(53b63a82,2ca22e8,2e37b37,9e27e0ec,e5017342,3c07568,f868da0d,1e866f1b,9ab29c0a,664cd051,3c9e0a74,a832f4b2,e35a4744,ab39a3b0,be0eb040,2e2f2411),
+S(f912374e,cbfa23c2,7bc6b762,a53b8279,93372b1a,fbb8355a,2bf83887,18f8f190,178ff1d9,4a8bed7d,68c68cb1,5ff065d1,7787732a,616e1938,d94fb03c,bff3e7a0),
+S(8e07f4b1,49b24874,7720ad34,25587703,33a208b,201adc61,7bd6b161,2b8c7517,c8665abc,8a028a8b,d4ba7183,28ba49f8,4d632c5e,5b6ec5b8,99529224,cf0ee2d2),
+S(c190a89,162dcc4d,77f965b1,3be8bd3b,e78273e3,1c2e71ce,becf947a,36e8b05f,9699f43a,87fbb64d,2ce8dd86,da49537e,31825817,b88ea74d,580b6a3f,8402792d)},
+{S(a09865a2,5f93f733,f5a10998,c83ff2d0,9714a1ab,e4d7ea13,c8e0c81e,b1e214c9,a7196d9c,a0250c5d,815206e7,a398c884,d6cbbe0a,3c009283,e9cc9c1,7e307c73),
+S(b4ca7dc7,29cf3a49,1ffd61d7,6aa17efb,52ab7dcd,46fc6b8c,c3f00bee,ff7b9b0,b38eebf3,e365683a,4c87c927,d9e977e6,ad055f11,4df1235a,a1f5db6d,4142b833),
+S(3ed23aeb,3b77e880,8be167a1,73ffac95,c0fd0d5b,be7cce4,9c95ff80,b7ca9a06,2e9aae08,a66fc158,83478d66,da8ec9c2,dba42b13,917cca9b,f418c94d,b7493999),
+S(be2c7de0,aa79866a,890f92fe,bc1e6f9a,a943d954,a25effdc,fdfc23e,2ca0efab,d51b4cad,3c521133,60c2631c,f1edc15e,528cdefd,54fdeb25,eb8339fb,a6a1e18c),
+S(ba9c1e3d,9b23becb,50847b2e,45466b6e,f1207623,69713b5c,d170f5ef,83ba921c,de2c68c3,7bd1834f,d20bca79,c22e6d25,5cd4efeb,23d7e184,f57718c9,190606b0),
+S(4309bfa1,3ff26bd9,41a35eea,eee34f15,ce28540c,27470e82,32ec6d4a,53c56113,b554af36,c860c66,8f6fedc7,c4d09f5c,1af8b635,afc7a989,7a7cdf10,da9562b9),
+S(1be465fc,1b39e435,37aabd91,8d58e3fc,30a60816,57a22534,db5b93b8,565ad510,d72486c0,d8b95f4e,f9cf8337,77afe2e0,4e6da1cf,83f779aa,cdaa37e8,29556076),
+S(a061968d,4a7f903f,d3dcd757,f38e9258,88a32d6e,c5a78390,5b2f3add,dbaf9d9c,e191ed4d,effdb1b4,f9ee563a,3547a015,3f3584da,a8cb61a9,e0520a0,35dbc4b0),
+S(966fe8ea,f72330f6,469304b1,e0083010,8d153a57,9fb8d173,bf916543,689079ba,ed1ebc64,5c659271,91293d0c,ca4d82de,599c6f8a,70d5be7f,85250cdb,fa89b319),
+S(30003aa1,8ec0ac2f,95747b7e,3470e4b5,321889c5,6122a5e7,1aef1721,aa5b8957,61676a2e,e2973e9f,e12b214e,d4c6a059,ee6cc82a,7a5d1964,25e1ace0,7e56fa55),
+S(6493679c,fdd54b40,3175cdf,983e4b32,d6e22df3,9f0f3719,7513ea8b,fed52cc6,51748692,75fdacb4,8f4ec7f1,3bc5349f,568d8d7,b7ae4a4d,d3e4f0d8,46864cd8),
+S(e1555d0e,e9dc661e,e54025e2,c409e202,ddbaf8cb,3acfbd9e,79ec6ef3,ba3d978a,1b4fb5,dca18309,cbc2719d,c4b7a200,b644326f,badccca1,3a4bf85b,de31da79),
+S(e5f73ab3,86ef2ec9,4e2b2db7,bdb3d218,55d7c2fd,b70129e6,c497d35b,2b6098f9,a3faeb16,2481be2,66d97bfb,36a3ccd1,3b63b7ad,9718a8ab,39824be2,17a4c83),
+S(cef97037,89f1ba35,950d54bb,7ac1da29,31eab715,b4c87069,45a1185b,c020f76a,71391509,61b984b9,179fb9de,74e33ce7,4fa3061b,ad3489de,6842b161,c9809169),
+S(feda92b6,a6ec0d48,2c2bb34a,8a4aea86,99e3919f,c10df430,5388e3b,58d5f085,9e7f6743,bb2c55b7,d5f6e486,115edcbb,6fa0cf81,88cc0e6c,2fae4c66,160d1fdc),
+S(d247243e,dae25873,7d41055d,40354623,89ac320b,5ddbef42,c1a8d7b8,fc129737,65ddd134,7be01954,14707f60,486ad651,73c49995,6ca69e7f,79f4b1bd,da09a52a)},
+{S(d76d92b8,d09faee,a45049bc,a660948e,bd692f92,db52390d,154e9ae1,c179cfd4,5e570182,b67b98f,b5ec7872,cec6006a,731332d3,69762793,f9fd0fd8,2109fe14),
+S(cb8c68bc,66213021,86683438,e9b8eb70,84ccec4a,6c4f268e,65d676d2,4f19064,613e5a32,125cb872,da1985e8,94256215,41b74e80,9029e82f,3aeb1eaf,29bddcc9),
+S(d4566d05,258d5f6a,1db13b5c,3fa1de2d,8986d8b1,2f43483f,827d01da,4fdbb22b,95dcd4fd,6b08ebb8,411a76cf,91d7eec,572c4e0c,8e976704,85219f52,d871bc25),
+S(902a5847,a9bd0a9b,39c023ee,99449f40,9b15d689,17965e0b,9b2cb86f,e2ec7377,f9d3f83d,efca007,ef6535ba,e3bd0dd9,1f114bcb,ede477f0,34c0078f,8e9c037f),
+S(88280709,e40fc21,67a12e90,7941e14b,c9fdd2aa,86d05450,dc7c90fd,9834b91d,cd6710c4,416f67fc,57565bdb,30bf98e1,28889d9c,4184f288,a9754013,2a9fa455),
+S(523cd402,6d8608db,74959b8c,195c4398,97a664e6,eff6d586,7309a8c0,b7449934,a4ca6e59,d17145b2,9fab52ee,4015ffe4,26611ef2,77e2f664,d277190f,45d54b13),
+S(c61e1f51,5c525db4,bf2a19b4,36a95e7b,cd94c7ba,bfb7c9cd,cc2e6672,16d7f695,adc5b68c,be0d3854,15a8b9d0,d6e5642e,35c25106,1c87e4ae,8e918ccf,118ab7e2),
+S(289afb4e,ab59dbe6,1c3a9a14,118b82ad,49d79913,4e78d09e,2bee5951,6922cd17,c4d436f8,834cef71,2c7e9c43,fcbcd9e9,3ce2ec4d,49cd0bf9,7dfa82e1,1748e5af),
+S(a0d54c5f,938c436,f42e4972,5d68d23b,8a9a40b9,3544a1e4,1cb7c649,c2a5ee91,de742700,68197fe5,db2c05f8,93e20393,e2da8249,3859b2da,1e800737,2388db16),
+S(99ff9dd8,f0497368,9d65dddd,6346a92d,876fda95,4779484f,d467debf,fd012d5d,20832753,73c313e4,5a4ce377,8c51c56a,1cbf74fa,64653eda,23e30ba1,1e183878),
+S(57f9313,cfc50f7b,c45ac886,2ba1c78f,69e01b7a,8b3b38e2,8573c8b5,781a3187,6d05cb02,f7ae51e1,4846a257,31304ade,b41af557,8f0eeb13,bb651116,4ee48781),
+S(4492ea01,c10ed5f7,6bded4ff,e9fdf056,e9da593,ff95c8e6,ff36bdec,4a7e6b4,2a4461e4,e1e99782,373386ed,9b5b11a8,cbff6390,f9301dbb,b7d73d1f,4817088b),
+S(dc4a3cad,13b1da48,68b51d10,68dfb3ec,d25294e1,59bd307c,c393b297,7d4a76b9,e2f95da1,5a07a0f3,d34e6305,da955f3c,fffa198d,9f51ca2d,677e20e0,6638f04f),
+S(f68509b0,7ab937ef,957ee500,58560824,dab8cfd2,fcd8cc2f,fde7e3cf,6c62100c,f09e9917,2b06a4ec,6e70a0e5,44bbc473,6219909e,74033159,5472336e,69e4f970),
+S(76f8bce9,e758314e,8315f1b4,8320bd9e,d2eb24cb,44177f6a,53634d13,7d40de2e,6d8672d3,3726e9a6,bd11a87f,e06f453f,67a82ea3,baa97525,7feb4fd7,c1d820d1),
+S(6d5aecda,2150a19e,51a821cb,da71f30e,ac592a3f,c4a66499,1f9f2c7a,5f59d6f9,98d8b1cb,bbb233ac,b8a05396,36ae43e8,611c82ef,f5e35f0b,865aace9,5a220bda)},
+{S(92ce1b36,b85058d6,17fc68da,f753b966,d70b2cbf,42ccd826,1f6fc362,ab221cac,da013f81,83ae84e,9937db9c,6bafc469,52ce95c8,c1ea6555,b4f06936,bcd4e0b3),
+S(b4e681e4,3e94c8ad,dac6fa4a,163d143c,986b8a7a,8704b79d,ec8ecce9,dbf191c5,1df889a7,3bb98df3,d1b2adcd,47caeb8d,3a6f5cae,1f34848e,167408a,4c6d331f),
+S(e8b70943,db2767f5,b44f89f,c21b78f1,4914a080,b07402e7,f3858359,d2cbbc85,53e28758,f7fbcd7a,16d4a6be,a5b5f06d,33b3047f,7b32855a,12842d20,994a9aab),
+S(c2d4adb2,5f986137,f602b11a,d493af95,58c35542,2901a7a5,bc200e06,9021e7d6,bd7409a9,a19e8b24,ccf274e1,e00beee8,c541cb08,b0c10931,1b093b66,a75b67b0),
+S(5ed79c21,698f45be,736c323f,864675bb,3a2f8c6,6c6c1611,2a4e0f8b,1e6329f8,84c9852c,d5e3d109,be4ccf6a,7f3d7c31,12d635a9,32648b36,3a9d9266,c3296229),
+S(9b763c30,67c6c30c,5326891c,2deccc78,b9695a03,51c86bcf,d079e0b3,4d3a1aad,f3b4b11b,87714317,c1421a16,de91d8e5,42be8eb1,17424b56,37e2a797,e4e72a2b),
+S(9df4a924,516fb785,8511746d,b3662730,4539c9c1,93954e56,55f0500f,6a3776b,324a9ed,d2194462,c634761b,97608c3a,970bfe7,e695ba50,c398a2b,dd83b0ea),
+S(e06e6351,aaa85741,e3a38c9c,c66164bf,f02c2d2e,7de3e957,4508d7e5,6a19478a,2065c0,8292068c,fdd0567f,1fc55705,de173462,e155accb,29290667,4f291727),
+S(31df12c,5209bf85,9bd5b306,7e1d9c6,ece22427,83f4ca05,ca611f10,bcbc8def,c1942fdb,cf372f4f,5ecf7c5e,e2b89f78,dcd4092c,720a132d,5e8e5546,261e6a7d),
+S(3c263de6,69052a54,c6c416ab,f67c49e9,43692178,85e3ccfa,1d0e739b,3b504cc,d7132f19,1561c938,a2ac226e,e4f77816,fafb3903,6a0a197b,e07ad224,f7cec12f),
+S(2cbf6768,9b9ba94,84647f16,87dfeefe,35b4780a,b602205f,269cb416,4a757930,da7cd81d,36f99a20,9a5b0612,2c01dfe3,786c733e,52d2f2a7,8ff60a80,8b43e3db),
+S(3e17b4ad,15eac0b6,93783680,6f192e00,71811c4a,a63ac4a0,71f580a4,f2b0d604,8f67f545,a1db78d9,97a72626,b17c8dee,2d67fbf8,9a794ae2,85d3d0a,c9e7012b),
+S(d1baa907,ea9210ba,ec2ec8f6,7c96f812,563e59f7,9dfae7eb,32a94e62,f31934fb,4689e9ec,a00600f,cda51fb0,130f3de5,b14c8107,44d1fc42,f64beaa8,66a568a3),
+S(974b84a7,4459b39b,6c4cb2c2,e76dfabf,ea1e3ed4,4ba2c8df,3c1d06c2,f9160005,b3f3409d,cef02c26,9965cc22,49bb3a6a,1ede417,fd218ca7,cfc39ec1,fbfb0e60),
+S(1f892256,c806921f,dd8a8733,8af3de77,da78fdf,cc908b4,241871ec,2bbd3c9c,1e5b56ed,ae8a23d,d5ad318c,49735c4c,eae80434,ae9f9fc4,3c382674,ceb9d9be),
+S(e7a4ae67,ce3d7c2,68ae1d4,eeacde74,73382e31,9ba42cf8,1b8fe063,d8809238,a1e73ceb,be8db34e,cd6531ec,931d3d42,d1f395b,b8fd314a,46fcbe7b,81f0f285)},
+{S(d068ba0c,97abefe1,311a6ff5,1e5c1073,eb5ea0e5,a3b87841,16434fc,a4fdc11c,95395dd7,c57241c1,5e2f21e9,e7ff78f6,17818271,3eee36a6,87ed1f6b,7b40734e),
+S(7abf35aa,a8666c,8a4054ae,d2b71358,cc6d1f13,6690812f,bb4dbbf8,40b33007,93b003e6,ba25d32c,4f05aac,ff78f017,f947960f,e0c0cb2c,d49197f7,c10aa0e8),
+S(cc9dcd76,1bdc1f2e,443a0437,cfffb7ab,d3e9abc6,cdd21328,16213dc6,7687fd8c,14dee6c8,4275665d,997018c9,4d7c221b,1b2a18c5,f7149e48,2bcd057e,e82cd0e),
+S(200c2e44,ec0decab,d6bcc5f9,4f43d7f6,cefb9927,801a2fd3,f49f4c4f,59b17f93,c6842375,fe577c11,fe9e850b,db5e7be8,91fe9bcd,1cba9d61,9261a37e,c863c476),
+S(924c2a0,a143a5e1,42dd472b,7ee65e91,dbe0a815,d7be870f,eb25ce74,9409d0cd,bcc8fb0f,eb15fde9,b747317e,d08760bc,44940de1,7ed891c8,f5612050,dc0941b3),
+S(803237c8,94d2aaf4,a1dc170e,56542937,2bbafcd0,e6418556,6091b88b,dce731f0,cf3f9f1a,f90e9c25,5f3cc051,58ff2971,90419f90,38a978c4,10c141ee,5dcb94a6),
+S(b487cd4f,de048733,e41bf683,c6d0e3d9,1c3c45fa,76bc87c2,cf9677d6,14cf438a,f27a0a1,1f0bf346,c66222ec,31aaba86,69d1e539,6a4121d4,1194e064,8d09f15c),
+S(fe96405,f3e9a624,dd81688d,b019fb87,aa71fb9d,a7363948,7085c0e1,184a2094,e1234335,6bed581f,b783ca4b,5b7d43af,5bcbad99,71921446,a3964cd5,f261194f),
+S(10d151c1,eb9f8c52,905b346,4550f500,8c8c3ea5,7dbf8e48,58abd23f,75384982,2b450dd3,d87ed495,d91cecc0,50cf1fbd,c47dbd2b,6783a6b5,453683c5,50607d22),
+S(9ce0c6e7,2b22c43c,5fa8cb0,8e1d8cb6,9493ef33,b045f4a0,688b9e8e,870cc054,1e19768a,59d8591,818f7805,d2e16b91,405f7cbe,771e8bbc,2cfb7697,270b1690),
+S(ba9097c8,49eaaa3e,30c4c7f5,85ee61a1,cb9cb7e2,7d97e5dc,b7793e6b,6e644e95,ce0e7f7e,e1054703,b6481b83,cc38a8e5,6f174622,e094afa5,68d296da,b9684442),
+S(ebd747c,328d52f,819ecc1f,732be68b,a1de9d8a,cde5910a,7a67bd2e,7c561e84,58b2d137,b679a0ca,9b88bb02,819d7db5,cec8ee21,ac6842f8,3c152f31,b745a22b),
+S(46cfa53a,86a33d4c,40fa9c4d,e01f8e25,509d7d30,fd3d4b87,350759ad,68ead413,1e4bad39,fbcb6977,b7357196,d16ff8f8,f31a5ecc,6fc4734f,bd8d2e9e,ba3daa88),
+S(7182df2e,b59c00f6,b3ba8d1c,a64df9d7,62074aa9,573a88ff,b93110f,34840134,8f737ed3,298aa192,6390c4c2,6011f8b1,f9ff4be3,405fd43e,d4eed9bb,58abaf3b),
+S(f035d7e2,42d425ac,c3d3d2f5,9dbdd72,d6f89026,f22b4ee5,d2ee3fa,1d6ebe7e,b4963ea8,b5e57a45,85edeb10,45326289,cd1cf502,f3f6900,ff204719,65321be1),
+S(461a4f46,2c41573f,4099496d,f7db0acf,12682611,19c983d5,bb856c1a,323b300c,dc4bfb0b,6cf1ace2,482b071c,c1fb57c9,fda00f54,f9b3372d,20d38241,28379318)}
+};
+#undef S
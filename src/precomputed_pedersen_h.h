@@ -0,0 +1,36 @@
+/***********************************************************************
+ * Distributed under the MIT software license, see the accompanying    *
+ * file COPYING or https://www.opensource.org/licenses/mit-license.php.*
+ ***********************************************************************/
+
+#ifndef SECP256K1_PRECOMPUTED_PEDERSEN_H_H
+#define SECP256K1_PRECOMPUTED_PEDERSEN_H_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "group.h"
+#include "ecmult_gen.h"
+
+/* The value generator H (secp256k1_generator_h in the rangeproof module). */
+#define SECP256K1_PEDERSEN_GE_CONST_H SECP256K1_GE_CONST( \
+    0x50929b74UL, 0xc1a04954UL, 0xb78b4b60UL, 0x35e97a5eUL, 0x078a5a0fUL, 0x28ec96d5UL, 0x47bfee9aUL, 0xce803ac0UL, \
+    0x31d3c686UL, 0x3973926eUL, 0x049e637cUL, 0xb1b5f40aUL, 0x36dac28aUL, 0xf1766968UL, 0xc30c2313UL, 0xf3a38904UL \
+)
+
+/* The table covers 64-bit multiplicands (Pedersen commitment values) in
+ * windows of PEDERSEN_H_PREC_BITS bits, see secp256k1_pedersen_ecmult_small. */
+#define PEDERSEN_H_PREC_BITS 4
+#define PEDERSEN_H_PREC_G ECMULT_GEN_PREC_G(PEDERSEN_H_PREC_BITS)
+#define PEDERSEN_H_PREC_N (64 / PEDERSEN_H_PREC_BITS)
+
+#ifndef EXHAUSTIVE_TEST_ORDER
+extern const secp256k1_ge_storage secp256k1_pedersen_h_prec_table[PEDERSEN_H_PREC_N][PEDERSEN_H_PREC_G];
+#endif /* !defined(EXHAUSTIVE_TEST_ORDER) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECP256K1_PRECOMPUTED_PEDERSEN_H_H */
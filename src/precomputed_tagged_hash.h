@@ -0,0 +1,203 @@
+/* This file was automatically generated by precompute_tagged_hash. */
+/* Each function initializes SHA256 with the midstate that secp256k1_sha256_initialize_tagged computes for its tag. */
+#ifndef SECP256K1_PRECOMPUTED_TAGGED_HASH_H
+#define SECP256K1_PRECOMPUTED_TAGGED_HASH_H
+#include "hash.h"
+#include "util.h"
+#define SECP256K1_PRECOMPUTED_TAGS(X) \
+    X(bip340_nonce, "BIP0340/nonce") \
+    X(bip340_aux, "BIP0340/aux") \
+    X(bip340_challenge, "BIP0340/challenge") \
+    X(bip340_batch, "BIP0340/batch") \
+    X(s2c_ecdsa_point, "s2c/ecdsa/point") \
+    X(s2c_ecdsa_data, "s2c/ecdsa/data") \
+    X(ecdsa_adaptor_nonce, "ECDSAadaptor/non") \
+    X(ecdsa_adaptor_aux, "ECDSAadaptor/aux") \
+    X(dleq, "DLEQ") \
+    X(musig_keyagg_list, "KeyAgg list") \
+    X(musig_keyagg_coef, "KeyAgg coefficient") \
+    X(musig_nonce, "MuSig/nonce") \
+    X(musig_noncecoef, "MuSig/noncecoef") \
+    X(musig_batch_session_id, "MuSig/batchsessionid") \
+    X(musig_partial_sig_batch, "MuSig/partialsigbatch")
+/* SHA256("BIP0340/nonce")||SHA256("BIP0340/nonce") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_bip340_nonce(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x46615b35ul;
+    sha->s[1] = 0xf4bfbff7ul;
+    sha->s[2] = 0x9f8dc671ul;
+    sha->s[3] = 0x83627ab3ul;
+    sha->s[4] = 0x60217180ul;
+    sha->s[5] = 0x57358661ul;
+    sha->s[6] = 0x21a29e54ul;
+    sha->s[7] = 0x68b07b4cul;
+    sha->bytes = 64;
+}
+/* SHA256("BIP0340/aux")||SHA256("BIP0340/aux") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_bip340_aux(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x24dd3219ul;
+    sha->s[1] = 0x4eba7e70ul;
+    sha->s[2] = 0xca0fabb9ul;
+    sha->s[3] = 0x0fa3166dul;
+    sha->s[4] = 0x3afbe4b1ul;
+    sha->s[5] = 0x4c44df97ul;
+    sha->s[6] = 0x4aac2739ul;
+    sha->s[7] = 0x249e850aul;
+    sha->bytes = 64;
+}
+/* SHA256("BIP0340/challenge")||SHA256("BIP0340/challenge") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_bip340_challenge(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x9cecba11ul;
+    sha->s[1] = 0x23925381ul;
+    sha->s[2] = 0x11679112ul;
+    sha->s[3] = 0xd1627e0ful;
+    sha->s[4] = 0x97c87550ul;
+    sha->s[5] = 0x003cc765ul;
+    sha->s[6] = 0x90f61164ul;
+    sha->s[7] = 0x33e9b66aul;
+    sha->bytes = 64;
+}
+/* SHA256("BIP0340/batch")||SHA256("BIP0340/batch") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_bip340_batch(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x79e3e0d2ul;
+    sha->s[1] = 0x12284f32ul;
+    sha->s[2] = 0xd7d89e1cul;
+    sha->s[3] = 0x6491ea9aul;
+    sha->s[4] = 0xad823b2ful;
+    sha->s[5] = 0xfacfe0b6ul;
+    sha->s[6] = 0x342b78baul;
+    sha->s[7] = 0x12ece87cul;
+    sha->bytes = 64;
+}
+/* SHA256("s2c/ecdsa/point")||SHA256("s2c/ecdsa/point") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_s2c_ecdsa_point(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xa9b21c7bul;
+    sha->s[1] = 0x358c3e3eul;
+    sha->s[2] = 0x0b6863d1ul;
+    sha->s[3] = 0xc62b2035ul;
+    sha->s[4] = 0xb44b40ceul;
+    sha->s[5] = 0x254a8912ul;
+    sha->s[6] = 0x0f85d0d4ul;
+    sha->s[7] = 0x8a5bf91cul;
+    sha->bytes = 64;
+}
+/* SHA256("s2c/ecdsa/data")||SHA256("s2c/ecdsa/data") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_s2c_ecdsa_data(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xfeefd675ul;
+    sha->s[1] = 0x73166c99ul;
+    sha->s[2] = 0xe2309cb8ul;
+    sha->s[3] = 0x6d458113ul;
+    sha->s[4] = 0x01d3a512ul;
+    sha->s[5] = 0x00e18112ul;
+    sha->s[6] = 0x37ee0874ul;
+    sha->s[7] = 0x421fc55ful;
+    sha->bytes = 64;
+}
+/* SHA256("ECDSAadaptor/non")||SHA256("ECDSAadaptor/non") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_ecdsa_adaptor_nonce(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x791dae43ul;
+    sha->s[1] = 0xe52d3b44ul;
+    sha->s[2] = 0x37f9edeaul;
+    sha->s[3] = 0x9bfd2ab1ul;
+    sha->s[4] = 0xcfb0f44dul;
+    sha->s[5] = 0xccf1d880ul;
+    sha->s[6] = 0xd18f2c13ul;
+    sha->s[7] = 0xa37b9024ul;
+    sha->bytes = 64;
+}
+/* SHA256("ECDSAadaptor/aux")||SHA256("ECDSAadaptor/aux") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_ecdsa_adaptor_aux(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xd14c7bd9ul;
+    sha->s[1] = 0x095d35e6ul;
+    sha->s[2] = 0xb8490a88ul;
+    sha->s[3] = 0xfb00ef74ul;
+    sha->s[4] = 0x0baa488ful;
+    sha->s[5] = 0x69366693ul;
+    sha->s[6] = 0x1c81c5baul;
+    sha->s[7] = 0xc33b296aul;
+    sha->bytes = 64;
+}
+/* SHA256("DLEQ")||SHA256("DLEQ") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_dleq(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x8cc4beacul;
+    sha->s[1] = 0x2e011f3ful;
+    sha->s[2] = 0x355c75fbul;
+    sha->s[3] = 0x3ba6a2c5ul;
+    sha->s[4] = 0xe96f3aeful;
+    sha->s[5] = 0x180530fdul;
+    sha->s[6] = 0x94582499ul;
+    sha->s[7] = 0x577fd564ul;
+    sha->bytes = 64;
+}
+/* SHA256("KeyAgg list")||SHA256("KeyAgg list") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_keyagg_list(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xb399d5e0ul;
+    sha->s[1] = 0xc8fff302ul;
+    sha->s[2] = 0x6badac71ul;
+    sha->s[3] = 0x07c5b7f1ul;
+    sha->s[4] = 0x9701e2eful;
+    sha->s[5] = 0x2a72ecf8ul;
+    sha->s[6] = 0x201a4c7bul;
+    sha->s[7] = 0xab148a38ul;
+    sha->bytes = 64;
+}
+/* SHA256("KeyAgg coefficient")||SHA256("KeyAgg coefficient") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_keyagg_coef(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x6ef02c5aul;
+    sha->s[1] = 0x06a480deul;
+    sha->s[2] = 0x1f298665ul;
+    sha->s[3] = 0x1d1134f2ul;
+    sha->s[4] = 0x56a0b063ul;
+    sha->s[5] = 0x52da4147ul;
+    sha->s[6] = 0xf280d9d4ul;
+    sha->s[7] = 0x4484be15ul;
+    sha->bytes = 64;
+}
+/* SHA256("MuSig/nonce")||SHA256("MuSig/nonce") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_nonce(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x07101b64ul;
+    sha->s[1] = 0x18003414ul;
+    sha->s[2] = 0x0391bc43ul;
+    sha->s[3] = 0x0e6258eeul;
+    sha->s[4] = 0x29d26b72ul;
+    sha->s[5] = 0x8343937eul;
+    sha->s[6] = 0xb7a0a4fbul;
+    sha->s[7] = 0xff568a30ul;
+    sha->bytes = 64;
+}
+/* SHA256("MuSig/noncecoef")||SHA256("MuSig/noncecoef") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_noncecoef(secp256k1_sha256 *sha) {
+    sha->s[0] = 0x2c7d5a45ul;
+    sha->s[1] = 0x06bf7e53ul;
+    sha->s[2] = 0x89be68a6ul;
+    sha->s[3] = 0x971254c0ul;
+    sha->s[4] = 0x60ac12d2ul;
+    sha->s[5] = 0x72846dcdul;
+    sha->s[6] = 0x6c81212ful;
+    sha->s[7] = 0xde7a2500ul;
+    sha->bytes = 64;
+}
+/* SHA256("MuSig/batchsessionid")||SHA256("MuSig/batchsessionid") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_batch_session_id(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xc23b28d5ul;
+    sha->s[1] = 0x609e1f9aul;
+    sha->s[2] = 0xfb1cfce5ul;
+    sha->s[3] = 0x2820a657ul;
+    sha->s[4] = 0x28cd68fcul;
+    sha->s[5] = 0x0fbb0989ul;
+    sha->s[6] = 0x45fa48ecul;
+    sha->s[7] = 0x6cd85eeeul;
+    sha->bytes = 64;
+}
+/* SHA256("MuSig/partialsigbatch")||SHA256("MuSig/partialsigbatch") */
+static SECP256K1_INLINE void secp256k1_sha256_initialize_tagged_musig_partial_sig_batch(secp256k1_sha256 *sha) {
+    sha->s[0] = 0xdf868225ul;
+    sha->s[1] = 0xdaf62d68ul;
+    sha->s[2] = 0xc92041e1ul;
+    sha->s[3] = 0x101e11f7ul;
+    sha->s[4] = 0x25c8ff6bul;
+    sha->s[5] = 0xf25a04c6ul;
+    sha->s[6] = 0xae3c4ec5ul;
+    sha->s[7] = 0x32b823d6ul;
+    sha->bytes = 64;
+}
+#endif /* SECP256K1_PRECOMPUTED_TAGGED_HASH_H */
@@ -108,4 +108,8 @@ static void secp256k1_scalar_cmov(secp256k1_scalar *r, const secp256k1_scalar *a
 /** Generate two scalars from a 32-byte seed and an integer using the chacha20 stream cipher */
 static void secp256k1_scalar_chacha20(secp256k1_scalar *r1, secp256k1_scalar *r2, const unsigned char *seed, uint64_t idx);
 
+/** Set *r to the randomizer of the i-th element of a batch verification whose randomizers are
+ *  derived from the 32-byte seed with secp256k1_scalar_chacha20. The randomizer of element 0 is 1. */
+static void secp256k1_scalar_batch_randomizer(secp256k1_scalar *r, const unsigned char *seed, size_t i);
+
 #endif /* SECP256K1_SCALAR_H */
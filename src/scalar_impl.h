@@ -37,6 +37,18 @@ static int secp256k1_scalar_set_b32_seckey(secp256k1_scalar *r, const unsigned c
     return (!overflow) & (!secp256k1_scalar_is_zero(r));
 }
 
+/* Using 1 as the first randomizer saves one scalar multiplication without
+ * affecting soundness. */
+static void secp256k1_scalar_batch_randomizer(secp256k1_scalar *r, const unsigned char *seed, size_t i) {
+    secp256k1_scalar rs[2];
+    if (i == 0) {
+        secp256k1_scalar_set_int(r, 1);
+        return;
+    }
+    secp256k1_scalar_chacha20(&rs[0], &rs[1], seed, i >> 1);
+    *r = rs[i & 1];
+}
+
 /* These parameters are generated using sage/gen_exhaustive_groups.sage. */
 #if defined(EXHAUSTIVE_TEST_ORDER)
 #  if EXHAUSTIVE_TEST_ORDER == 13
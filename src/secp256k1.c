@@ -822,6 +822,10 @@ int secp256k1_tagged_sha256(const secp256k1_context* ctx, unsigned char *hash32,
 # include "modules/ecdsa_adaptor/main_impl.h"
 #endif
 
+#ifdef ENABLE_MODULE_MULTIEXP
+# include "modules/multiexp/main_impl.h"
+#endif
+
 #ifdef ENABLE_MODULE_MUSIG
 # include "modules/musig/main_impl.h"
 #endif
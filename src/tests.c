@@ -19,6 +19,7 @@
 #include "../include/secp256k1_preallocated.h"
 #include "testrand_impl.h"
 #include "util.h"
+#include "precomputed_tagged_hash.h"
 
 #include "../contrib/lax_der_parsing.c"
 #include "../contrib/lax_der_privatekey_parsing.c"
@@ -531,6 +532,71 @@ void run_sha256_tests(void) {
     }
 }
 
+void run_sha256_transform_tests(void) {
+#if defined(SECP256K1_SHA256_X86_SHANI) || defined(SECP256K1_SHA256_ARM_SHA2)
+    int i, j;
+    if (!secp256k1_sha256_accel_available()) {
+        return;
+    }
+    /* Compare the hardware transform against the portable one. */
+    for (i = 0; i < 64 * count; i++) {
+        uint32_t s1[8], s2[8], chunk[16];
+        for (j = 0; j < 8; j++) {
+            s1[j] = s2[j] = secp256k1_testrand32();
+        }
+        for (j = 0; j < 16; j++) {
+            chunk[j] = secp256k1_testrand32();
+        }
+        secp256k1_sha256_transform_portable(s1, chunk);
+#if defined(SECP256K1_SHA256_X86_SHANI)
+        secp256k1_sha256_transform_shani(s2, chunk);
+#else
+        secp256k1_sha256_transform_arm_sha2(s2, chunk);
+#endif
+        CHECK(memcmp(s1, s2, sizeof(s1)) == 0);
+    }
+#endif
+}
+
+void run_sha256_multi_tests(void) {
+    unsigned char data[20][200];
+    const unsigned char *dataptrs[20];
+    unsigned char prefix[130];
+    unsigned char out[20 * 32];
+    unsigned char expected[32];
+    int i, j;
+
+    for (i = 0; i < 20; i++) {
+        secp256k1_testrand_bytes_test(data[i], sizeof(data[i]));
+        dataptrs[i] = data[i];
+    }
+    secp256k1_testrand_bytes_test(prefix, sizeof(prefix));
+    for (i = 0; i < 8 * count; i++) {
+        secp256k1_sha256 base;
+        size_t prefix_len = secp256k1_testrand_int(sizeof(prefix) + 1);
+        size_t len = secp256k1_testrand_int(sizeof(data[0]) + 1);
+        size_t n = 1 + secp256k1_testrand_int(20);
+        secp256k1_sha256_initialize(&base);
+        secp256k1_sha256_write(&base, prefix, prefix_len);
+        secp256k1_sha256_finalize_multi(out, &base, dataptrs, len, n);
+        for (j = 0; (size_t)j < n; j++) {
+            secp256k1_sha256 sha = base;
+            secp256k1_sha256_write(&sha, data[j], len);
+            secp256k1_sha256_finalize(&sha, expected);
+            CHECK(secp256k1_memcmp_var(&out[32 * j], expected, 32) == 0);
+        }
+#if defined(SECP256K1_SHA256_X86_AVX2)
+        /* finalize_multi may prefer other implementations, so test the lanes directly. */
+        if (secp256k1_sha256_avx2_available()) {
+            size_t m = n < 8 ? n : 8;
+            unsigned char out_lanes[8 * 32];
+            secp256k1_sha256_finalize_8way_avx2(out_lanes, &base, dataptrs, len, m);
+            CHECK(secp256k1_memcmp_var(out_lanes, out, 32 * m) == 0);
+        }
+#endif
+    }
+}
+
 void run_hmac_sha256_tests(void) {
     static const char *keys[6] = {
         "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b",
@@ -648,6 +714,25 @@ void run_tagged_sha256_tests(void) {
     secp256k1_context_destroy(none);
 }
 
+/* Check the midstates of precomputed_tagged_hash.h against secp256k1_sha256_initialize_tagged. */
+void run_precomputed_tagged_hash_tests(void) {
+#define CHECK_PRECOMPUTED_TAG(name, tag) do { \
+        secp256k1_sha256 sha, sha_precomputed; \
+        unsigned char out[32], out_precomputed[32]; \
+        secp256k1_sha256_initialize_tagged(&sha, (const unsigned char *)tag, sizeof(tag) - 1); \
+        secp256k1_sha256_initialize_tagged_##name(&sha_precomputed); \
+        CHECK(secp256k1_memcmp_var(sha.s, sha_precomputed.s, sizeof(sha.s)) == 0); \
+        CHECK(sha.bytes == sha_precomputed.bytes); \
+        secp256k1_sha256_write(&sha, (const unsigned char *)tag, sizeof(tag) - 1); \
+        secp256k1_sha256_write(&sha_precomputed, (const unsigned char *)tag, sizeof(tag) - 1); \
+        secp256k1_sha256_finalize(&sha, out); \
+        secp256k1_sha256_finalize(&sha_precomputed, out_precomputed); \
+        CHECK(secp256k1_memcmp_var(out, out_precomputed, sizeof(out)) == 0); \
+    } while (0);
+    SECP256K1_PRECOMPUTED_TAGS(CHECK_PRECOMPUTED_TAG)
+#undef CHECK_PRECOMPUTED_TAG
+}
+
 /***** RANDOM TESTS *****/
 
 void test_rand_bits(int rand32, int bits) {
@@ -1922,6 +2007,20 @@ void scalar_chacha_tests(void) {
     secp256k1_scalar_set_b32(&exp_r2, &expected5[32], NULL);
     CHECK(secp256k1_scalar_eq(&exp_r1, &r1));
     CHECK(secp256k1_scalar_eq(&exp_r2, &r2));
+
+    /* The batch randomizers are 1 followed by the second scalar for counter 0
+     * and the scalars for the following counters. */
+    secp256k1_scalar_batch_randomizer(&r1, seed0, 0);
+    CHECK(secp256k1_scalar_is_one(&r1));
+    secp256k1_scalar_batch_randomizer(&r1, seed0, 1);
+    secp256k1_scalar_set_b32(&exp_r1, &expected1[32], NULL);
+    CHECK(secp256k1_scalar_eq(&exp_r1, &r1));
+    secp256k1_scalar_batch_randomizer(&r1, seed0, 2);
+    secp256k1_scalar_batch_randomizer(&r2, seed0, 3);
+    secp256k1_scalar_set_b32(&exp_r1, &expected2[0], NULL);
+    secp256k1_scalar_set_b32(&exp_r2, &expected2[32], NULL);
+    CHECK(secp256k1_scalar_eq(&exp_r1, &r1));
+    CHECK(secp256k1_scalar_eq(&exp_r2, &r2));
 }
 
 void run_scalar_tests(void) {
@@ -2789,6 +2888,7 @@ void test_sqrt(const secp256k1_fe *a, const secp256k1_fe *k) {
     secp256k1_fe r1, r2;
     int v = secp256k1_fe_sqrt(&r1, a);
     CHECK((v == 0) == (k == NULL));
+    CHECK(secp256k1_fe_is_quad_var(a) == v);
 
     if (k != NULL) {
         /* Check that the returned root is +/- the given known answer */
@@ -3360,6 +3460,17 @@ void test_ge(void) {
         free(ge_set_all);
     }
 
+    /* Test constant time batch gej -> ge conversion, skipping the infinity at index 0. */
+    {
+        secp256k1_ge *ge_set_all = (secp256k1_ge *)checked_malloc(&ctx->error_callback, 4 * runs * sizeof(secp256k1_ge));
+        CHECK(secp256k1_gej_is_infinity(&gej[0]));
+        secp256k1_ge_set_all_gej(ge_set_all, &gej[1], 4 * runs);
+        for (i = 0; i < 4 * runs; i++) {
+            ge_equals_gej(&ge_set_all[i], &gej[i + 1]);
+        }
+        free(ge_set_all);
+    }
+
     /* Test batch gej -> ge conversion with many infinities. */
     for (i = 0; i < 4 * runs + 1; i++) {
         int odd;
@@ -4115,6 +4226,12 @@ static int ecmult_multi_false_callback(secp256k1_scalar *sc, secp256k1_ge *pt, s
     return 0;
 }
 
+/* Wrapper for secp256k1_ecmult_multi_func interface that uses affine buckets
+ * regardless of the number of points */
+static int test_ecmult_pippenger_affine_batch_single(const secp256k1_callback* error_callback, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n) {
+    return secp256k1_ecmult_pippenger_batch_buckets(error_callback, scratch, r, inp_g_sc, cb, cbdata, n, 0, 1);
+}
+
 void test_ecmult_multi(secp256k1_scratch *scratch, secp256k1_ecmult_multi_func ecmult_multi) {
     int ncount;
     secp256k1_scalar szero;
@@ -4361,6 +4478,7 @@ int test_ecmult_multi_random(secp256k1_scratch *scratch) {
      * - Including or excluding an nonzero a*G term (or such a term at all).
      * - Final expected result equal to infinity or not (roughly 50%).
      * - ecmult_multi_var, ecmult_strauss_single_batch, ecmult_pippenger_single_batch
+     *   (with Jacobian or affine buckets)
      */
 
     /* These 4 variables define the eventual input to the ecmult_multi function.
@@ -4382,10 +4500,11 @@ int test_ecmult_multi_random(secp256k1_scratch *scratch) {
 
     int i;
     /* Which multiplication function to use */
-    int fn = secp256k1_testrand_int(3);
+    int fn = secp256k1_testrand_int(4);
     secp256k1_ecmult_multi_func ecmult_multi = fn == 0 ? secp256k1_ecmult_multi_var :
                                                fn == 1 ? secp256k1_ecmult_strauss_batch_single :
-                                               secp256k1_ecmult_pippenger_batch_single;
+                                               fn == 2 ? secp256k1_ecmult_pippenger_batch_single :
+                                               test_ecmult_pippenger_affine_batch_single;
     /* Simulate exponentially distributed num. */
     int num_bits = 2 + secp256k1_testrand_int(6);
     /* Number of (scalar, point) inputs (excluding g). */
@@ -4542,6 +4661,49 @@ void test_ecmult_multi_batch_single(secp256k1_ecmult_multi_func ecmult_multi) {
     secp256k1_scratch_destroy(&ctx->error_callback, scratch_empty);
 }
 
+void test_ecmult_multi_small(void) {
+    secp256k1_gej a[ECMULT_MULTI_SMALL_MAX_POINTS];
+    secp256k1_scalar na[ECMULT_MULTI_SMALL_MAX_POINTS];
+    secp256k1_scalar ng;
+    secp256k1_scalar szero;
+    secp256k1_gej r;
+    secp256k1_gej sum_a;
+    secp256k1_gej ngj;
+    size_t num;
+    size_t i;
+
+    secp256k1_scalar_set_int(&szero, 0);
+    for (num = 0; num <= ECMULT_MULTI_SMALL_MAX_POINTS; num++) {
+        random_scalar_order(&ng);
+        secp256k1_gej_set_infinity(&sum_a);
+        secp256k1_ecmult(&ngj, &sum_a, &szero, &ng);
+        for (i = 0; i < num; i++) {
+            secp256k1_gej tmp;
+            random_gej_test(&a[i]);
+            random_scalar_order(&na[i]);
+            /* Cover zero scalars and the point at infinity */
+            if (secp256k1_testrand_bits(3) == 0) {
+                secp256k1_scalar_set_int(&na[i], 0);
+            } else if (secp256k1_testrand_bits(3) == 0) {
+                secp256k1_gej_set_infinity(&a[i]);
+            }
+            secp256k1_ecmult(&tmp, &a[i], &na[i], &szero);
+            secp256k1_gej_add_var(&sum_a, &sum_a, &tmp, NULL);
+        }
+        secp256k1_gej_neg(&sum_a, &sum_a);
+        secp256k1_gej_neg(&ngj, &ngj);
+
+        secp256k1_ecmult_multi_small(&r, num, a, na, &ng);
+        secp256k1_gej_add_var(&r, &r, &sum_a, NULL);
+        secp256k1_gej_add_var(&r, &r, &ngj, NULL);
+        CHECK(secp256k1_gej_is_infinity(&r));
+
+        secp256k1_ecmult_multi_small(&r, num, a, na, NULL);
+        secp256k1_gej_add_var(&r, &r, &sum_a, NULL);
+        CHECK(secp256k1_gej_is_infinity(&r));
+    }
+}
+
 void test_secp256k1_pippenger_bucket_window_inv(void) {
     int i;
 
@@ -4716,11 +4878,14 @@ void run_ecmult_multi_tests(void) {
 
     test_secp256k1_pippenger_bucket_window_inv();
     test_ecmult_multi_pippenger_max_points();
+    test_ecmult_multi_small();
     scratch = secp256k1_scratch_create(&ctx->error_callback, 819200);
     test_ecmult_multi(scratch, secp256k1_ecmult_multi_var);
     test_ecmult_multi(NULL, secp256k1_ecmult_multi_var);
     test_ecmult_multi(scratch, secp256k1_ecmult_pippenger_batch_single);
     test_ecmult_multi_batch_single(secp256k1_ecmult_pippenger_batch_single);
+    test_ecmult_multi(scratch, test_ecmult_pippenger_affine_batch_single);
+    test_ecmult_multi_batch_single(test_ecmult_pippenger_affine_batch_single);
     test_ecmult_multi(scratch, secp256k1_ecmult_strauss_batch_single);
     test_ecmult_multi_batch_single(secp256k1_ecmult_strauss_batch_single);
     while (todo > 0) {
@@ -6903,6 +7068,10 @@ void run_ecdsa_edge_cases(void) {
 # include "modules/ecdsa_adaptor/tests_impl.h"
 #endif
 
+#ifdef ENABLE_MODULE_MULTIEXP
+# include "modules/multiexp/tests_impl.h"
+#endif
+
 void run_secp256k1_memczero_test(void) {
     unsigned char buf1[6] = {1, 2, 3, 4, 5, 6};
     unsigned char buf2[sizeof(buf1)];
@@ -7120,9 +7289,12 @@ int main(int argc, char **argv) {
     run_inverse_tests();
 
     run_sha256_tests();
+    run_sha256_transform_tests();
+    run_sha256_multi_tests();
     run_hmac_sha256_tests();
     run_rfc6979_hmac_sha256_tests();
     run_tagged_sha256_tests();
+    run_precomputed_tagged_hash_tests();
 
     /* scalar tests */
     run_scalar_tests();
@@ -7220,6 +7392,10 @@ int main(int argc, char **argv) {
     run_ecdsa_adaptor_tests();
 #endif
 
+#ifdef ENABLE_MODULE_MULTIEXP
+    run_multiexp_tests();
+#endif
+
     /* util tests */
     run_secp256k1_memczero_test();
 
@@ -40,6 +40,10 @@
 #include "include/secp256k1_musig.h"
 #endif
 
+#ifdef ENABLE_MODULE_RANGEPROOF
+#include "include/secp256k1_rangeproof.h"
+#endif
+
 void run_tests(secp256k1_context *ctx, unsigned char *key);
 
 int main(void) {
@@ -247,6 +251,60 @@ void run_tests(secp256k1_context *ctx, unsigned char *key) {
     }
 #endif
 
+#ifdef ENABLE_MODULE_RANGEPROOF
+    {
+        /* Eight outputs share gen, so that commit_batch builds a table for it when given a
+         * scratch space, and two use H, which has a precomputed table. */
+        secp256k1_generator gen;
+        secp256k1_generator_table *table;
+        secp256k1_scratch_space *scratch;
+        secp256k1_pedersen_commitment commits[10];
+        secp256k1_pedersen_commitment commit;
+        unsigned char ser_commit[33];
+        unsigned char ser_commit_batch[33];
+        const unsigned char *blinds[10];
+        const secp256k1_generator *gens[10];
+        uint64_t values[10];
+
+        CHECK(secp256k1_generator_generate(ctx, &gen, msg));
+        table = secp256k1_generator_table_create(ctx, &gen);
+        CHECK(table != NULL);
+        scratch = secp256k1_scratch_space_create(ctx, 1024 * 1024);
+        CHECK(scratch != NULL);
+        for (i = 0; i < 10; i++) {
+            blinds[i] = key;
+            gens[i] = i < 8 ? &gen : secp256k1_generator_h;
+            values[i] = i * 0x123456789ULL;
+        }
+
+        VALGRIND_MAKE_MEM_UNDEFINED(key, 32);
+        VALGRIND_MAKE_MEM_UNDEFINED(&values[1], sizeof(values[1]));
+        ret = secp256k1_pedersen_commit_with_table(ctx, &commit, key, values[1], table);
+        VALGRIND_MAKE_MEM_DEFINED(&ret, sizeof(ret));
+        CHECK(ret == 1);
+
+        VALGRIND_MAKE_MEM_UNDEFINED(key, 32);
+        VALGRIND_MAKE_MEM_UNDEFINED(values, sizeof(values));
+        ret = secp256k1_pedersen_commit_batch(ctx, scratch, commits, blinds, values, gens, 10);
+        VALGRIND_MAKE_MEM_DEFINED(&ret, sizeof(ret));
+        CHECK(ret == 1);
+        VALGRIND_MAKE_MEM_DEFINED(&commit, sizeof(commit));
+        VALGRIND_MAKE_MEM_DEFINED(&commits[1], sizeof(commits[1]));
+        CHECK(secp256k1_pedersen_commitment_serialize(ctx, ser_commit, &commit));
+        CHECK(secp256k1_pedersen_commitment_serialize(ctx, ser_commit_batch, &commits[1]));
+        CHECK(secp256k1_memcmp_var(ser_commit, ser_commit_batch, sizeof(ser_commit)) == 0);
+
+        VALGRIND_MAKE_MEM_UNDEFINED(key, 32);
+        VALGRIND_MAKE_MEM_UNDEFINED(values, sizeof(values));
+        ret = secp256k1_pedersen_commit_batch(ctx, NULL, commits, blinds, values, gens, 10);
+        VALGRIND_MAKE_MEM_DEFINED(&ret, sizeof(ret));
+        CHECK(ret == 1);
+
+        secp256k1_scratch_space_destroy(ctx, scratch);
+        secp256k1_generator_table_destroy(table);
+    }
+#endif
+
 #ifdef ENABLE_MODULE_MUSIG
     {
         secp256k1_xonly_pubkey pk;
@@ -255,6 +313,8 @@ void run_tests(secp256k1_context *ctx, unsigned char *key) {
         unsigned char session_id[32];
         secp256k1_musig_secnonce secnonce;
         secp256k1_musig_pubnonce pubnonce;
+        secp256k1_musig_secnonce secnonces[3];
+        secp256k1_musig_pubnonce pubnonces[3];
         const secp256k1_musig_pubnonce *pubnonce_ptr[1];
         secp256k1_musig_aggnonce aggnonce;
         secp256k1_musig_keyagg_cache cache;
@@ -289,6 +349,9 @@ void run_tests(secp256k1_context *ctx, unsigned char *key) {
         ret = secp256k1_musig_nonce_gen(ctx, &secnonce, &pubnonce, session_id, key, msg, &cache, extra_input);
         VALGRIND_MAKE_MEM_DEFINED(&ret, sizeof(ret));
         CHECK(ret == 1);
+        ret = secp256k1_musig_nonce_gen_batch(ctx, secnonces, pubnonces, session_id, 3, key, msg, &cache, extra_input);
+        VALGRIND_MAKE_MEM_DEFINED(&ret, sizeof(ret));
+        CHECK(ret == 1);
         CHECK(secp256k1_musig_nonce_agg(ctx, &aggnonce, pubnonce_ptr, 1));
         CHECK(secp256k1_musig_nonce_process(ctx, &session, &aggnonce, msg, &cache, &adaptor) == 1);
 